@@ -0,0 +1,880 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+// Micro-benchmark for the JS <-> C++ binding bridge (`make bench-bridge`).
+//
+// Runs representative BIND_* payloads through the full request -> callback ->
+// response path twice: once the way bindings used to do it (json::parse, a
+// recursive processInput rebuild, a recursive formatOutput rebuild, then
+// json::serialize) and once through RenWeb::Transcoder with a per-call arena.
+// Every operator new is counted, so each case reports heap allocations and
+// bytes per call next to the latency percentiles. Both paths must produce the
+// same JSON or the case is flagged as a mismatch.
+//
+// A second group times argument extraction alone, comparing hand-written
+// req.as_array()[i] unpacking with typed CallbackManager::add<Sig> bindings.
+//
+// A third group times the trust check every BIND_* call makes before its
+// callback runs: the old per-call walk of info.json "trusted" (three regexes
+// per rule) against RenWeb::TrustRules compiled once, both on a page change
+// (verdict cache miss) and on the steady-state cached verdict. Each call also
+// goes through a tiny transcoded binding so the numbers read as overhead per
+// binding call rather than in isolation.
+//
+// A fourth group round-trips a single string of 1 KiB to 64 MiB (UTF-8 text and
+// binary) through the string codec: the old byte-integer array encoding next
+// to the transcoder's UTF-8/base64 wire format. Each path runs in a forked
+// child so its peak RSS can be read back with wait4(); the growth over the
+// child's RSS before the first call is what the encoding itself cost.
+//
+//   bridge-bench [--out bridge.json] [--iterations 20000] [--max-size 64M] [--only name,name]
+#include "../include/encoding.hpp"
+#include "../include/transcoder.hpp"
+#include "../include/trust_rules.hpp"
+#include "../include/managers/binding_args.hpp"
+#include "../include/managers/callback_manager.hpp"
+#include <boost/json.hpp>
+#include <boost/json/serialize.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <regex>
+#include <string>
+#include <vector>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace json = boost::json;
+namespace Encoding = RenWeb::Encoding;
+namespace Transcoder = RenWeb::Transcoder;
+using TrustRules = RenWeb::TrustRules;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> allocated_bytes{0};
+}
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+    // The pre-transcoder binding path, kept verbatim as the baseline
+    namespace Legacy {
+        json::value processInput(const json::value& input);
+
+        json::value processInput(const json::object& input) {
+            if (Encoding::isEncoded(input)) {
+                return json::value(Encoding::decodeString(input));
+            }
+            json::object processed_input;
+            for (const auto& item : input) {
+                processed_input[item.key()] = processInput(item.value());
+            }
+            return processed_input;
+        }
+
+        json::value processInput(const json::array& input) {
+            json::array processed_input;
+            for (const auto& item : input) {
+                processed_input.push_back(processInput(item));
+            }
+            return processed_input;
+        }
+
+        json::value processInput(const json::value& input) {
+            switch (input.kind()) {
+                case json::kind::array: return processInput(input.as_array());
+                case json::kind::object: return processInput(input.as_object());
+                default: return input;
+            }
+        }
+
+        json::value formatOutput(const json::value& output) {
+            json::array formatted_output_arr;
+            json::object formatted_output_obj;
+            switch (output.kind()) {
+                case json::kind::string:
+                    return Encoding::encodeString(std::string_view(output.as_string().data(), output.as_string().size()));
+                case json::kind::array:
+                    for (const auto& item : output.as_array()) {
+                        formatted_output_arr.push_back(formatOutput(item));
+                    }
+                    return formatted_output_arr;
+                case json::kind::object:
+                    if (Encoding::isEncoded(output.as_object())) {
+                        return output;
+                    }
+                    for (const auto& item : output.as_object()) {
+                        formatted_output_obj[item.key()] = formatOutput(item.value());
+                    }
+                    return formatted_output_obj;
+                default:
+                    return output;
+            }
+        }
+
+        std::string call(const std::function<json::value(const json::value&)>& fn, const std::string& req) {
+            return json::serialize(formatOutput(fn(processInput(json::parse(req)))));
+        }
+
+        // Strings used to cross the bridge as one JSON number per byte
+        json::value encodeBytes(const json::string& str) {
+            json::array bytes;
+            bytes.reserve(str.size());
+            for (const char c : str) {
+                bytes.emplace_back(static_cast<int64_t>(static_cast<unsigned char>(c)));
+            }
+            return json::object{{Encoding::TYPE_KEY, Encoding::BASE64}, {Encoding::VALUE_KEY, std::move(bytes)}};
+        }
+
+        std::string roundTrip(const json::value& value, size_t* wire_bytes = nullptr) {
+            const std::string wire = json::serialize(encodeBytes(value.as_string()));
+            if (wire_bytes) *wire_bytes = wire.size();
+            return Encoding::decodeString(json::parse(wire).as_object());
+        }
+
+        // The per-call trust check from before TrustRules (the error page
+        // short-circuit is left out, the bench has no Config)
+        std::string toLowerAscii(std::string value) {
+            std::transform(value.begin(), value.end(), value.begin(),
+                [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return value;
+        }
+
+        bool isUriLike(const std::string& value) {
+            static const std::regex uri_regex(R"(^[a-zA-Z][a-zA-Z0-9+.-]*://[^\s]+$)");
+            return std::regex_match(value, uri_regex);
+        }
+
+        std::string normalizeOriginOrUri(const std::string& value) {
+            static const std::regex origin_regex(R"(^([a-zA-Z][a-zA-Z0-9+.-]*://[^/\s?#]+))");
+            std::smatch match;
+            if (std::regex_search(value, match, origin_regex) && match.size() > 1) {
+                return toLowerAscii(match[1].str());
+            }
+            return toLowerAscii(value);
+        }
+
+        std::string extractHostFromUri(const std::string& value) {
+            static const std::regex host_regex(R"(^[a-zA-Z][a-zA-Z0-9+.-]*://([^/:?#\s]+))");
+            std::smatch match;
+            if (std::regex_search(value, match, host_regex) && match.size() > 1) {
+                return toLowerAscii(match[1].str());
+            }
+            return std::string();
+        }
+
+        std::string trimAscii(std::string value) {
+            const auto start = value.find_first_not_of(" \t\n\r");
+            if (start == std::string::npos) {
+                return std::string();
+            }
+            const auto end = value.find_last_not_of(" \t\n\r");
+            return value.substr(start, end - start + 1);
+        }
+
+        bool trustedRuleMatchesTarget(const std::string& rule_value, const std::string& current_page) {
+            const bool target_is_uri = isUriLike(current_page);
+            if (target_is_uri) {
+                const std::string target_origin = normalizeOriginOrUri(current_page);
+                const std::string target_host = extractHostFromUri(current_page);
+                if (isUriLike(rule_value)) {
+                    return normalizeOriginOrUri(rule_value) == target_origin;
+                }
+                const std::string lowered_rule = toLowerAscii(rule_value);
+                return lowered_rule == target_host || lowered_rule == target_origin;
+            }
+
+            if (isUriLike(rule_value)) {
+                return false;
+            }
+            return toLowerAscii(rule_value) == toLowerAscii(current_page);
+        }
+
+        bool evaluateRuleList(const json::value& rules, const std::string& target) {
+            std::vector<std::string> allows, denies;
+
+            auto process_rule = [&](const std::string& raw) {
+                std::string r = trimAscii(raw);
+                if (r.empty()) return;
+                if (r[0] == '!') {
+                    std::string val = trimAscii(r.substr(1));
+                    if (!val.empty()) denies.push_back(std::move(val));
+                } else {
+                    allows.push_back(std::move(r));
+                }
+            };
+
+            if (rules.is_array()) {
+                for (const auto& entry : rules.as_array()) {
+                    if (entry.is_string())
+                        process_rule(std::string(entry.as_string().c_str()));
+                }
+            } else if (rules.is_string()) {
+                process_rule(std::string(rules.as_string().c_str()));
+            }
+
+            for (const auto& d : denies)
+                if (trustedRuleMatchesTarget(d, target)) return false;
+            for (const auto& a : allows)
+                if (trustedRuleMatchesTarget(a, target)) return true;
+            return false;
+        }
+
+        // info is copied out per call, as JSON::getProperty does
+        bool isTrustedExecutionContext(const json::object& info, const std::string& page) {
+            const std::string current_page = page;
+            const json::value trusted_rules = info.contains("trusted") ? info.at("trusted") : json::value(nullptr);
+
+            if (isUriLike(current_page)) {
+                if (!trusted_rules.is_array() && !trusted_rules.is_string()) return false;
+                return evaluateRuleList(trusted_rules, current_page);
+            }
+
+            if (!trusted_rules.is_array() && !trusted_rules.is_string()) return true;
+            if (trusted_rules.is_array()) {
+                for (const auto& entry : trusted_rules.as_array()) {
+                    if (!entry.is_string()) continue;
+                    const std::string r = trimAscii(std::string(entry.as_string().c_str()));
+                    if (r.size() > 1 && r[0] == '!') {
+                        if (trustedRuleMatchesTarget(trimAscii(r.substr(1)), current_page))
+                            return false;
+                    }
+                }
+            } else if (trusted_rules.is_string()) {
+                const std::string r = trimAscii(std::string(trusted_rules.as_string().c_str()));
+                if (r.size() > 1 && r[0] == '!' && trustedRuleMatchesTarget(trimAscii(r.substr(1)), current_page))
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    std::string callTranscoded(const std::function<json::value(const json::value&)>& fn, const std::string& req) {
+        const json::storage_ptr arena = Transcoder::makeArena(req.size());
+        return Transcoder::encode(fn(Transcoder::decode(req, arena)));
+    }
+
+    std::string roundTripTranscoded(const json::value& value, size_t* wire_bytes = nullptr) {
+        const std::string wire = Transcoder::encode(value);
+        if (wire_bytes) *wire_bytes = wire.size();
+        const json::storage_ptr arena = Transcoder::makeArena(wire.size());
+        const json::string& decoded = Transcoder::decode(wire, arena).as_string();
+        return std::string(decoded.data(), decoded.size());
+    }
+
+    struct Case {
+        std::string name;
+        std::string description;
+        std::string request;
+        std::function<json::value(const json::value&)> callback;
+    };
+
+    std::string wire(const json::value& v) {
+        return json::serialize(Legacy::formatOutput(v));
+    }
+
+    std::string text(size_t bytes) {
+        std::string out;
+        out.reserve(bytes);
+        while (out.size() < bytes) out += "The quick brown fox jumps over the lazy dog. ";
+        out.resize(bytes);
+        return out;
+    }
+
+    std::string binary(size_t bytes) {
+        std::string out(bytes, '\0');
+        for (size_t i = 0; i < bytes; i++) out[i] = static_cast<char>((i * 131 + 7) & 0xFF);
+        return out;
+    }
+
+    std::vector<Case> makeCases() {
+        const std::string file_text = text(16 * 1024);
+        const std::string file_bytes = binary(16 * 1024);
+
+        json::object state;
+        for (int i = 0; i < 40; i++) {
+            json::object window;
+            window["title"] = "Window " + std::to_string(i);
+            window["size"] = json::object{{"width", 800 + i}, {"height", 600 + i}};
+            window["flags"] = json::array{true, false, i % 2 == 0};
+            window["path"] = "/home/user/.config/renweb/" + std::to_string(i) + ".json";
+            state["window_" + std::to_string(i)] = std::move(window);
+        }
+
+        json::array rows;
+        for (int i = 0; i < 1000; i++) {
+            rows.push_back(json::array{i, "row " + std::to_string(i), i * 0.5});
+        }
+
+        return {
+            {"write_file", "path + options in, bool out (typical fs call)",
+                wire(json::array{"/home/user/notes/today.txt", json::object{{"append", true}}}),
+                [](const json::value&) -> json::value { return true; }},
+            {"read_file", "path in, 16 KiB UTF-8 string out",
+                wire(json::array{"/home/user/notes/today.txt"}),
+                [file_text](const json::value&) -> json::value { return json::string(file_text); }},
+            {"read_binary", "path in, 16 KiB binary string out (base64)",
+                wire(json::array{"/home/user/image.png"}),
+                [file_bytes](const json::value&) -> json::value { return json::string(file_bytes); }},
+            {"write_binary", "16 KiB base64 payload in, bool out",
+                wire(json::array{"/home/user/image.png", json::string(file_bytes)}),
+                [](const json::value&) -> json::value { return true; }},
+            {"echo_state", "40 nested window objects in and echoed back (setState/getState)",
+                wire(json::array{state}),
+                [](const json::value& args) -> json::value { return args; }},
+            {"echo_rows", "1000 mixed rows in and echoed back",
+                wire(json::array{rows}),
+                [](const json::value& args) -> json::value { return args; }},
+        };
+    }
+
+    // Argument extraction only: the request is already decoded, and both
+    // callbacks fold what they extracted into a number so the work can't be skipped
+    struct ArgCase {
+        std::string name;
+        std::string description;
+        json::value request;
+        std::function<json::value(const json::value&)> hand_written;
+        std::function<json::value(const json::value&)> typed;
+    };
+
+    struct WriteOpts {
+        bool append = false;
+        static auto fields() { return std::make_tuple(RenWeb::BindingArgs::field("append", &WriteOpts::append)); }
+    };
+    struct SpawnOpts {
+        bool is_detachable = false;
+        bool share_stdio = false;
+        bool include_orig_args = false;
+        static auto fields() {
+            return std::make_tuple(
+                RenWeb::BindingArgs::field("is_detachable", &SpawnOpts::is_detachable),
+                RenWeb::BindingArgs::field("share_stdio", &SpawnOpts::share_stdio),
+                RenWeb::BindingArgs::field("include_orig_args", &SpawnOpts::include_orig_args));
+        }
+    };
+
+    std::vector<ArgCase> makeArgCases() {
+        using CM = RenWeb::CallbackManager<std::string, json::value, const json::value&>;
+        CM typed;
+        typed.add<size_t(std::filesystem::path, std::string_view, WriteOpts)>("write_file",
+            [](std::filesystem::path path, std::string_view contents, WriteOpts opts) -> size_t {
+                return path.native().size() + contents.size() + opts.append;
+        })->add<size_t(std::vector<std::string>, std::vector<std::string>, SpawnOpts)>("create_window",
+            [](std::vector<std::string> pages, std::vector<std::string> args, SpawnOpts opts) -> size_t {
+                return pages.size() + args.size() + opts.is_detachable + opts.share_stdio + opts.include_orig_args;
+        })->add<size_t(int32_t, std::optional<int32_t>)>("kill_process",
+            [](int32_t pid, std::optional<int32_t> signal) -> size_t {
+                return static_cast<size_t>(pid) + static_cast<size_t>(signal.value_or(2));
+        });
+
+        return {
+            {"write_file", "path, 4 KiB contents, { append }",
+                json::array{"/home/user/notes/today.txt", json::string(text(4 * 1024)), json::object{{"append", true}}},
+                [](const json::value& req) -> json::value {
+                    json::array params = req.as_array();
+                    std::filesystem::path path(params[0].as_string().c_str());
+                    std::string contents(params[1].as_string().c_str());
+                    bool append = params[2].as_object().at("append").as_bool();
+                    return path.native().size() + contents.size() + append;
+                },
+                typed.getMap().at("write_file")},
+            {"create_window", "3 pages, 4 args, 3 option flags",
+                json::array{
+                    json::array{"main", "settings", "about"},
+                    json::array{"--log-level", "2", "--port", "8080"},
+                    json::object{{"is_detachable", true}, {"share_stdio", false}, {"include_orig_args", true}}},
+                [](const json::value& req) -> json::value {
+                    json::array params = req.as_array();
+                    std::vector<std::string> pages;
+                    for (const auto& page : params[0].as_array()) {
+                        pages.push_back(page.as_string().c_str());
+                    }
+                    std::vector<std::string> args;
+                    for (const auto& page : params[1].as_array()) {
+                        args.push_back(page.as_string().c_str());
+                    }
+                    bool is_detachable = params[2].as_object().at("is_detachable").as_bool();
+                    bool share_stdio = params[2].as_object().at("share_stdio").as_bool();
+                    bool include_orig_args = params[2].as_object().at("include_orig_args").as_bool();
+                    return pages.size() + args.size() + is_detachable + share_stdio + include_orig_args;
+                },
+                typed.getMap().at("create_window")},
+            {"kill_process", "pid, signal",
+                json::array{4242, 15},
+                [](const json::value& req) -> json::value {
+                    json::array params = req.as_array();
+                    int32_t pid = static_cast<int32_t>(params[0].as_int64());
+                    int32_t signal = (params[1].is_int64()) ? static_cast<int32_t>(params[1].as_int64()) : 2;
+                    return static_cast<size_t>(pid) + static_cast<size_t>(signal);
+                },
+                typed.getMap().at("kill_process")},
+        };
+    }
+
+    // Large payloads get fewer calls so every size moves about the same number of bytes
+    static constexpr size_t PAYLOAD_BYTES_PER_PATH = 256 * 1024 * 1024;
+    static constexpr size_t MIN_PAYLOAD_ITERATIONS = 3;
+
+    struct PayloadCase {
+        std::string name;
+        std::string description;
+        size_t bytes;
+        bool is_binary;
+    };
+
+    std::vector<PayloadCase> makePayloadCases(size_t max_size) {
+        const std::vector<std::pair<std::string, size_t>> sizes = {
+            {"1K", 1024},
+            {"64K", 64 * 1024},
+            {"1M", 1024 * 1024},
+            {"16M", 16 * 1024 * 1024},
+            {"64M", 64 * 1024 * 1024},
+        };
+        std::vector<PayloadCase> cases;
+        for (const auto& [label, bytes] : sizes) {
+            if (bytes > max_size) continue;
+            cases.push_back({"text_" + label, label + " UTF-8 string round trip", bytes, false});
+            cases.push_back({"binary_" + label, label + " binary string round trip (base64)", bytes, true});
+        }
+        return cases;
+    }
+
+    // Mirrors WindowFunctions::isTrustedExecutionContext: rules compiled on
+    // first use, verdict cached against the page it was computed for
+    struct TrustCheck {
+        std::optional<TrustRules> trusted_rules;
+        std::optional<std::pair<std::string, bool>> trust_verdict;
+
+        bool operator()(const json::object& info, const std::string& current_page) {
+            if (this->trust_verdict.has_value() && this->trust_verdict->first == current_page) {
+                return this->trust_verdict->second;
+            }
+            if (!this->trusted_rules.has_value()) {
+                this->trusted_rules = TrustRules::compile(info.contains("trusted") ? info.at("trusted") : json::value(nullptr));
+            }
+            bool trusted;
+            if (TrustRules::isUriLike(current_page)) {
+                trusted = this->trusted_rules->present && this->trusted_rules->allows(current_page);
+            } else {
+                trusted = !this->trusted_rules->present || !this->trusted_rules->denies(current_page);
+            }
+            this->trust_verdict = std::make_pair(current_page, trusted);
+            return trusted;
+        }
+    };
+
+    struct TrustCase {
+        std::string name;
+        std::string description;
+        json::object info;
+        std::string page;
+    };
+
+    std::vector<TrustCase> makeTrustCases() {
+        const json::array rules{
+            "main", "settings", "about", " !debug ",
+            "https://app.example.com", "cdn.example.org", "!https://ads.example.com", "!tracker.example.net"};
+        return {
+            {"local_page", "local page against 8 trusted rules (deny scan)",
+                json::object{{"trusted", rules}}, "main"},
+            {"remote_page", "remote URL against 8 trusted rules (allow match)",
+                json::object{{"trusted", rules}}, "https://app.example.com/dashboard?tab=settings"},
+            {"remote_denied", "remote URL hitting a deny rule",
+                json::object{{"trusted", rules}}, "https://ads.example.com/banner"},
+            {"no_rules", "local page, no trusted property in info.json",
+                json::object{}, "main"},
+        };
+    }
+
+    struct Options {
+        std::filesystem::path out = "bridge.json";
+        size_t iterations = 20000;
+        size_t max_size = 64 * 1024 * 1024;
+        std::vector<std::string> only;
+    };
+
+    // op runs one call and returns the size of what it produced
+    json::object measure(const std::function<size_t()>& op, size_t iterations) {
+        for (size_t i = 0; i < std::min<size_t>(iterations / 10, 1000); i++) {
+            op();
+        }
+        std::vector<uint64_t> samples;
+        samples.reserve(iterations);
+        size_t response_bytes = 0;
+        const uint64_t allocs_before = allocations.load();
+        const uint64_t bytes_before = allocated_bytes.load();
+        for (size_t i = 0; i < iterations; i++) {
+            const auto start = Clock::now();
+            response_bytes = op();
+            samples.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+        }
+        // The sample vector was reserved up front, so everything counted here is the bridge
+        const double allocs = double(allocations.load() - allocs_before) / double(iterations);
+        const double bytes = double(allocated_bytes.load() - bytes_before) / double(iterations);
+        std::sort(samples.begin(), samples.end());
+        uint64_t sum = 0;
+        for (uint64_t s : samples) sum += s;
+        auto quantile = [&](double q) -> uint64_t {
+            return samples[std::min(samples.size() - 1, static_cast<size_t>(q * double(samples.size())))];
+        };
+        return json::object{
+            {"allocs_per_call", allocs},
+            {"bytes_per_call", bytes},
+            {"response_bytes", response_bytes},
+            {"latency_ns", json::object{
+                {"mean", sum / samples.size()},
+                {"p50", quantile(0.50)},
+                {"p90", quantile(0.90)},
+                {"p99", quantile(0.99)},
+                {"max", samples.back()}
+            }}
+        };
+    }
+
+    size_t currentRss() {
+#if defined(_WIN32)
+        return 0;
+#else
+        struct rusage usage {};
+        getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss);
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+    }
+
+    // Runs job in a forked child and adds its peak RSS to the result. The
+    // child starts with the parent's RSS, so job records its own baseline
+    // (after building its input) as "baseline_rss_bytes". Windows has no
+    // fork, so there the job runs in-process and the RSS fields are null.
+    json::object isolated(const std::function<json::object()>& job) {
+#if defined(_WIN32)
+        json::object result = job();
+        result["peak_rss_bytes"] = nullptr;
+        result["rss_growth_bytes"] = nullptr;
+        return result;
+#else
+        int fds[2];
+        if (pipe(fds) != 0) throw std::runtime_error("pipe() failed");
+        std::fflush(stdout);
+        const pid_t pid = fork();
+        if (pid < 0) throw std::runtime_error("fork() failed");
+        if (pid == 0) {
+            close(fds[0]);
+            int status = 0;
+            try {
+                const std::string body = json::serialize(job());
+                for (size_t written = 0; written < body.size();) {
+                    const ssize_t n = write(fds[1], body.data() + written, body.size() - written);
+                    if (n <= 0) { status = 1; break; }
+                    written += static_cast<size_t>(n);
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "bridge-bench: " << e.what() << std::endl;
+                status = 1;
+            }
+            close(fds[1]);
+            _exit(status);
+        }
+        close(fds[1]);
+        std::string body;
+        char buffer[4096];
+        for (ssize_t n; (n = read(fds[0], buffer, sizeof(buffer))) > 0;) {
+            body.append(buffer, static_cast<size_t>(n));
+        }
+        close(fds[0]);
+        int status = 0;
+        struct rusage usage {};
+        wait4(pid, &status, 0, &usage);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || body.empty()) {
+            throw std::runtime_error("benchmark child exited abnormally");
+        }
+        json::object result = json::parse(body).as_object();
+#if defined(__APPLE__)
+        const size_t peak = static_cast<size_t>(usage.ru_maxrss);
+#else
+        const size_t peak = static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+        const size_t baseline = static_cast<size_t>(result.at("baseline_rss_bytes").to_number<uint64_t>());
+        result["peak_rss_bytes"] = peak;
+        result["rss_growth_bytes"] = peak > baseline ? peak - baseline : 0;
+        return result;
+#endif
+    }
+
+    Options parseArgs(int argc, char** argv) {
+        Options opts;
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--out") {
+                opts.out = next();
+            } else if (arg == "--iterations") {
+                opts.iterations = std::max<size_t>(10, std::stoul(next()));
+            } else if (arg == "--max-size") {
+                // Accepts a plain byte count or a K/M suffix (1024-based)
+                const std::string value = next();
+                size_t end = 0;
+                size_t size = std::stoul(value, &end);
+                if (end < value.size() && (value[end] == 'K' || value[end] == 'k')) size *= 1024;
+                if (end < value.size() && (value[end] == 'M' || value[end] == 'm')) size *= 1024 * 1024;
+                opts.max_size = size;
+            } else if (arg == "--only") {
+                std::string list = next();
+                for (size_t start = 0; start <= list.size();) {
+                    const size_t comma = std::min(list.find(',', start), list.size());
+                    if (comma > start) opts.only.push_back(list.substr(start, comma - start));
+                    start = comma + 1;
+                }
+            } else {
+                throw std::runtime_error("Unknown argument " + arg);
+            }
+        }
+        return opts;
+    }
+
+    std::string timestamp() {
+        const std::time_t now = std::time(nullptr);
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        return buffer;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opts;
+    try {
+        opts = parseArgs(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+    std::cout << "bridge-bench: " << opts.iterations << " calls per path" << std::endl;
+
+    json::object results;
+    bool mismatch = false;
+    for (const auto& c : makeCases()) {
+        if (!opts.only.empty() && std::find(opts.only.begin(), opts.only.end(), c.name) == opts.only.end()) continue;
+        const bool match = json::parse(Legacy::call(c.callback, c.request)) == json::parse(callTranscoded(c.callback, c.request));
+        mismatch = mismatch || !match;
+        json::object legacy = measure([&]() { return Legacy::call(c.callback, c.request).size(); }, opts.iterations);
+        json::object transcoded = measure([&]() { return callTranscoded(c.callback, c.request).size(); }, opts.iterations);
+        for (const auto& [label, result] : {std::make_pair("legacy", &legacy), std::make_pair("transcoder", &transcoded)}) {
+            const json::object& latency = result->at("latency_ns").as_object();
+            std::printf("  %-13s %-10s p50 %8llu ns   p99 %8llu ns   %7.1f allocs %10.0f B/call%s\n",
+                c.name.c_str(), label,
+                static_cast<unsigned long long>(latency.at("p50").to_number<uint64_t>()),
+                static_cast<unsigned long long>(latency.at("p99").to_number<uint64_t>()),
+                result->at("allocs_per_call").as_double(),
+                result->at("bytes_per_call").as_double(),
+                match ? "" : "   OUTPUT MISMATCH");
+        }
+        std::fflush(stdout);
+        results[c.name] = json::object{
+            {"description", c.description},
+            {"request_bytes", c.request.size()},
+            {"outputs_match", match},
+            {"legacy", std::move(legacy)},
+            {"transcoder", std::move(transcoded)}
+        };
+    }
+
+    json::object arg_results;
+    for (const auto& c : makeArgCases()) {
+        if (!opts.only.empty() && std::find(opts.only.begin(), opts.only.end(), c.name) == opts.only.end()) continue;
+        const bool match = c.hand_written(c.request) == c.typed(c.request);
+        mismatch = mismatch || !match;
+        json::object hand_written = measure([&]() { return static_cast<size_t>(c.hand_written(c.request).to_number<uint64_t>()); }, opts.iterations);
+        json::object typed = measure([&]() { return static_cast<size_t>(c.typed(c.request).to_number<uint64_t>()); }, opts.iterations);
+        for (const auto& [label, result] : {std::make_pair("hand", &hand_written), std::make_pair("typed", &typed)}) {
+            const json::object& latency = result->at("latency_ns").as_object();
+            std::printf("  args:%-8s %-10s p50 %8llu ns   p99 %8llu ns   %7.1f allocs %10.0f B/call%s\n",
+                c.name.c_str(), label,
+                static_cast<unsigned long long>(latency.at("p50").to_number<uint64_t>()),
+                static_cast<unsigned long long>(latency.at("p99").to_number<uint64_t>()),
+                result->at("allocs_per_call").as_double(),
+                result->at("bytes_per_call").as_double(),
+                match ? "" : "   OUTPUT MISMATCH");
+        }
+        std::fflush(stdout);
+        arg_results[c.name] = json::object{
+            {"description", c.description},
+            {"outputs_match", match},
+            {"hand_written", std::move(hand_written)},
+            {"typed", std::move(typed)}
+        };
+    }
+
+    json::object trust_results;
+    {
+        // Stands in for a cheap binding such as BIND_log_info; the trust check is the variable
+        const std::string request = wire(json::array{"/home/user/notes/today.txt"});
+        const std::function<json::value(const json::value&)> callback = [](const json::value&) -> json::value { return true; };
+        for (const auto& c : makeTrustCases()) {
+            if (!opts.only.empty() && std::find(opts.only.begin(), opts.only.end(), c.name) == opts.only.end()) continue;
+            const bool expected = Legacy::isTrustedExecutionContext(c.info, c.page);
+            const bool match = TrustCheck{}(c.info, c.page) == expected;
+            mismatch = mismatch || !match;
+            auto call = [&](bool trusted) -> size_t {
+                return trusted ? callTranscoded(callback, request).size() : 0;
+            };
+            json::object legacy = measure([&]() {
+                return call(Legacy::isTrustedExecutionContext(c.info, c.page));
+            }, opts.iterations);
+            // A fresh TrustCheck per call: rules compiled and the verdict computed, as on the first call after a navigation
+            json::object compiled = measure([&]() {
+                return call(TrustCheck{}(c.info, c.page));
+            }, opts.iterations);
+            TrustCheck check;
+            json::object cached = measure([&]() {
+                return call(check(c.info, c.page));
+            }, opts.iterations);
+            for (const auto& [label, result] : {
+                    std::make_pair("legacy", &legacy),
+                    std::make_pair("compiled", &compiled),
+                    std::make_pair("cached", &cached)}) {
+                const json::object& latency = result->at("latency_ns").as_object();
+                std::printf("  trust:%-13s %-10s p50 %8llu ns   p99 %8llu ns   %7.1f allocs %10.0f B/call%s\n",
+                    c.name.c_str(), label,
+                    static_cast<unsigned long long>(latency.at("p50").to_number<uint64_t>()),
+                    static_cast<unsigned long long>(latency.at("p99").to_number<uint64_t>()),
+                    result->at("allocs_per_call").as_double(),
+                    result->at("bytes_per_call").as_double(),
+                    match ? "" : "   VERDICT MISMATCH");
+            }
+            std::fflush(stdout);
+            trust_results[c.name] = json::object{
+                {"description", c.description},
+                {"page", c.page},
+                {"trusted", expected},
+                {"verdicts_match", match},
+                {"legacy", std::move(legacy)},
+                {"compiled", std::move(compiled)},
+                {"cached", std::move(cached)}
+            };
+        }
+    }
+
+    json::object payload_results;
+    for (const auto& c : makePayloadCases(opts.max_size)) {
+        if (!opts.only.empty() && std::find(opts.only.begin(), opts.only.end(), c.name) == opts.only.end()) continue;
+        const size_t iterations = std::clamp(PAYLOAD_BYTES_PER_PATH / c.bytes, MIN_PAYLOAD_ITERATIONS, opts.iterations);
+        json::object paths;
+        bool match = true;
+        for (const auto& [label, round_trip] : {
+                std::make_pair("legacy", &Legacy::roundTrip),
+                std::make_pair("transcoder", &roundTripTranscoded)}) {
+            const auto fn = round_trip;
+            json::object result;
+            try {
+                result = isolated([&c, fn, iterations]() -> json::object {
+                    const std::string payload = c.is_binary ? binary(c.bytes) : text(c.bytes);
+                    const json::value value = json::string(payload);
+                    const size_t baseline = currentRss();
+                    size_t wire_bytes = 0;
+                    const bool same = fn(value, &wire_bytes) == payload;
+                    json::object measured = measure([&]() { return fn(value, nullptr).size(); }, iterations);
+                    measured["baseline_rss_bytes"] = baseline;
+                    measured["wire_bytes"] = wire_bytes;
+                    measured["outputs_match"] = same;
+                    return measured;
+                });
+            } catch (const std::exception& e) {
+                std::cerr << "bridge-bench: " << c.name << " " << label << ": " << e.what() << std::endl;
+                mismatch = true;
+                continue;
+            }
+            match = match && result.at("outputs_match").as_bool();
+            const json::object& latency = result.at("latency_ns").as_object();
+            const double p50_ms = latency.at("p50").to_number<double>() / 1e6;
+            std::printf("  payload:%-10s %-10s p50 %10.3f ms   %8.1f MB/s   wire %10.1f KiB",
+                c.name.c_str(), label, p50_ms,
+                p50_ms > 0 ? (double(c.bytes) / 1e6) / (p50_ms / 1e3) : 0.0,
+                result.at("wire_bytes").to_number<double>() / 1024.0);
+            if (result.at("peak_rss_bytes").is_null()) {
+                std::printf("%s\n", match ? "" : "   OUTPUT MISMATCH");
+            } else {
+                std::printf("   peak RSS %8.1f MiB (+%.1f)%s\n",
+                    result.at("peak_rss_bytes").to_number<double>() / (1024.0 * 1024.0),
+                    result.at("rss_growth_bytes").to_number<double>() / (1024.0 * 1024.0),
+                    match ? "" : "   OUTPUT MISMATCH");
+            }
+            paths[label] = std::move(result);
+        }
+        std::fflush(stdout);
+        mismatch = mismatch || !match;
+        paths["description"] = c.description;
+        paths["payload_bytes"] = c.bytes;
+        paths["iterations"] = iterations;
+        paths["outputs_match"] = match;
+        payload_results[c.name] = std::move(paths);
+    }
+
+    json::object report{
+        {"timestamp", timestamp()},
+        {"iterations", opts.iterations},
+        {"cases", std::move(results)},
+        {"arguments", std::move(arg_results)},
+        {"trust", std::move(trust_results)},
+        {"payloads", std::move(payload_results)}
+    };
+    if (!opts.out.parent_path().empty()) {
+        std::filesystem::create_directories(opts.out.parent_path());
+    }
+    std::ofstream out(opts.out, std::ios::trunc);
+    out << json::serialize(report) << std::endl;
+    std::cout << "bridge-bench: wrote " << opts.out.string() << std::endl;
+    return mismatch ? 1 : 0;
+}
@@ -0,0 +1,786 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+// Standalone load generator for RenWeb::WebServer (`make bench`).
+//
+// Builds a synthetic asset tree next to the binary, starts the real web server
+// behind a stub webview and process manager, and drives it from keep-alive
+// clients on several threads. Each scenario reports requests/s, MB/s and
+// latency percentiles; everything is also written to a JSON file so runs can
+// be diffed.
+//
+// file_backends reruns the file scenarios on a fresh server with the asset
+// cache off, once serving from mmap and once through read(), and reports CPU
+// seconds per GiB next to throughput. The process CPU clock includes the
+// in-process clients, which do the same work for both backends.
+//
+// startup times a cold server (App build, start, then index + every asset of
+// a 120-asset page over 6 connections, like a browser's first paint) with the
+// content served loose and from an app.rwpack written the way `rw build
+// --pack` writes it. The OS page cache stays warm between runs, so this
+// measures the engine's own per-asset directory search and stat work.
+//
+// mime_lookup is an in-process micro-benchmark rather than an HTTP scenario:
+// it times WebServer::getMimeType against the std::map lookup it replaced.
+//
+//   web-server-bench [--out results.json] [--threads 8] [--duration 3]
+//                    [--warmup 0.5] [--only name,name] [--server '{"workers":16}']
+#include "../include/app.hpp"
+#include "../include/asset_pack.hpp"
+#include "../include/config.hpp"
+#include "../include/file.hpp"
+#include "../include/json.hpp"
+#include "../include/locate.hpp"
+#include "../include/request_metrics.hpp"
+#include "../include/web_server.hpp"
+#include "../include/interfaces/Ilogger.hpp"
+#include "../include/interfaces/Iprocess_manager.hpp"
+#include "../include/interfaces/Iwebview.hpp"
+#include <boost/json.hpp>
+#include <boost/json/serialize.hpp>
+#include <httplib.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <sys/resource.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace json = boost::json;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+    constexpr const char* PAGE = "bench";
+    constexpr size_t SMALL_FILES = 64;
+    constexpr size_t SMALL_FILE_BYTES = 2 * 1024;
+    constexpr size_t LARGE_FILE_BYTES = 8 * 1024 * 1024;
+    constexpr size_t RANGE_BYTES = 64 * 1024;
+    constexpr size_t STARTUP_ASSETS = 120;
+    constexpr size_t STARTUP_CONNECTIONS = 6;
+    constexpr size_t STARTUP_RUNS = 5;
+    constexpr const char* STARTUP_KINDS[] = {"css", "js", "png", "svg", "woff2"};
+
+    class QuietLogger : public RenWeb::ILogger {
+        public:
+            explicit QuietLogger(bool verbose) : verbose(verbose) { }
+            void trace(const std::string&) override { }
+            void debug(const std::string&) override { }
+            void info(const std::string& msg) override { this->print("info", msg); }
+            void warn(const std::string& msg) override { this->print("warn", msg); }
+            void error(const std::string& msg) override { this->print("error", msg); }
+            void critical(const std::string& msg) override { std::cerr << "[critical] " << msg << std::endl; }
+            void refresh(std::map<std::string, std::string>) override { }
+        private:
+            const bool verbose;
+            void print(const char* level, const std::string& msg) {
+                if (this->verbose) std::cerr << "[" << level << "] " << msg << std::endl;
+            }
+    };
+
+    // Drops everything the server would run on the UI thread, but counts it
+    class StubWebview : public RenWeb::IWebview {
+        public:
+            std::atomic<uint64_t> dispatched{0};
+            void run() override { }
+            void terminate() override { }
+            void navigate(const std::string&) override { }
+            void bind(const std::string&, std::function<std::string(std::string)>) override { }
+            void bind_async(const std::string&, std::function<void(std::string, std::string)>) override { }
+            void resolve(const std::string&, int, const std::string&) override { }
+            void unbind(const std::string&) override { }
+            void dispatch(std::function<void()>) override { this->dispatched.fetch_add(1, std::memory_order_relaxed); }
+            void set_title(const std::string&) override { }
+            void set_size(int64_t, int64_t) override { }
+            void set_html(const std::string&) override { }
+            void eval(const std::string&) override { }
+            void queue_eval(std::string) override { this->dispatched.fetch_add(1, std::memory_order_relaxed); }
+            json::object get_eval_stats() override { return json::object{}; }
+            void init(const std::string&) override { }
+            std::optional<void*> window() override { return std::nullopt; }
+            std::optional<void*> widget() override { return std::nullopt; }
+            void set_event_frame_interval(std::chrono::microseconds) override { }
+            void set_event_throttle(const std::string&, std::chrono::milliseconds) override { }
+            json::object get_event_stats() override { return json::object{}; }
+        #if defined(_WIN32)
+            std::optional<void*> get_controller() override { return std::nullopt; }
+            void register_navigation_handler(std::function<bool(const std::string&)>) override { }
+        #endif
+    };
+
+    // Answers ??q= with a fixed record instead of walking /proc
+    class StubProcessManager : public RenWeb::IProcessManager {
+        public:
+            json::object dumpProcess(Pid pid) const override { return pid == this->getPid() ? this->dumpCurrentProcess() : json::object{}; }
+            json::object dumpCurrentProcess() const override {
+                return json::object{
+                    {"pid", this->getPid()},
+                    {"name", "web-server-bench"},
+                    {"renweb", true},
+                    {"page", PAGE}
+                };
+            }
+            json::array dumpSystemProcesses() const override { return json::array(); }
+            json::array dumpRenWebProcesses() const override { return json::array{this->dumpCurrentProcess()}; }
+            json::array dumpChildProcesses() const override { return json::array(); }
+            json::object createSystemProcess(const std::vector<std::string>&, bool, bool) override { return json::object{}; }
+            json::object createRenWebProcess(const std::vector<std::string>&, std::vector<std::string>, bool, bool, bool) override { return json::object{}; }
+            Pid getPid() const override {
+            #if defined(_WIN32)
+                return static_cast<Pid>(GetCurrentProcessId());
+            #else
+                return static_cast<Pid>(getpid());
+            #endif
+            }
+            void kill(Pid, int32_t) override { }
+            void detach(Pid) override { }
+            void send(Pid, const json::value&) override { }
+            std::vector<std::string> listen(Pid, int64_t, bool) const override { return {}; }
+            void wait(Pid) override { }
+            void waitAll() override { }
+            bool waitFor(Pid, std::chrono::milliseconds) override { return true; }
+            bool waitAllFor(std::chrono::milliseconds) override { return true; }
+            void registerProcess() const override { }
+            void stopPeerDiscovery() override { }
+            json::object getDiscoveryStats() const override { return json::object{}; }
+    };
+
+    struct Options {
+        std::filesystem::path out;
+        size_t threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 8);
+        double duration_s = 3.0;
+        double warmup_s = 0.5;
+        std::vector<std::string> only;
+        json::object server;
+        bool verbose = false;
+    };
+
+    struct Scenario {
+        std::string name;
+        std::string description;
+        // Empty means the TCP URL; "unix:<path>" targets the IPC socket
+        std::string address;
+        int expected_status;
+        std::function<httplib::Result(httplib::Client&, uint64_t i)> request;
+    };
+
+    // Scenarios rerun per file backend, with the asset cache disabled
+    static constexpr const char* FILE_BACKEND_SCENARIOS[] = {"small_files", "large_file", "range"};
+
+    struct Totals {
+        uint64_t requests = 0;
+        uint64_t errors = 0;
+        uint64_t bytes = 0;
+    };
+
+    void writeFile(const std::filesystem::path& path, const std::string& data) {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    // Deterministic filler so compressible and incompressible content both show up
+    std::string filler(size_t bytes, uint32_t seed) {
+        std::string data(bytes, '\0');
+        uint32_t x = seed * 2654435761u + 1;
+        for (size_t i = 0; i < bytes; i++) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            data[i] = static_cast<char>('a' + (x % 26));
+        }
+        return data;
+    }
+
+    std::string startupAsset(size_t i) {
+        return "/startup/" + std::to_string(i) + "." + STARTUP_KINDS[i % std::size(STARTUP_KINDS)];
+    }
+
+    void writeAssetTree(const std::filesystem::path& base, const json::object& server) {
+        const std::filesystem::path page_dir = base / "content" / PAGE;
+        std::filesystem::remove_all(page_dir);
+        writeFile(page_dir / "index.html", "<!doctype html><title>bench</title><p>bench</p>");
+        for (size_t i = 0; i < SMALL_FILES; i++) {
+            writeFile(page_dir / "small" / (std::to_string(i) + ".css"), filler(SMALL_FILE_BYTES, static_cast<uint32_t>(i)));
+        }
+        std::string large(LARGE_FILE_BYTES, '\0');
+        for (size_t i = 0; i < LARGE_FILE_BYTES; i++) {
+            large[i] = static_cast<char>((i * 131 + (i >> 12)) & 0xff);
+        }
+        writeFile(page_dir / "large.bin", large);
+
+        // A page shaped like a typical app shell for the startup step
+        std::string startup_html = "<!doctype html><title>startup</title>\n";
+        for (size_t i = 0; i < STARTUP_ASSETS; i++) {
+            const std::string name = startupAsset(i);
+            writeFile(page_dir / name.substr(1), filler(1024 + (i * 977) % (15 * 1024), static_cast<uint32_t>(1000 + i)));
+            startup_html += "<link rel=\"preload\" href=\"" + name + "\">\n";
+        }
+        writeFile(page_dir / "startup.html", startup_html);
+
+        json::object info{{"title", "web-server-bench"}, {"version", "0.0.0"}, {"port", 0}};
+        info["server"] = server;
+        writeFile(base / "bench-info.json", json::serialize(info));
+        writeFile(base / "bench-config.json", json::serialize(json::object{
+            {"__defaults__", json::object{}},
+            {PAGE, json::object{{"title", "bench"}}}
+        }));
+    }
+
+    // User + system CPU of the whole process, clients included
+    double processCpuSeconds() {
+    #if defined(_WIN32)
+        FILETIME created, exited, kernel, user;
+        if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) return 0.0;
+        auto seconds = [](const FILETIME& ft) {
+            return static_cast<double>((static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) / 1e7;
+        };
+        return seconds(kernel) + seconds(user);
+    #else
+        struct rusage usage {};
+        getrusage(RUSAGE_SELF, &usage);
+        auto seconds = [](const timeval& tv) {
+            return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1e6;
+        };
+        return seconds(usage.ru_utime) + seconds(usage.ru_stime);
+    #endif
+    }
+
+    // Same layout as writeAssetPack in cli/shared/assets.js (see include/asset_pack.hpp)
+    void writeAssetPack(const std::filesystem::path& base) {
+        struct PackFile {
+            std::filesystem::path abs;
+            std::string name;
+            uint64_t hash;
+            uint64_t size;
+            int64_t mtime_ns;
+            uint32_t path_offset = 0;
+            uint64_t data_offset = 0;
+        };
+        std::vector<PackFile> files;
+        for (const char* dir : {"content", "backup", "assets"}) {
+            if (!std::filesystem::is_directory(base / dir)) continue;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(base / dir)) {
+                if (!entry.is_regular_file()) continue;
+                const std::string name = std::filesystem::relative(entry.path(), base).generic_string();
+                const auto mtime = std::chrono::time_point_cast<std::chrono::nanoseconds>(
+                    entry.last_write_time() - std::filesystem::file_time_type::clock::now() + std::chrono::system_clock::now());
+                files.push_back({entry.path(), name, RenWeb::AssetPack::hash(name), entry.file_size(),
+                    static_cast<int64_t>(mtime.time_since_epoch().count())});
+            }
+        }
+        std::sort(files.begin(), files.end(), [](const PackFile& a, const PackFile& b) {
+            return std::tie(a.hash, a.name) < std::tie(b.hash, b.name);
+        });
+        constexpr uint64_t ALIGN = 64;
+        const uint64_t index_end = RenWeb::AssetPack::HEADER_SIZE + files.size() * RenWeb::AssetPack::ENTRY_SIZE;
+        uint64_t strings_size = 0;
+        for (auto& f : files) {
+            f.path_offset = static_cast<uint32_t>(strings_size);
+            strings_size += f.name.size();
+        }
+        uint64_t offset = index_end + strings_size;
+        for (auto& f : files) {
+            offset = (offset + ALIGN - 1) / ALIGN * ALIGN;
+            f.data_offset = offset;
+            offset += f.size;
+        }
+
+        std::string pack;
+        pack.reserve(static_cast<size_t>(offset));
+        auto put = [&pack](uint64_t value, size_t bytes) {
+            for (size_t i = 0; i < bytes; i++) pack.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+        };
+        pack.append(RenWeb::AssetPack::MAGIC, 8);
+        put(RenWeb::AssetPack::VERSION, 4);
+        put(files.size(), 4);
+        put(index_end, 8);
+        put(strings_size, 8);
+        for (const auto& f : files) {
+            put(f.hash, 8);
+            put(f.path_offset, 4);
+            put(f.name.size(), 4);
+            put(f.data_offset, 8);
+            put(f.size, 8);
+            put(static_cast<uint64_t>(f.mtime_ns), 8);
+        }
+        for (const auto& f : files) pack += f.name;
+        for (const auto& f : files) {
+            pack.resize(static_cast<size_t>(f.data_offset), '\0');
+            std::ifstream in(f.abs, std::ios::binary);
+            pack.append(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        writeFile(base / "app.rwpack", pack);
+    }
+
+    std::unique_ptr<RenWeb::App> makeApp(const std::filesystem::path& base, std::shared_ptr<RenWeb::ILogger> logger, std::unique_ptr<StubWebview> webview, int argc, char** argv) {
+        const std::map<std::string, std::string> builder_opts = {{"page", PAGE}};
+        return RenWeb::AppBuilder(builder_opts, argc, argv)
+            .withLogger(logger)
+            .withInfo(std::make_unique<RenWeb::JSON>(logger, std::make_shared<RenWeb::File>(base / "bench-info.json")))
+            .withConfig(std::make_unique<RenWeb::Config>(logger, PAGE, std::make_shared<RenWeb::File>(base / "bench-config.json")))
+            .withProcessManager(std::make_unique<StubProcessManager>())
+            .withWebview(std::move(webview))
+            .build();
+    }
+
+    std::unique_ptr<httplib::Client> makeClient(const std::string& url, const std::string& address) {
+        std::unique_ptr<httplib::Client> client;
+        if (address.rfind("unix:", 0) == 0) {
+            client = std::make_unique<httplib::Client>(address.substr(5), 80);
+        #if !defined(_WIN32)
+            client->set_address_family(AF_UNIX);
+        #endif
+        } else {
+            client = std::make_unique<httplib::Client>(url);
+        }
+        client->set_keep_alive(true);
+        client->set_connection_timeout(5, 0);
+        client->set_read_timeout(10, 0);
+        client->set_write_timeout(10, 0);
+        return client;
+    }
+
+    json::object runScenario(const Scenario& scenario, const std::string& url, const Options& opts) {
+        RenWeb::LatencyHistogram latency;
+        std::vector<Totals> totals(opts.threads);
+        std::atomic<bool> measuring{false};
+        std::atomic<bool> done{false};
+
+        std::vector<std::thread> workers;
+        workers.reserve(opts.threads);
+        for (size_t t = 0; t < opts.threads; t++) {
+            workers.emplace_back([&, t]() {
+                auto client = makeClient(url, scenario.address);
+                Totals& mine = totals[t];
+                uint64_t i = t;
+                while (!done.load(std::memory_order_relaxed)) {
+                    const auto started = Clock::now();
+                    httplib::Result res = scenario.request(*client, i);
+                    const auto elapsed = Clock::now() - started;
+                    i += opts.threads;
+                    if (!measuring.load(std::memory_order_relaxed)) continue;
+                    mine.requests++;
+                    if (!res || res->status != scenario.expected_status) {
+                        mine.errors++;
+                        continue;
+                    }
+                    mine.bytes += res->body.size();
+                    latency.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+                }
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::duration<double>(opts.warmup_s));
+        measuring = true;
+        const auto window_start = Clock::now();
+        const double cpu_start = processCpuSeconds();
+        std::this_thread::sleep_for(std::chrono::duration<double>(opts.duration_s));
+        measuring = false;
+        const double cpu_s = processCpuSeconds() - cpu_start;
+        const double seconds = std::chrono::duration<double>(Clock::now() - window_start).count();
+        done = true;
+        for (auto& worker : workers) worker.join();
+
+        Totals sum;
+        for (const auto& t : totals) {
+            sum.requests += t.requests;
+            sum.errors += t.errors;
+            sum.bytes += t.bytes;
+        }
+        const uint64_t ok = latency.getCount();
+        return json::object{
+            {"description", scenario.description},
+            {"transport", scenario.address.empty() ? "tcp" : "unix"},
+            {"expected_status", scenario.expected_status},
+            {"seconds", seconds},
+            {"requests", sum.requests},
+            {"errors", sum.errors},
+            {"requests_per_s", static_cast<double>(sum.requests) / seconds},
+            {"mb_per_s", static_cast<double>(sum.bytes) / seconds / (1024.0 * 1024.0)},
+            {"bytes", sum.bytes},
+            {"cpu_s", cpu_s},
+            {"cpu_s_per_gib", sum.bytes > 0 ? cpu_s / (static_cast<double>(sum.bytes) / (1024.0 * 1024.0 * 1024.0)) : 0.0},
+            {"latency_us", json::object{
+                {"p50", latency.quantile(0.50)},
+                {"p90", latency.quantile(0.90)},
+                {"p99", latency.quantile(0.99)},
+                {"max", latency.getMax()},
+                {"mean", ok > 0 ? static_cast<double>(latency.getSum()) / static_cast<double>(ok) : 0.0}
+            }}
+        };
+    }
+
+    std::vector<Scenario> makeScenarios(const std::string& socket_path) {
+        const std::string message = json::serialize(json::object{
+            {"sender", json::object{{"pid", 0}, {"name", "web-server-bench"}}},
+            {"message", filler(256, 7)}
+        });
+        std::vector<Scenario> scenarios = {
+            {"small_files", std::to_string(SMALL_FILE_BYTES) + " B assets round-robin over " + std::to_string(SMALL_FILES) + " files", "", 200,
+                [](httplib::Client& client, uint64_t i) {
+                    return client.Get("/small/" + std::to_string(i % SMALL_FILES) + ".css", httplib::Headers{{"Accept-Encoding", "identity"}});
+                }},
+            {"large_file", std::to_string(LARGE_FILE_BYTES / (1024 * 1024)) + " MiB binary, whole body", "", 200,
+                [](httplib::Client& client, uint64_t) {
+                    return client.Get("/large.bin");
+                }},
+            {"range", std::to_string(RANGE_BYTES / 1024) + " KiB Range slices of the large file", "", 206,
+                [](httplib::Client& client, uint64_t i) {
+                    const uint64_t slots = LARGE_FILE_BYTES / RANGE_BYTES;
+                    const uint64_t start = ((i * 7919) % slots) * RANGE_BYTES;
+                    return client.Get("/large.bin", httplib::Headers{
+                        {"Range", "bytes=" + std::to_string(start) + "-" + std::to_string(start + RANGE_BYTES - 1)}
+                    });
+                }},
+            {"not_found", "Missing assets (cached 404 path)", "", 404,
+                [](httplib::Client& client, uint64_t i) {
+                    return client.Get("/missing/" + std::to_string(i % 256) + ".js");
+                }},
+            {"ipc_get", "GET /??q= process info over TCP", "", 200,
+                [](httplib::Client& client, uint64_t) {
+                    return client.Get("/??q=");
+                }},
+            {"ipc_post", "POST /??q= 256 B message over TCP", "", 200,
+                [message](httplib::Client& client, uint64_t) {
+                    return client.Post("/??q=", message, "application/json");
+                }}
+        };
+        if (!socket_path.empty()) {
+            scenarios.push_back({"ipc_get_unix", "GET /??q= process info over the Unix socket", "unix:" + socket_path, 200,
+                [](httplib::Client& client, uint64_t) {
+                    return client.Get("/??q=");
+                }});
+            scenarios.push_back({"ipc_post_unix", "POST /??q= 256 B message over the Unix socket", "unix:" + socket_path, 200,
+                [message](httplib::Client& client, uint64_t) {
+                    return client.Post("/??q=", message, "application/json");
+                }});
+        }
+        return scenarios;
+    }
+
+    // The old MIME table: a std::map keyed by the verbatim extension (leading dot, original
+    // case), padded with filler keys to the 1746 entries it had so the tree depth matches
+    static constexpr size_t LEGACY_MIME_ENTRIES = 1746;
+    static constexpr size_t MIME_LOOKUPS = 2000000;
+
+    std::string legacyMimeType(const std::map<std::string, std::string>& mime_types, const std::filesystem::path& file) {
+        auto i = mime_types.find(file.extension().string());
+        if (i == mime_types.end()) {
+            return "application/octet-stream";
+        } else {
+            return i->second;
+        }
+    }
+
+    json::object runMimeLookup(const RenWeb::WebServer& ws) {
+        const std::vector<std::filesystem::path> probes = {
+            "index.html", "app.js", "style.css", "logo.png", "photo.jpg", "font.woff2",
+            "data.json", "module.mjs", "icon.svg", "intro.mp4", "bundle.min.js", "manifest.webmanifest",
+            "PHOTO.JPG", "backup.tar.gz", "clip.ADT", "LICENSE", "notes.zzz"
+        };
+        std::map<std::string, std::string> mime_types;
+        for (const auto& probe : probes) {
+            const std::string ext = probe.extension().string();
+            const std::string_view type = ws.getMimeType("x" + ext);
+            if (ext.empty() || type == "application/octet-stream") continue;
+            if (std::any_of(ext.begin(), ext.end(), [](unsigned char c) { return std::isupper(c); })) continue;
+            mime_types.emplace(ext, std::string(type));
+        }
+        for (size_t i = 0; mime_types.size() < LEGACY_MIME_ENTRIES; i++) {
+            mime_types.emplace(".x" + std::to_string(i), "application/x-filler");
+        }
+
+        // Lookups the old table could not answer: uppercase and compound suffixes
+        size_t legacy_misses = 0;
+        for (const auto& probe : probes) {
+            if (legacyMimeType(mime_types, probe) != ws.getMimeType(probe)) legacy_misses++;
+        }
+
+        size_t sink = 0;
+        auto perLookup = [&](const std::function<size_t(const std::filesystem::path&)>& lookup) -> double {
+            const auto started = Clock::now();
+            for (size_t i = 0; i < MIME_LOOKUPS; i++) {
+                sink += lookup(probes[i % probes.size()]);
+            }
+            return std::chrono::duration<double, std::nano>(Clock::now() - started).count() / double(MIME_LOOKUPS);
+        };
+        const double legacy_ns = perLookup([&](const std::filesystem::path& file) { return legacyMimeType(mime_types, file).size(); });
+        const double current_ns = perLookup([&](const std::filesystem::path& file) { return ws.getMimeType(file).size(); });
+        return json::object{
+            {"description", "WebServer::getMimeType vs the old std::map lookup over " + std::to_string(probes.size()) + " file names"},
+            {"lookups", MIME_LOOKUPS},
+            {"legacy_ns_per_lookup", legacy_ns},
+            {"current_ns_per_lookup", current_ns},
+            {"legacy_entries", mime_types.size()},
+            {"legacy_misses", legacy_misses},
+            {"probes", probes.size()},
+            {"checksum", sink}
+        };
+    }
+
+    double median(std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        return values.empty() ? 0.0 : values[values.size() / 2];
+    }
+
+    // Cold server start to the last asset of startup.html, STARTUP_RUNS times
+    json::object runStartup(const std::filesystem::path& base, std::shared_ptr<RenWeb::ILogger> logger, int argc, char** argv) {
+        using Ms = std::chrono::duration<double, std::milli>;
+        std::vector<double> start_ms, index_ms, paint_ms;
+        uint64_t errors = 0;
+        for (size_t run = 0; run < STARTUP_RUNS; run++) {
+            const auto started = Clock::now();
+            std::unique_ptr<RenWeb::App> app = makeApp(base, logger, std::make_unique<StubWebview>(), argc, argv);
+            app->ws->start();
+            const std::string url = app->ws->getURL();
+            const auto listening = Clock::now();
+            {
+                auto client = makeClient(url, "");
+                httplib::Result res = client->Get("/startup.html");
+                if (!res || res->status != 200) errors++;
+            }
+            const auto indexed = Clock::now();
+            std::vector<std::thread> connections;
+            std::atomic<uint64_t> failed{0};
+            for (size_t c = 0; c < STARTUP_CONNECTIONS; c++) {
+                connections.emplace_back([&, c]() {
+                    auto client = makeClient(url, "");
+                    for (size_t i = c; i < STARTUP_ASSETS; i += STARTUP_CONNECTIONS) {
+                        httplib::Result res = client->Get(startupAsset(i));
+                        if (!res || res->status != 200) failed++;
+                    }
+                });
+            }
+            for (auto& connection : connections) connection.join();
+            const auto painted = Clock::now();
+            errors += failed.load();
+            app->ws->stop();
+            app.reset();
+            start_ms.push_back(Ms(listening - started).count());
+            index_ms.push_back(Ms(indexed - started).count());
+            paint_ms.push_back(Ms(painted - started).count());
+        }
+        return json::object{
+            {"runs", STARTUP_RUNS},
+            {"assets", STARTUP_ASSETS},
+            {"connections", STARTUP_CONNECTIONS},
+            {"errors", errors},
+            {"start_ms", median(start_ms)},
+            {"index_ms", median(index_ms)},
+            {"first_paint_ms", median(paint_ms)}
+        };
+    }
+
+    Options parseArgs(int argc, char** argv) {
+        Options opts;
+        opts.out = RenWeb::Locate::currentDirectory() / "results.json";
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "--out") {
+                opts.out = next();
+            } else if (arg == "--threads") {
+                opts.threads = std::max<size_t>(1, std::stoul(next()));
+            } else if (arg == "--duration") {
+                opts.duration_s = std::max(0.1, std::stod(next()));
+            } else if (arg == "--warmup") {
+                opts.warmup_s = std::max(0.0, std::stod(next()));
+            } else if (arg == "--only") {
+                std::string list = next();
+                for (size_t start = 0; start <= list.size();) {
+                    const size_t comma = std::min(list.find(',', start), list.size());
+                    if (comma > start) opts.only.push_back(list.substr(start, comma - start));
+                    start = comma + 1;
+                }
+            } else if (arg == "--server") {
+                opts.server = json::parse(next()).as_object();
+            } else if (arg == "--verbose") {
+                opts.verbose = true;
+            } else {
+                throw std::runtime_error("Unknown argument " + arg);
+            }
+        }
+        return opts;
+    }
+
+    std::string timestamp() {
+        const std::time_t now = std::time(nullptr);
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        return buffer;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opts;
+    try {
+        opts = parseArgs(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+    const std::filesystem::path base = RenWeb::Locate::currentDirectory();
+    writeAssetTree(base, opts.server);
+
+    auto logger = std::make_shared<QuietLogger>(opts.verbose);
+    auto webview = std::make_unique<StubWebview>();
+    StubWebview* webview_ptr = webview.get();
+    std::unique_ptr<RenWeb::App> app = makeApp(base, logger, std::move(webview), argc, argv);
+
+    app->ws->start();
+    const std::string url = app->ws->getURL();
+    const std::string socket_path = app->ws->getSocketPath();
+    std::cout << "web-server-bench: " << url << (socket_path.empty() ? "" : " + unix:" + socket_path)
+              << ", " << opts.threads << " threads, " << opts.duration_s << "s per scenario" << std::endl;
+
+    json::object results;
+    for (const auto& scenario : makeScenarios(socket_path)) {
+        if (!opts.only.empty() && std::find(opts.only.begin(), opts.only.end(), scenario.name) == opts.only.end()) continue;
+        json::object result = runScenario(scenario, url, opts);
+        const json::object& latency = result.at("latency_us").as_object();
+        std::printf("  %-14s %10.0f req/s %9.1f MB/s   p50 %6llu us   p99 %7llu us   errors %llu\n",
+            scenario.name.c_str(),
+            result.at("requests_per_s").as_double(),
+            result.at("mb_per_s").as_double(),
+            static_cast<unsigned long long>(latency.at("p50").to_number<uint64_t>()),
+            static_cast<unsigned long long>(latency.at("p99").to_number<uint64_t>()),
+            static_cast<unsigned long long>(result.at("errors").to_number<uint64_t>()));
+        std::fflush(stdout);
+        results[scenario.name] = std::move(result);
+    }
+
+    if (opts.only.empty() || std::find(opts.only.begin(), opts.only.end(), "mime_lookup") != opts.only.end()) {
+        if (const auto* ws = dynamic_cast<const RenWeb::WebServer*>(app->ws.get())) {
+            json::object result = runMimeLookup(*ws);
+            std::printf("  %-14s legacy %7.1f ns/lookup   current %7.1f ns/lookup   old table missed %llu of %llu names\n",
+                "mime_lookup",
+                result.at("legacy_ns_per_lookup").as_double(),
+                result.at("current_ns_per_lookup").as_double(),
+                static_cast<unsigned long long>(result.at("legacy_misses").to_number<uint64_t>()),
+                static_cast<unsigned long long>(result.at("probes").to_number<uint64_t>()));
+            std::fflush(stdout);
+            results["mime_lookup"] = std::move(result);
+        }
+    }
+
+    json::object report{
+        {"timestamp", timestamp()},
+        {"url", url},
+        {"threads", opts.threads},
+        {"duration_s", opts.duration_s},
+        {"warmup_s", opts.warmup_s},
+        {"hardware_concurrency", std::thread::hardware_concurrency()},
+        {"server_options", opts.server},
+        {"scenarios", std::move(results)},
+        {"server_stats", app->ws->getStats()},
+        {"ui_dispatches", webview_ptr->dispatched.load()}
+    };
+    app->ws->stop();
+    app.reset();
+
+    if (opts.only.empty() || std::find(opts.only.begin(), opts.only.end(), "file_backends") != opts.only.end()) {
+        json::object backends;
+        for (const auto& [backend, use_mmap] : {std::make_pair("mmap", true), std::make_pair("read", false)}) {
+            json::object server = opts.server;
+            server["mmap"] = use_mmap;
+            server["asset_cache_bytes"] = 0;
+            writeAssetTree(base, server);
+            std::unique_ptr<RenWeb::App> backend_app = makeApp(base, logger, std::make_unique<StubWebview>(), argc, argv);
+            backend_app->ws->start();
+            const std::string backend_url = backend_app->ws->getURL();
+            json::object scenarios;
+            for (const auto& scenario : makeScenarios("")) {
+                if (std::find(std::begin(FILE_BACKEND_SCENARIOS), std::end(FILE_BACKEND_SCENARIOS), scenario.name) == std::end(FILE_BACKEND_SCENARIOS)) continue;
+                json::object result = runScenario(scenario, backend_url, opts);
+                const json::object& latency = result.at("latency_us").as_object();
+                std::printf("  %-4s %-11s %10.0f req/s %9.1f MB/s   p50 %6llu us   cpu %6.2f s/GiB   errors %llu\n",
+                    backend, scenario.name.c_str(),
+                    result.at("requests_per_s").as_double(),
+                    result.at("mb_per_s").as_double(),
+                    static_cast<unsigned long long>(latency.at("p50").to_number<uint64_t>()),
+                    result.at("cpu_s_per_gib").as_double(),
+                    static_cast<unsigned long long>(result.at("errors").to_number<uint64_t>()));
+                std::fflush(stdout);
+                scenarios[scenario.name] = std::move(result);
+            }
+            backends[backend] = json::object{
+                {"scenarios", std::move(scenarios)},
+                {"server_stats", backend_app->ws->getStats()}
+            };
+            backend_app->ws->stop();
+        }
+        report["file_backends"] = std::move(backends);
+    }
+
+    if (opts.only.empty() || std::find(opts.only.begin(), opts.only.end(), "startup") != opts.only.end()) {
+        json::object startup;
+        writeAssetTree(base, opts.server);
+        for (const bool packed : {false, true}) {
+            std::filesystem::remove(base / "app.rwpack");
+            if (packed) writeAssetPack(base);
+            json::object result = runStartup(base, logger, argc, argv);
+            std::printf("  %-5s startup    listening %7.2f ms   index %7.2f ms   first paint %7.2f ms   errors %llu\n",
+                packed ? "pack" : "loose",
+                result.at("start_ms").as_double(),
+                result.at("index_ms").as_double(),
+                result.at("first_paint_ms").as_double(),
+                static_cast<unsigned long long>(result.at("errors").to_number<uint64_t>()));
+            std::fflush(stdout);
+            startup[packed ? "pack" : "loose"] = std::move(result);
+        }
+        std::filesystem::remove(base / "app.rwpack");
+        report["startup"] = std::move(startup);
+    }
+
+    if (!opts.out.parent_path().empty()) {
+        std::filesystem::create_directories(opts.out.parent_path());
+    }
+    std::ofstream out(opts.out, std::ios::trunc);
+    out << json::serialize(report) << std::endl;
+    std::cout << "web-server-bench: wrote " << opts.out.string() << std::endl;
+    return 0;
+}
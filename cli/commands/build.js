@@ -9,10 +9,30 @@ const {
     rwExecutablesDir, ensureRwGitignore,
 } = require('../shared/utils');
 const { fetchPlugins } = require('../shared/fetchers');
+const { writeCompressedSidecars, writeAssetPack, PACK_NAME } = require('../shared/assets');
 const { ProjectState } = require('../project/project_state');
 const ui = require('../shared/ui');
 
-function finishBuild(result, buildLabel) {
+function compressBuild(buildDir) {
+    ui.step('Writing compressed sidecars (.br, .gz)…');
+    const dirs = ['content', 'assets', 'custom', 'backup'].map(d => path.join(buildDir, d));
+    ui.ok(`Wrote ${writeCompressedSidecars(dirs)} compressed sidecar(s).`);
+}
+
+function packBuild(buildDir) {
+    ui.step(`Writing asset pack (${PACK_NAME})…`);
+    const { entries, bytes, dirs } = writeAssetPack(buildDir, path.join(buildDir, PACK_NAME));
+    ui.ok(`Packed ${entries} file(s) from ${dirs.join(', ') || 'nothing'} (${bytes} bytes).`);
+}
+
+/** Optional post-build steps; sidecars go first so the pack picks them up. */
+function postBuild(buildDir, { compress, pack }) {
+    if (compress) compressBuild(buildDir);
+    if (pack) packBuild(buildDir);
+    else fs.rmSync(path.join(buildDir, PACK_NAME), { force: true });
+}
+
+function finishBuild(result, buildLabel, onSuccess) {
     if (!result) {
         ui.error(`Build failed (${buildLabel}) — no process result.`);
         process.exit(1);
@@ -24,6 +44,7 @@ function finishBuild(result, buildLabel) {
     }
 
     if (result.status === 0) {
+        if (onSuccess) onSuccess();
         ui.ok(`Build complete (${buildLabel}).`);
         process.exit(0);
     }
@@ -103,6 +124,8 @@ function hasBuildScript(projectRoot, jsEngine) {
 
 function run(args) {
     const metaOnly   = args.includes('--meta-only');
+    const compress   = args.includes('--compress');
+    const pack       = args.includes('--pack');
 
     let startCwd = process.cwd();
     if (path.basename(startCwd) === 'build') startCwd = path.dirname(startCwd);
@@ -151,7 +174,7 @@ function run(args) {
         const buildLabel = state.isVanilla() ? state.js_engine : state.framework;
         ui.step(`Building (${buildLabel})…`);
         const r = pm.run('build');
-        finishBuild(r, buildLabel);
+        finishBuild(r, buildLabel, () => postBuild(buildDir, { compress, pack }));
     }
 
     const srcDir = path.join(projectRoot, 'src');
@@ -171,6 +194,8 @@ function run(args) {
         }
     }
 
+    postBuild(buildDir, { compress, pack });
+
     ui.ok('Build complete.');
 }
 
@@ -6,6 +6,7 @@ const os     = require('os');
 const crypto = require('crypto');
 const { spawnSync, spawn } = require('child_process');
 const ui = require('../shared/ui');
+const { writeCompressedSidecars, writeAssetPack, PACK_NAME } = require('../shared/assets');
 
 // ─── Constants ───────────────────────────────────────────────────────────────
 
@@ -534,11 +535,15 @@ function parseArgs(args) {
         arches         : new Set(),   // empty = all architectures
         cache          : false,
         noCredentials  : false,
+        compress       : false,
+        pack           : false,
     };
     for (let i = 0; i < args.length; i++) {
         const a = args[i];
         if (a === '-c' || a === '--cache')            { opts.cache = true;          continue; }
         if (a === '--no-credentials')                 { opts.noCredentials = true;  continue; }
+        if (a === '--compress')                       { opts.compress = true;       continue; }
+        if (a === '--pack')                           { opts.pack = true;           continue; }
         if (a.startsWith('-e') && a.length > 2)       { opts.exts.add(normalizeExt(a.slice(2))); continue; }
         if (a === '-e' || a === '--ext')              { const v = args[++i]; if (v) opts.exts.add(normalizeExt(v)); continue; }
         if (a.startsWith('-o') && a.length > 2)       { opts.oses.add(a.slice(2).toLowerCase()); continue; }
@@ -3144,6 +3149,8 @@ function run(args) {
     if (opts.oses.size > 0)   ui.info(`os filter : ${[...opts.oses].join(', ')}`);
     if (opts.arches.size > 0) ui.info(`arch filter: ${[...opts.arches].join(', ')}`);
     if (opts.cache)           ui.info('cache     : enabled (.rw/package/)');
+    if (opts.compress)        ui.info('compress  : .br/.gz sidecars');
+    if (opts.pack)            ui.info(`pack      : ${PACK_NAME}`);
 
         opts.credDir = opts.noCredentials ? null : findCredentialsDir();
         if (opts.noCredentials)       ui.info('signing   : disabled (--no-credentials)');
@@ -3248,6 +3255,19 @@ function run(args) {
         ui.step(`copy: ${name}`);
     }
 
+    if (opts.compress) {
+        const dirs = ['content', 'assets', 'custom', 'backup'].map(d => path.join(buildSrcDir, d));
+        ui.step(`compress: ${writeCompressedSidecars(dirs)} sidecar(s)`);
+    }
+    if (opts.pack) {
+        // Packed directories ship only inside the pack; the engine falls back to loose files for the rest
+        const { entries, dirs } = writeAssetPack(buildSrcDir, path.join(buildSrcDir, PACK_NAME));
+        for (const d of dirs) fs.rmSync(path.join(buildSrcDir, d), { recursive: true, force: true });
+        ui.step(`pack: ${entries} file(s) from ${dirs.join(', ') || 'nothing'} → ${PACK_NAME}`);
+    } else {
+        fs.rmSync(path.join(buildSrcDir, PACK_NAME), { force: true });
+    }
+
     // Warn when build/plugins/ has plugin files but no plugin-repositories are configured,
     // since those files will be excluded from all packages.
     if (pluginRepos.length === 0) {
@@ -116,6 +116,8 @@ program
   .command('build')
   .description('Build the project: copies manifests, fetches engine + plugins, then delegates to the bundler or mirrors src/')
   .option('--meta-only', 'Only run the meta steps (manifests, engine, plugins) — skip the JS build; used as a prebuild hook')
+  .option('--compress', 'Write precompressed .br/.gz sidecars next to compressible build output')
+  .option('--pack', 'Write build/app.rwpack, a single-file pack of content/, backup/ and assets/')
   .action(() => {
     const idx = process.argv.indexOf('build');
     require('./commands/build').run(process.argv.slice(idx + 1));
@@ -136,6 +138,8 @@ program
   .option('-o, --os <os>',        'Target OS filter, repeatable: -olinux -owindows (default: all)')
   .option('-a, --arch <arch>',    'Target arch filter, repeatable: -aarm64 -ax86_64 (default: all). Aliases: aarch64, armhf, x64, i686, ppc, …')
   .option('-c, --cache',          'Cache downloads in ./.package and reuse on subsequent runs')
+  .option('--compress',           'Add precompressed .br/.gz sidecars for compressible files')
+  .option('--pack',               'Ship content/, backup/ and assets/ as a single app.rwpack file')
   .allowUnknownOption(true)
   .action(() => {
     const idx = process.argv.indexOf('package');
@@ -0,0 +1,155 @@
+'use strict';
+// cli/shared/assets.js
+// Build-output post-processing shared by `rw build` and `rw package`:
+// precompressed sidecars and the single-file asset pack served by the engine.
+
+const fs   = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+
+const COMPRESSIBLE_EXTS = new Set([
+    '.html', '.htm', '.css', '.js', '.mjs', '.cjs', '.json', '.map', '.svg',
+    '.xml', '.txt', '.md', '.csv', '.wasm', '.webmanifest', '.ico',
+]);
+const MIN_COMPRESS_SIZE = 1024;
+
+/** Writes .br and .gz sidecars next to compressible files under the given
+ *  directories. Sidecars that would not be smaller than the source are
+ *  removed, and up-to-date ones are left alone. The engine serves them to
+ *  clients that send a matching Accept-Encoding. */
+function writeCompressedSidecars(dirs) {
+    let written = 0;
+    const visit = (dir) => {
+        let entries;
+        try { entries = fs.readdirSync(dir, { withFileTypes: true }); } catch (_) { return; }
+        for (const e of entries) {
+            const file = path.join(dir, e.name);
+            if (e.isDirectory()) { visit(file); continue; }
+            if (!e.isFile() || !COMPRESSIBLE_EXTS.has(path.extname(e.name).toLowerCase())) continue;
+            const stat = fs.statSync(file);
+            for (const [ext, compress] of [
+                ['.br', (buf) => zlib.brotliCompressSync(buf, {
+                    params: {
+                        [zlib.constants.BROTLI_PARAM_QUALITY]:   zlib.constants.BROTLI_MAX_QUALITY,
+                        [zlib.constants.BROTLI_PARAM_SIZE_HINT]: buf.length,
+                    },
+                })],
+                ['.gz', (buf) => zlib.gzipSync(buf, { level: zlib.constants.Z_BEST_COMPRESSION })],
+            ]) {
+                const sidecar = file + ext;
+                let existing = null;
+                try { existing = fs.statSync(sidecar); } catch (_) {}
+                if (stat.size < MIN_COMPRESS_SIZE) {
+                    if (existing) fs.rmSync(sidecar, { force: true });
+                    continue;
+                }
+                if (existing && existing.mtimeMs >= stat.mtimeMs) continue;
+                const out = compress(fs.readFileSync(file));
+                if (out.length >= stat.size) {
+                    if (existing) fs.rmSync(sidecar, { force: true });
+                    continue;
+                }
+                fs.writeFileSync(sidecar, out);
+                written++;
+            }
+        }
+    };
+    for (const dir of dirs) visit(dir);
+    return written;
+}
+
+// ─── Asset pack ───────────────────────────────────────────────────────────────
+// Layout must match include/asset_pack.hpp (all integers little-endian).
+
+const PACK_NAME       = 'app.rwpack';
+const PACK_MAGIC      = Buffer.from('RWPACK\r\n', 'latin1');
+const PACK_VERSION    = 1;
+const PACK_HEADER     = 32;
+const PACK_ENTRY      = 40;
+const PACK_ALIGN      = 64;
+/** Top-level build directories the engine reads from the pack. `custom/` stays
+ *  loose so end users can still override packaged files. */
+const PACK_DIRS       = ['content', 'backup', 'assets'];
+
+const FNV_OFFSET = 0xcbf29ce484222325n;
+const FNV_PRIME  = 0x100000001b3n;
+const U64_MASK   = 0xffffffffffffffffn;
+
+function fnv1a64(buf) {
+    let h = FNV_OFFSET;
+    for (const byte of buf) h = ((h ^ BigInt(byte)) * FNV_PRIME) & U64_MASK;
+    return h;
+}
+
+/** Writes every file under `dirs` (relative to buildDir) into one pack at
+ *  outFile. Returns { entries, bytes, dirs } where dirs lists the packed
+ *  top-level directories. */
+function writeAssetPack(buildDir, outFile, dirs = PACK_DIRS) {
+    const files = [];
+    const visit = (rel) => {
+        const abs = path.join(buildDir, rel);
+        let entries;
+        try { entries = fs.readdirSync(abs, { withFileTypes: true }); } catch (_) { return; }
+        for (const e of entries) {
+            const childRel = rel + '/' + e.name;
+            if (e.isDirectory()) { visit(childRel); continue; }
+            if (!e.isFile()) continue;
+            const stat = fs.statSync(path.join(abs, e.name), { bigint: true });
+            const name = Buffer.from(childRel, 'utf8');
+            files.push({ abs: path.join(abs, e.name), name, hash: fnv1a64(name), size: stat.size, mtimeNs: stat.mtimeNs });
+        }
+    };
+    const packed = dirs.filter(d => fs.existsSync(path.join(buildDir, d)));
+    for (const d of packed) visit(d);
+
+    files.sort((a, b) => (a.hash < b.hash ? -1 : a.hash > b.hash ? 1 : Buffer.compare(a.name, b.name)));
+
+    const indexEnd = PACK_HEADER + files.length * PACK_ENTRY;
+    let stringsSize = 0;
+    for (const f of files) { f.pathOffset = stringsSize; stringsSize += f.name.length; }
+    let offset = indexEnd + stringsSize;
+    for (const f of files) {
+        offset = Math.ceil(offset / PACK_ALIGN) * PACK_ALIGN;
+        f.dataOffset = offset;
+        offset += Number(f.size);
+    }
+
+    const header = Buffer.alloc(indexEnd);
+    PACK_MAGIC.copy(header, 0);
+    header.writeUInt32LE(PACK_VERSION, 8);
+    header.writeUInt32LE(files.length, 12);
+    header.writeBigUInt64LE(BigInt(indexEnd), 16);
+    header.writeBigUInt64LE(BigInt(stringsSize), 24);
+    files.forEach((f, i) => {
+        const at = PACK_HEADER + i * PACK_ENTRY;
+        header.writeBigUInt64LE(f.hash, at);
+        header.writeUInt32LE(f.pathOffset, at + 8);
+        header.writeUInt32LE(f.name.length, at + 12);
+        header.writeBigUInt64LE(BigInt(f.dataOffset), at + 16);
+        header.writeBigUInt64LE(f.size, at + 24);
+        header.writeBigInt64LE(f.mtimeNs, at + 32);
+    });
+
+    const tmp = outFile + '.tmp';
+    const fd = fs.openSync(tmp, 'w');
+    try {
+        let pos = 0;
+        const write = (buf) => { fs.writeSync(fd, buf, 0, buf.length, pos); pos += buf.length; };
+        write(header);
+        for (const f of files) write(f.name);
+        for (const f of files) {
+            if (f.dataOffset > pos) write(Buffer.alloc(f.dataOffset - pos));
+            write(fs.readFileSync(f.abs));
+        }
+    } finally {
+        fs.closeSync(fd);
+    }
+    // Rename into place so a running engine never maps a half-written pack
+    fs.renameSync(tmp, outFile);
+    return { entries: files.length, bytes: offset, dirs: packed };
+}
+
+module.exports = {
+    COMPRESSIBLE_EXTS, writeCompressedSidecars,
+    PACK_NAME, PACK_DIRS, writeAssetPack,
+};
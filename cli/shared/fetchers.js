@@ -57,14 +57,16 @@ function fetchEngineExecutable(buildDir) {
 }
 
 /**
- * Download plugin.hpp from the engine repo into includeDir.
+ * Download plugin.hpp and the encoding.hpp codec it includes from the engine repo into includeDir.
  */
 function fetchPluginHpp(includeDir) {
     ui.step('Fetching plugin.hpp…');
     fs.mkdirSync(includeDir, { recursive: true });
     const rawBase = engineRawBase(resolveEngineRepo());
-    const ok = download(`${rawBase}/include/plugin.hpp`, path.join(includeDir, 'plugin.hpp'));
-    if (!ok) ui.warn('Failed to fetch plugin.hpp');
+    for (const file of ['plugin.hpp', 'encoding.hpp']) {
+        const ok = download(`${rawBase}/include/${file}`, path.join(includeDir, file));
+        if (!ok) ui.warn(`Failed to fetch ${file}`);
+    }
 }
 
 /**
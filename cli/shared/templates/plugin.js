@@ -1042,6 +1042,7 @@ ${pluginName}/
 │   └── boost/                        # pinned Boost submodule (boost-1.90.0)
 ├── include/
 │   ├── plugin.hpp          # RenWeb Plugin base class (fetched from engine)
+│   ├── encoding.hpp        # String wire-format codec used by plugin.hpp (fetched from engine)
 │   └── ${pluginName}.hpp   # Plugin class declaration
 ├── src/
 │   └── ${pluginName}.cpp   # Plugin implementation (defines name + version)
@@ -48,7 +48,7 @@ namespace RenWeb {
           App(std::shared_ptr<ILogger> logger) : logger(logger) {}
           
         public:
-          ~App() = default;
+          ~App();
           std::vector<std::string> orig_args;
           std::unique_ptr<JSON> info = nullptr;
           std::unique_ptr<Config> config = nullptr;
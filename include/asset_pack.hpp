@@ -0,0 +1,90 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// Read-only single-file asset pack (".rwpack"), written by `rw build --pack` / `rw package --pack`.
+// All integers are little-endian.
+//
+//   header   magic "RWPACK\r\n" | u32 version | u32 entry_count | u64 strings_offset | u64 strings_size
+//   index    entry_count x { u64 fnv1a64(path) | u32 path_offset | u32 path_length
+//                            | u64 data_offset | u64 size | i64 mtime_ns }, sorted by (hash, path)
+//   strings  '/'-separated paths relative to the build directory
+//   blobs    file contents, each starting on a 64-byte boundary
+//
+// Precompressed variants are ordinary entries named "<path>.br" / "<path>.gz".
+namespace RenWeb {
+    class AssetPack {
+        public:
+            struct Entry {
+                uint64_t hash;
+                std::string_view path;
+                const char* data;
+                uint64_t size;
+                int64_t mtime_ns;
+            };
+            static constexpr const char* MAGIC = "RWPACK\r\n";
+            static constexpr uint32_t VERSION = 1;
+            static constexpr size_t HEADER_SIZE = 32;
+            static constexpr size_t ENTRY_SIZE = 40;
+
+            // Maps and validates the pack. Throws std::runtime_error if it cannot be used.
+            explicit AssetPack(const std::filesystem::path& path);
+            ~AssetPack();
+            AssetPack(const AssetPack&) = delete;
+            AssetPack& operator=(const AssetPack&) = delete;
+
+            static uint64_t hash(std::string_view path);
+            const Entry* find(std::string_view path) const;
+            // True when the pack holds anything under this top-level directory
+            bool owns(std::string_view root) const;
+            const std::filesystem::path& getPath() const;
+            std::filesystem::file_time_type getMtime() const;
+            uintmax_t getFileSize() const;
+            size_t getEntryCount() const;
+        private:
+            std::filesystem::path path;
+            std::filesystem::file_time_type mtime;
+            const char* data = nullptr;
+            size_t size = 0;
+#if defined(_WIN32)
+            void* mapping = nullptr;
+#endif
+            std::vector<Entry> entries;
+            std::unordered_set<std::string_view> roots;
+
+            void unmap();
+    };
+};
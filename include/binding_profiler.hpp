@@ -0,0 +1,151 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <boost/json.hpp>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#include "request_metrics.hpp"
+
+namespace json = boost::json;
+
+// Per-binding profiler for the BIND_* bridge. Each bound function gets a slot at
+// bind time; calls record into one of a few cache-line sized shards picked per
+// thread, so the UI thread and the worker pool never contend on a counter.
+namespace RenWeb {
+    class BindingProfiler {
+        public:
+            using Clock = std::chrono::steady_clock;
+            static constexpr size_t SHARDS = 8;
+            // Trace events kept in memory before new spans are dropped
+            static constexpr size_t MAX_TRACE_EVENTS = 1 << 18;
+
+            class Slot {
+                friend class BindingProfiler;
+                public:
+                    explicit Slot(std::string name) : name(std::move(name)) { }
+                    const std::string& getName() const { return this->name; }
+                private:
+                    struct alignas(64) Shard {
+                        std::atomic<uint64_t> calls{0};
+                        std::atomic<uint64_t> errors{0};
+                        std::atomic<uint64_t> decode_ns{0};
+                        std::atomic<uint64_t> execute_ns{0};
+                        std::atomic<uint64_t> encode_ns{0};
+                        std::atomic<uint64_t> request_bytes{0};
+                        std::atomic<uint64_t> response_bytes{0};
+                    };
+                    const std::string name;
+                    std::array<Shard, SHARDS> shards{};
+                    std::atomic<uint64_t> max_request_bytes{0};
+                    std::atomic<uint64_t> max_response_bytes{0};
+                    LatencyHistogram latency;
+            };
+
+            // One binding invocation, opened by the bind wrapper on the thread that
+            // runs it. Code inside the binding marks phase boundaries through the
+            // static helpers; a call that never marks counts entirely as execute.
+            class Call {
+                friend class BindingProfiler;
+                public:
+                    Call(BindingProfiler* profiler, Slot* slot, size_t request_bytes);
+                    ~Call();
+                    Call(const Call&) = delete;
+                    Call& operator=(const Call&) = delete;
+                    void setResponseBytes(size_t bytes) { this->response_bytes = bytes; }
+
+                    // Arguments are decoded; execution starts
+                    static void decoded();
+                    // The callback returned; encoding starts
+                    static void executed();
+                    static void failed();
+                private:
+                    BindingProfiler* const profiler;
+                    Slot* const slot;
+                    Call* const outer;
+                    const size_t request_bytes;
+                    size_t response_bytes = 0;
+                    const Clock::time_point started;
+                    std::optional<Clock::time_point> decode_end;
+                    std::optional<Clock::time_point> execute_end;
+                    bool error = false;
+            };
+
+            BindingProfiler();
+
+            // Called at bind time; the returned slot lives as long as the profiler
+            Slot* slot(const std::string& name);
+            bool isEnabled() const { return this->enabled.load(std::memory_order_relaxed); }
+            void setEnabled(bool enabled) { this->enabled.store(enabled, std::memory_order_relaxed); }
+
+            // Chrome trace (chrome://tracing, Perfetto) spans for every call until stopTrace()
+            void startTrace(const std::filesystem::path& path);
+            // Writes the trace and returns where it went, or nothing if no trace was running
+            std::optional<std::filesystem::path> stopTrace();
+            bool isTracing() const { return this->tracing.load(std::memory_order_relaxed); }
+
+            json::object toJson() const;
+            // Plain-text table of the bindings with the most total time, for the log
+            std::string summary(size_t top = 20) const;
+        private:
+            struct TraceEvent {
+                const Slot* slot;
+                uint64_t thread;
+                Clock::time_point started;
+                uint64_t decode_ns;
+                uint64_t execute_ns;
+                uint64_t encode_ns;
+                uint64_t request_bytes;
+                uint64_t response_bytes;
+                bool error;
+            };
+
+            std::atomic<bool> enabled{true};
+            mutable std::mutex slots_mtx;
+            std::map<std::string, std::unique_ptr<Slot>> slots;
+            const Clock::time_point created = Clock::now();
+
+            std::atomic<bool> tracing{false};
+            std::mutex trace_mtx;
+            std::filesystem::path trace_path;
+            std::vector<TraceEvent> trace_events;
+            uint64_t trace_dropped = 0;
+
+            void record(const Call& call, Clock::time_point ended);
+    };
+};
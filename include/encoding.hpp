@@ -0,0 +1,201 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <boost/json/value.hpp>
+#include <boost/json/array.hpp>
+#include <boost/json/object.hpp>
+
+namespace json = boost::json;
+
+namespace RenWeb {
+    // Wire format for strings crossing the JS <-> C++ bridge:
+    //   { "__encoding_type__": "utf8",   "__val__": "<string>" }  valid UTF-8, sent as-is
+    //   { "__encoding_type__": "base64", "__val__": "<base64>" }  arbitrary bytes (RFC 4648)
+    //   { "__encoding_type__": "base64", "__val__": [72, 105] }   legacy byte array (decode only)
+    namespace Encoding {
+        inline constexpr const char* TYPE_KEY = "__encoding_type__";
+        inline constexpr const char* VALUE_KEY = "__val__";
+        inline constexpr const char* UTF8 = "utf8";
+        inline constexpr const char* BASE64 = "base64";
+
+        inline bool isValidUtf8(std::string_view str) {
+            const auto* s = reinterpret_cast<const unsigned char*>(str.data());
+            const size_t n = str.size();
+            size_t i = 0;
+            while (i < n) {
+                // ASCII fast path, 8 bytes at a time
+                if (i + 8 <= n) {
+                    uint64_t chunk;
+                    std::memcpy(&chunk, s + i, sizeof(chunk));
+                    if ((chunk & 0x8080808080808080ULL) == 0) {
+                        i += 8;
+                        continue;
+                    }
+                }
+                const unsigned char c = s[i];
+                if (c < 0x80) {
+                    i += 1;
+                    continue;
+                }
+                size_t len;
+                uint32_t min_cp;
+                uint32_t cp;
+                if ((c & 0xE0) == 0xC0)      { len = 2; min_cp = 0x80;    cp = c & 0x1F; }
+                else if ((c & 0xF0) == 0xE0) { len = 3; min_cp = 0x800;   cp = c & 0x0F; }
+                else if ((c & 0xF8) == 0xF0) { len = 4; min_cp = 0x10000; cp = c & 0x07; }
+                else return false;
+                if (i + len > n) return false;
+                for (size_t k = 1; k < len; k++) {
+                    if ((s[i + k] & 0xC0) != 0x80) return false;
+                    cp = (cp << 6) | (s[i + k] & 0x3F);
+                }
+                if (cp < min_cp || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return false;
+                i += len;
+            }
+            return true;
+        }
+
+        inline std::string base64Encode(std::string_view bytes) {
+            static constexpr char alphabet[] =
+                "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            const auto* in = reinterpret_cast<const unsigned char*>(bytes.data());
+            const size_t n = bytes.size();
+            std::string out(((n + 2) / 3) * 4, '=');
+            char* dst = &out[0];
+            size_t i = 0;
+            for (; i + 3 <= n; i += 3) {
+                const uint32_t triple = (uint32_t(in[i]) << 16) | (uint32_t(in[i + 1]) << 8) | uint32_t(in[i + 2]);
+                dst[0] = alphabet[(triple >> 18) & 0x3F];
+                dst[1] = alphabet[(triple >> 12) & 0x3F];
+                dst[2] = alphabet[(triple >> 6) & 0x3F];
+                dst[3] = alphabet[triple & 0x3F];
+                dst += 4;
+            }
+            if (i < n) {
+                const uint32_t triple = (uint32_t(in[i]) << 16) | ((i + 1 < n) ? (uint32_t(in[i + 1]) << 8) : 0);
+                dst[0] = alphabet[(triple >> 18) & 0x3F];
+                dst[1] = alphabet[(triple >> 12) & 0x3F];
+                if (i + 1 < n) dst[2] = alphabet[(triple >> 6) & 0x3F];
+            }
+            return out;
+        }
+
+        inline std::string base64Decode(std::string_view str) {
+            struct Table {
+                int8_t v[256];
+                constexpr Table() : v() {
+                    for (int i = 0; i < 256; i++) v[i] = -1;
+                    for (int i = 0; i < 26; i++) { v['A' + i] = int8_t(i); v['a' + i] = int8_t(26 + i); }
+                    for (int i = 0; i < 10; i++) v['0' + i] = int8_t(52 + i);
+                    v[int('+')] = 62; v[int('/')] = 63;
+                    v[int('-')] = 62; v[int('_')] = 63; // base64url
+                }
+            };
+            static constexpr Table table{};
+
+            while (!str.empty() && str.back() == '=') str.remove_suffix(1);
+            if (str.size() % 4 == 1) {
+                throw std::runtime_error("[encoding] Invalid base64 length");
+            }
+            const auto* in = reinterpret_cast<const unsigned char*>(str.data());
+            const size_t n = str.size();
+            std::string out;
+            out.resize((n / 4) * 3 + ((n % 4) ? (n % 4) - 1 : 0));
+            char* dst = &out[0];
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const int32_t a = table.v[in[i]], b = table.v[in[i + 1]], c = table.v[in[i + 2]], d = table.v[in[i + 3]];
+                if ((a | b | c | d) < 0) {
+                    throw std::runtime_error("[encoding] Invalid base64 character");
+                }
+                const uint32_t quad = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | uint32_t(d);
+                dst[0] = char((quad >> 16) & 0xFF);
+                dst[1] = char((quad >> 8) & 0xFF);
+                dst[2] = char(quad & 0xFF);
+                dst += 3;
+            }
+            if (i < n) {
+                uint32_t quad = 0;
+                for (size_t k = 0; k < n - i; k++) {
+                    const int32_t v = table.v[in[i + k]];
+                    if (v < 0) {
+                        throw std::runtime_error("[encoding] Invalid base64 character");
+                    }
+                    quad |= uint32_t(v) << (18 - 6 * k);
+                }
+                dst[0] = char((quad >> 16) & 0xFF);
+                if (n - i == 3) dst[1] = char((quad >> 8) & 0xFF);
+            }
+            return out;
+        }
+
+        inline bool isEncoded(const json::object& obj) {
+            auto type = obj.find(TYPE_KEY);
+            return type != obj.end() && type->value().is_string() && obj.contains(VALUE_KEY);
+        }
+
+        // Valid UTF-8 goes over the bridge untouched; anything else is base64'd.
+        inline json::value encodeString(std::string_view str) {
+            json::object encoded;
+            if (isValidUtf8(str)) {
+                encoded[TYPE_KEY] = UTF8;
+                encoded[VALUE_KEY] = json::string(str);
+            } else {
+                encoded[TYPE_KEY] = BASE64;
+                encoded[VALUE_KEY] = base64Encode(str);
+            }
+            return encoded;
+        }
+
+        inline std::string decodeString(const json::object& encoded) {
+            const json::string& type = encoded.at(TYPE_KEY).as_string();
+            const json::value& val = encoded.at(VALUE_KEY);
+            if (type == UTF8 && val.is_string()) {
+                return std::string(val.as_string());
+            } else if (type == BASE64 && val.is_string()) {
+                return base64Decode(std::string_view(val.as_string().data(), val.as_string().size()));
+            } else if (type == BASE64 && val.is_array()) {
+                const json::array& bytes = val.as_array();
+                std::string out;
+                out.resize(bytes.size());
+                for (size_t i = 0; i < bytes.size(); i++) {
+                    out[i] = static_cast<char>(bytes[i].as_int64());
+                }
+                return out;
+            }
+            throw std::runtime_error("[encoding] Unsupported encoding type: " + std::string(type));
+        }
+    }
+}
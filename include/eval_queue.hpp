@@ -0,0 +1,96 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "request_metrics.hpp"
+#include <atomic>
+#include <boost/json.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace json = boost::json;
+
+// Scripts headed for the page from any thread. Producers link nodes into a lock-free
+// MPSC list and only the first push after a drain wakes the UI thread, so a burst of
+// notifications costs one dispatch and one eval of the concatenated scripts instead of
+// one of each per script. Batched scripts each run in their own indirect eval, so one that
+// throws or fails to parse does not take the rest of the batch with it.
+namespace RenWeb {
+    class EvalQueue {
+        public:
+            using Clock = std::chrono::steady_clock;
+            // Runs fn on the UI thread
+            using Dispatch = std::function<void(std::function<void()>)>;
+            using Eval = std::function<void(const std::string&)>;
+
+            EvalQueue(Dispatch dispatch, Eval eval);
+            EvalQueue(const EvalQueue&) = delete;
+            EvalQueue& operator=(const EvalQueue&) = delete;
+            ~EvalQueue();
+
+            // Safe from any thread
+            void push(std::string script);
+            // UI thread only. Evaluates everything queued so far, followed by trailing, in one eval.
+            void drain(const std::string& trailing = "");
+            // { depth, max_depth, queued, wakeups, evals, scripts_per_eval, bytes, latency: {...}, eval: {...} }
+            json::object getStats() const;
+        private:
+            struct Node {
+                std::atomic<Node*> next{nullptr};
+                std::string script;
+                Clock::time_point queued{};
+            };
+            const Dispatch dispatch;
+            const Eval eval;
+            // Wakeups still sitting in the dispatch queue check this before touching a destroyed queue
+            const std::shared_ptr<bool> alive = std::make_shared<bool>(true);
+
+            // Producers swap themselves in at head; the UI thread consumes from tail, which
+            // always points at the node before the next unread one
+            std::atomic<Node*> head;
+            Node* tail;
+            // Set by the push that dispatched a drain, cleared when that drain starts
+            std::atomic<bool> wake_pending{false};
+
+            std::atomic<int64_t> depth{0};
+            std::atomic<int64_t> max_depth{0};
+            std::atomic<uint64_t> queued{0};
+            std::atomic<uint64_t> wakeups{0};
+            std::atomic<uint64_t> evals{0};
+            std::atomic<uint64_t> scripts{0};
+            std::atomic<uint64_t> bytes{0};
+            // Time from push to the eval that ran the script, and time spent inside each eval
+            LatencyHistogram latency;
+            LatencyHistogram eval_time;
+    };
+};
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <boost/json.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace json = boost::json;
+
+// Delivers window events (onMove, onWindowStateChanged, ...) to the page in batches.
+// Only the latest payload per event is kept until the next flush, flushes run at most once
+// per frame interval, and each flush is a single eval that walks an array of
+// [callback, payload] pairs. An event can also be throttled to at most one delivery per
+// interval; anything it posts in between replaces the pending payload and counts as dropped.
+namespace RenWeb {
+    class EventCoalescer {
+        public:
+            using Clock = std::chrono::steady_clock;
+            // Runs fn on the UI thread; eval must only be called from there
+            using Dispatch = std::function<void(std::function<void()>)>;
+            using Eval = std::function<void(const std::string&)>;
+
+            EventCoalescer(Dispatch dispatch, Eval eval,
+                           std::chrono::microseconds frame_interval = std::chrono::microseconds(16667));
+            EventCoalescer(const EventCoalescer&) = delete;
+            EventCoalescer& operator=(const EventCoalescer&) = delete;
+            ~EventCoalescer();
+
+            // payload_js is a JS expression passed as the callback's only argument. Safe from any thread.
+            void post(const std::string& event, std::string payload_js);
+            // 0 flushes on the next main-loop iteration after an event
+            void setFrameInterval(std::chrono::microseconds interval);
+            // 0 removes the throttle
+            void setThrottle(const std::string& event, std::chrono::milliseconds interval);
+            // { frame_ms, posted, delivered, dropped, flushes, pending, events: { name: { throttle_ms, posted, delivered, dropped } } }
+            json::object getStats() const;
+        private:
+            struct Pending {
+                std::string event;
+                std::string payload_js;
+            };
+            struct Event {
+                std::chrono::milliseconds throttle{0};
+                Clock::time_point delivered_at{};
+                uint64_t posted = 0;
+                uint64_t delivered = 0;
+                uint64_t dropped = 0;
+            };
+            const Dispatch dispatch;
+            const Eval eval;
+            // Flushes still sitting in the dispatch queue check this before touching a destroyed coalescer
+            const std::shared_ptr<bool> alive = std::make_shared<bool>(true);
+
+            mutable std::mutex mtx;
+            std::condition_variable wake;
+            std::thread pacer;
+            bool stopping = false;
+            // A flush has been handed to dispatch and has not run yet
+            bool flush_queued = false;
+            Clock::time_point deadline = Clock::time_point::max();
+            Clock::time_point flushed_at{};
+            std::chrono::microseconds frame_interval;
+            std::vector<Pending> pending;
+            std::map<std::string, Event> events;
+            uint64_t flushes = 0;
+
+            void run();
+            void flush();
+            // Sets deadline to when the earliest pending event may go out. Caller holds mtx.
+            void schedule();
+            static std::string makeScript(const std::vector<Pending>& batch);
+    };
+};
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <boost/json.hpp>
+#include <chrono>
 #include <csignal>
 
 namespace json = boost::json;
@@ -63,7 +64,12 @@ namespace RenWeb {
             virtual std::vector<std::string> listen(Pid pid, int64_t lines = INT64_MAX, bool tail = false) const = 0;
             virtual void wait(Pid pid) = 0;
             virtual void waitAll() = 0;
+            // Bounded waits: true once the process (or every child) has exited
+            virtual bool waitFor(Pid pid, std::chrono::milliseconds timeout) = 0;
+            virtual bool waitAllFor(std::chrono::milliseconds timeout) = 0;
             virtual void registerProcess() const = 0;
+            virtual void stopPeerDiscovery() = 0;
+            virtual json::object getDiscoveryStats() const = 0;
     };    
     inline IProcessManager::~IProcessManager() = default;
 }
\ No newline at end of file
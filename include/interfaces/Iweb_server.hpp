@@ -29,21 +29,47 @@
 #pragma once
 
 #include <boost/json.hpp>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
 
 namespace json = boost::json;
 
 namespace RenWeb {
     class IWebServer {
         public:
+            // Called once per message that could not be delivered to a peer
+            using DeliveryFailureHandler = std::function<void(const std::string& peer, const json::value& message, const std::string& error)>;
+
             virtual ~IWebServer() = default;
             
             virtual std::string getURL() const = 0;
+            // Unix domain socket other RenWeb processes can reach this one on, or "" if there is none
+            virtual std::string getSocketPath() const = 0;
             virtual std::string getBasePath() const = 0;
-            virtual const std::vector<json::value>& getMessages() const = 0;
+            // True when target ("/" for the index) resolves for the current page, loose or packed, as a request would
+            virtual bool hasAsset(const std::string& target) = 0;
+            // Received messages with seq > since_seq, oldest first: { messages, last_seq, first_seq, dropped }
+            virtual json::object getMessages(uint64_t since_seq = 0, size_t max = SIZE_MAX) const = 0;
             virtual void start() = 0;
             virtual void stop() = 0;
             virtual bool isURI(const std::string& uri) const = 0;
+            // Peers are addressed by URL, "host:port", or "unix:<socket path>"
             virtual void sendMessage(const std::string& ip, const json::value& message, time_t timeout_s=2, time_t timeout_ms=0) const = 0;
+            virtual void onDeliveryFailure(DeliveryFailureHandler handler) = 0;
+            // Flushes and joins the outbound peer threads; later failures are only logged
+            virtual void stopOutbox() = 0;
             virtual json::object whoAreYou(const std::string& ip, time_t timeout_s=2, time_t timeout_ms=0) const = 0;
+            virtual std::string registerBlob(const std::filesystem::path& path, std::chrono::seconds ttl=std::chrono::seconds(30)) = 0;
+            virtual void releaseBlob(const std::string& token) = 0;
+            virtual json::object getStats() = 0;
+            virtual json::object getMetrics() const = 0;
+            virtual std::string getPrometheusMetrics() const = 0;
+            // Recompiles the current page's "cache_policy". Call on the UI thread after the config or page changes.
+            virtual void refreshCachePolicy() = 0;
+            // Script every page should run so this server's own pages receive messages over /??events
+            virtual std::string getInitScript() const = 0;
     };
 }
\ No newline at end of file
@@ -28,10 +28,14 @@
 // DEALINGS IN THE SOFTWARE.
 #pragma once
 
+#include <boost/json.hpp>
+#include <chrono>
 #include <string>
 #include <functional>
 #include <optional>
 
+namespace json = boost::json;
+
 namespace RenWeb {
     class IWebview {
         public:
@@ -40,15 +44,26 @@ namespace RenWeb {
             virtual void terminate() = 0;
             virtual void navigate(const std::string& url) = 0;
             virtual void bind(const std::string& name, std::function<std::string(std::string)> fn) = 0;
+            virtual void bind_async(const std::string& name, std::function<void(std::string, std::string)> fn) = 0;
+            virtual void resolve(const std::string& id, int status, const std::string& result) = 0;
             virtual void unbind(const std::string& name) = 0;
             virtual void dispatch(std::function<void()> fn) = 0;
             virtual void set_title(const std::string& title) = 0;
             virtual void set_size(int64_t width, int64_t height) = 0;
             virtual void set_html(const std::string& html) = 0;
             virtual void eval(const std::string& js) = 0;
+            // Runs js on the UI thread, batched with everything else queued into one eval per main-loop
+            // iteration. Safe from any thread; prefer it to dispatch + eval for notifications.
+            virtual void queue_eval(std::string js) = 0;
+            // { depth, max_depth, queued, wakeups, evals, scripts_per_eval, bytes, latency, eval }
+            virtual json::object get_eval_stats() = 0;
             virtual void init(const std::string& js) = 0;
             virtual std::optional<void*> window() = 0;
             virtual std::optional<void*> widget() = 0;
+            // Window events (onMove, onWindowStateChanged) are coalesced and delivered at most once per frame
+            virtual void set_event_frame_interval(std::chrono::microseconds interval) = 0;
+            virtual void set_event_throttle(const std::string& event, std::chrono::milliseconds interval) = 0;
+            virtual json::object get_event_stats() = 0;
             #if defined(_WIN32)
                 virtual std::optional<void*> get_controller() = 0;
                 virtual void register_navigation_handler(std::function<bool(const std::string&)> callback) = 0;
@@ -0,0 +1,336 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <boost/json.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace json = boost::json;
+
+namespace RenWeb {
+    /* Compile-time argument unpacking for typed bindings (CallbackManager::add<Sig>).
+     *
+     * A binding declared as add<bool(std::string_view, WriteOpts)>("write_file", fn)
+     * gets a wrapper that takes the positional JS argument array, checks every
+     * argument against its C++ type and calls fn with the converted values. The
+     * wrapper throws std::runtime_error naming the binding, the argument and the
+     * expected kind on a bad shape.
+     *
+     * Views are taken wherever a type allows it. std::string_view, const json::value&,
+     * const json::object& and const json::array& point into the request, which
+     * outlives the call. Only std::string, std::filesystem::path and std::vector
+     * copy.
+     *
+     * Option objects are plain structs with a static fields() table:
+     *
+     *     struct WriteOpts {
+     *         bool append = false;
+     *         static auto fields() { return std::make_tuple(BindingArgs::field("append", &WriteOpts::append)); }
+     *     };
+     *
+     * Missing (or null) option objects and fields keep their defaults, and
+     * std::optional<T> arguments may be missing or null. Every other argument
+     * is required. Lenient<T> accepts anything: a value of the wrong shape (or
+     * a wrong-shaped element of a Lenient vector) is skipped, as bindings that
+     * predate typed parsing did. */
+    namespace BindingArgs {
+        template <typename Class, typename Member>
+        struct Field {
+            const char* name;
+            Member Class::* member;
+        };
+
+        template <typename Class, typename Member>
+        constexpr Field<Class, Member> field(const char* name, Member Class::* member) {
+            return Field<Class, Member>{name, member};
+        }
+
+        // Where a value sits in the request, only turned into text on failure
+        struct Where {
+            const std::string& binding;
+            size_t index;
+            const char* field = nullptr;
+        };
+
+        inline const char* kindName(const json::value* value) {
+            if (value == nullptr) return "nothing";
+            switch (value->kind()) {
+                case json::kind::null: return "null";
+                case json::kind::bool_: return "boolean";
+                case json::kind::int64:
+                case json::kind::uint64:
+                case json::kind::double_: return "number";
+                case json::kind::string: return "string";
+                case json::kind::array: return "array";
+                case json::kind::object: return "object";
+                default: return "unknown";
+            }
+        }
+
+        [[noreturn]] inline void fail(const Where& where, const char* expected, const json::value* got) {
+            std::string msg = where.binding + ": argument " + std::to_string(where.index + 1);
+            if (where.field != nullptr) {
+                msg += std::string(" field '") + where.field + "'";
+            }
+            throw std::runtime_error(msg + " expected " + expected + ", got " + kindName(got));
+        }
+
+        template <typename T>
+        struct has_fields {
+            private:
+                template <typename U> static auto test(int) -> decltype(U::fields(), std::true_type{});
+                template <typename> static std::false_type test(...);
+            public:
+                static constexpr bool value = decltype(test<T>(0))::value;
+        };
+
+        template <typename T, typename = void>
+        struct Arg {
+            static_assert(sizeof(T) == 0, "Unsupported binding argument type. Add an Arg<T> specialization in binding_args.hpp.");
+        };
+
+        template <>
+        struct Arg<bool> {
+            static constexpr const char* expected = "boolean";
+            static bool decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_bool()) fail(where, expected, v);
+                return v->get_bool();
+            }
+        };
+
+        template <typename T>
+        struct Arg<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>> {
+            static constexpr const char* expected = "integer";
+            static T decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_number()) fail(where, expected, v);
+                json::error_code ec;
+                const T out = v->to_number<T>(ec);
+                if (ec) fail(where, "integer in range", v);
+                return out;
+            }
+        };
+
+        template <typename T>
+        struct Arg<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+            static constexpr const char* expected = "number";
+            static T decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_number()) fail(where, expected, v);
+                return static_cast<T>(v->to_number<double>());
+            }
+        };
+
+        template <>
+        struct Arg<std::string_view> {
+            static constexpr const char* expected = "string";
+            static std::string_view decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_string()) fail(where, expected, v);
+                const json::string& str = v->get_string();
+                return std::string_view(str.data(), str.size());
+            }
+        };
+
+        template <>
+        struct Arg<std::string> {
+            static constexpr const char* expected = "string";
+            static std::string decode(const json::value* v, const Where& where) {
+                return std::string(Arg<std::string_view>::decode(v, where));
+            }
+        };
+
+        template <>
+        struct Arg<std::filesystem::path> {
+            static constexpr const char* expected = "path string";
+            static std::filesystem::path decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_string()) fail(where, expected, v);
+                const json::string& str = v->get_string();
+                return std::filesystem::path(std::string_view(str.data(), str.size()));
+            }
+        };
+
+        template <>
+        struct Arg<const json::value&> {
+            static constexpr const char* expected = "any value";
+            static const json::value& decode(const json::value* v, const Where&) {
+                static const json::value null_value;
+                return (v != nullptr) ? *v : null_value;
+            }
+        };
+
+        template <>
+        struct Arg<const json::object&> {
+            static constexpr const char* expected = "object";
+            static const json::object& decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_object()) fail(where, expected, v);
+                return v->get_object();
+            }
+        };
+
+        template <>
+        struct Arg<const json::array&> {
+            static constexpr const char* expected = "array";
+            static const json::array& decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_array()) fail(where, expected, v);
+                return v->get_array();
+            }
+        };
+
+        template <typename T>
+        struct Arg<std::optional<T>> {
+            static constexpr const char* expected = Arg<T>::expected;
+            static std::optional<T> decode(const json::value* v, const Where& where) {
+                if (v == nullptr || v->is_null()) return std::nullopt;
+                return Arg<T>::decode(v, where);
+            }
+        };
+
+        template <typename T>
+        struct Arg<std::vector<T>> {
+            static constexpr const char* expected = "array";
+            static std::vector<T> decode(const json::value* v, const Where& where) {
+                if (v == nullptr || !v->is_array()) fail(where, expected, v);
+                const json::array& arr = v->get_array();
+                std::vector<T> out;
+                out.reserve(arr.size());
+                for (const json::value& item : arr) {
+                    out.push_back(Arg<T>::decode(&item, where));
+                }
+                return out;
+            }
+        };
+
+        template <typename T>
+        struct Arg<T, std::enable_if_t<has_fields<T>::value>> {
+            static constexpr const char* expected = "options object";
+            static T decode(const json::value* v, const Where& where) {
+                T out{};
+                if (v == nullptr || v->is_null()) return out;
+                if (!v->is_object()) fail(where, expected, v);
+                const json::object& obj = v->get_object();
+                std::apply([&](const auto&... fields) {
+                    (decodeField(obj, out, fields, where), ...);
+                }, T::fields());
+                return out;
+            }
+            private:
+                template <typename Member>
+                static void decodeField(const json::object& obj, T& out, const Field<T, Member>& f, const Where& where) {
+                    const json::value* value = obj.if_contains(f.name);
+                    if (value == nullptr || value->is_null()) return;
+                    out.*(f.member) = Arg<Member>::decode(value, Where{where.binding, where.index, f.name});
+                }
+        };
+
+        template <typename T>
+        struct Lenient {
+            T value{};
+        };
+
+        template <typename T>
+        struct Arg<Lenient<T>> {
+            static constexpr const char* expected = Arg<T>::expected;
+            static Lenient<T> decode(const json::value* v, const Where& where) {
+                try {
+                    return Lenient<T>{Arg<T>::decode(v, where)};
+                } catch (const std::runtime_error&) {
+                    return Lenient<T>{};
+                }
+            }
+        };
+
+        template <typename T>
+        struct Arg<Lenient<std::vector<T>>> {
+            static constexpr const char* expected = "array";
+            static Lenient<std::vector<T>> decode(const json::value* v, const Where& where) {
+                Lenient<std::vector<T>> out;
+                if (v == nullptr || !v->is_array()) return out;
+                for (const json::value& item : v->get_array()) {
+                    try {
+                        out.value.push_back(Arg<T>::decode(&item, where));
+                    } catch (const std::runtime_error&) { }
+                }
+                return out;
+            }
+        };
+
+        // Positional argument i. A lone non-array request is its own first argument.
+        inline const json::value* slot(const json::value& req, size_t i) {
+            if (req.is_array()) {
+                const json::array& args = req.get_array();
+                return (i < args.size()) ? &args[i] : nullptr;
+            }
+            return (i == 0 && !req.is_null()) ? &req : nullptr;
+        }
+
+        template <typename Sig>
+        struct Signature;
+
+        template <typename Ret, typename... Params>
+        struct Signature<Ret(Params...)> {
+            using Return = Ret;
+
+            template <typename Fn>
+            static json::value call(const std::string& binding, Fn& fn, const json::value& req) {
+                return callWith(binding, fn, req, std::index_sequence_for<Params...>{});
+            }
+
+            private:
+                // References into the request stay references, everything else is held by value
+                template <typename P>
+                using Held = std::conditional_t<
+                    std::is_same_v<P, const json::value&> || std::is_same_v<P, const json::object&> || std::is_same_v<P, const json::array&>,
+                    P, std::decay_t<P>>;
+
+                template <typename Fn, size_t... I>
+                static json::value callWith(const std::string& binding, Fn& fn, const json::value& req, std::index_sequence<I...>) {
+                    (void)binding;
+                    (void)req;
+                    // Braced initialization decodes (and reports errors) left to right
+                    std::tuple<Held<Params>...> args{Arg<Held<Params>>::decode(slot(req, I), Where{binding, I})...};
+                    if constexpr (std::is_void_v<Ret>) {
+                        std::apply(fn, std::move(args));
+                        return json::value(nullptr);
+                    } else if constexpr (std::is_constructible_v<json::value, Ret>) {
+                        return json::value(std::apply(fn, std::move(args)));
+                    } else {
+                        return json::value_from(std::apply(fn, std::move(args)));
+                    }
+                }
+        };
+    };
+};
@@ -33,6 +33,11 @@
 #include <stdexcept>
 
 namespace RenWeb {
+    namespace BindingArgs {
+        template <typename Sig>
+        struct Signature;
+    }
+
     template <typename Key, typename RetType, typename... ParamTypes>
     class CallbackManager {
         private: 
@@ -44,6 +49,14 @@ namespace RenWeb {
                 this->callbacks[key] = callback;
                 return this;
             }
+            // Typed registration: add<bool(std::string_view, WriteOpts)>(key, fn).
+            // Arguments are unpacked and checked per BindingArgs; include binding_args.hpp where this is used.
+            template <typename Sig, typename Fn>
+            CallbackManager* add(const Key& key, Fn fn) {
+                return this->add(key, std::function<RetType(ParamTypes...)>([key, fn](ParamTypes... args) mutable -> RetType {
+                    return BindingArgs::Signature<Sig>::call(key, fn, args...);
+                }));
+            }
             CallbackManager* remove(const Key& key) {
                 if (this->callbacks.find(key) != this->callbacks.end()) {
                     this->callbacks[key].clear();
@@ -0,0 +1,375 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include "../interfaces/Ilogger.hpp"
+#include "../interfaces/Iprocess_manager.hpp"
+#include "task_manager.hpp"
+#include <boost/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace json = boost::json;
+
+namespace RenWeb {
+    /* Cached view of the other RenWeb processes listed in the registry.
+     * A background thread keeps it current: registry changes are probed as they
+     * land, dead PIDs are evicted, and a full re-probe runs once a reader finds
+     * the cache older than its TTL. Only the very first snapshot waits on probes. */
+    class PeerDirectory {
+        public:
+            using Clock = std::chrono::steady_clock;
+            using Registry = std::function<json::array()>;
+            using Probe = std::function<json::object(const json::object& entry)>;
+            using Liveness = std::function<bool(Pid pid)>;
+            using ChangeHandler = std::function<void(uint64_t generation, const json::array& added, const json::array& removed)>;
+            struct Options {
+                std::chrono::milliseconds ttl{2000};
+                std::chrono::milliseconds deadline{1500};
+                std::chrono::milliseconds poll{1000};
+                size_t probe_threads = 4;
+                uint32_t miss_limit = 2;
+            };
+        private:
+            struct Peer {
+                json::object entry;
+                json::object info;
+                Clock::time_point seen;
+                uint32_t misses = 0;
+            };
+            struct Batch {
+                std::mutex mtx;
+                std::condition_variable cv;
+                size_t remaining = 0;
+                std::map<Pid, json::object> results;
+            };
+            std::shared_ptr<ILogger> logger;
+            const std::filesystem::path registry_path;
+            const Registry read_registry;
+            const Probe probe;
+            const Liveness is_alive;
+            const ChangeHandler on_change;
+            const Options opts;
+            const Pid self;
+
+            std::unique_ptr<TaskManager> probes;
+            std::thread refresher;
+            std::mutex mtx;
+            std::condition_variable wake;
+            std::condition_variable published;
+            bool stopping = false;
+            bool refresh_requested = true;
+            bool populated = false;
+            std::map<Pid, Peer> peers;
+            std::filesystem::file_time_type registry_mtime{};
+            Clock::time_point refreshed_at{};
+
+            uint64_t generation = 0;
+            uint64_t refreshes = 0;
+            uint64_t full_refreshes = 0;
+            uint64_t probes_sent = 0;
+            uint64_t probe_failures = 0;
+            uint64_t probe_timeouts = 0;
+            uint64_t evictions = 0;
+            uint64_t stale_reads = 0;
+            double last_refresh_ms = 0;
+
+            void run() {
+                std::unique_lock<std::mutex> lock(this->mtx);
+                while (!this->stopping) {
+                    this->wake.wait_for(lock, this->opts.poll, [this]() { return this->stopping || this->refresh_requested; });
+                    if (this->stopping) break;
+                    const bool full = this->refresh_requested;
+                    this->refresh_requested = false;
+                    lock.unlock();
+                    try {
+                        this->refresh(full);
+                    } catch (const std::exception& e) {
+                        this->logger->error("[proc] Peer refresh failed: " + std::string(e.what()));
+                    }
+                    lock.lock();
+                }
+            }
+
+            // Probes every registry entry when full, otherwise only entries that are new or re-registered
+            void refresh(bool full) {
+                const auto started = Clock::now();
+                std::error_code ec;
+                auto mtime = std::filesystem::last_write_time(this->registry_path, ec);
+                if (ec) mtime = std::filesystem::file_time_type{};
+
+                std::map<Pid, json::object> wanted;
+                std::vector<Pid> dead;
+                json::array added;
+                json::array removed;
+                bool registry_changed = full;
+                {
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    registry_changed = registry_changed || mtime != this->registry_mtime;
+                    this->registry_mtime = mtime;
+                }
+                if (registry_changed) {
+                    std::map<Pid, json::object> entries;
+                    for (const auto& entry : this->read_registry()) {
+                        if (!entry.is_object()) continue;
+                        const auto& obj = entry.as_object();
+                        if (!obj.contains("pid") || !obj.at("pid").is_int64() || !obj.contains("url")) continue;
+                        const Pid pid = static_cast<Pid>(obj.at("pid").as_int64());
+                        if (pid != this->self) entries[pid] = obj;
+                    }
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    for (auto it = this->peers.begin(); it != this->peers.end();) {
+                        if (entries.count(it->first) == 0) {
+                            removed.push_back(it->first);
+                            it = this->peers.erase(it);
+                        } else {
+                            ++it;
+                        }
+                    }
+                    for (auto& [pid, entry] : entries) {
+                        auto peer = this->peers.find(pid);
+                        if (full || peer == this->peers.end() || peer->second.entry != entry) {
+                            wanted[pid] = std::move(entry);
+                        }
+                    }
+                }
+                {
+                    std::vector<Pid> cached;
+                    {
+                        std::lock_guard<std::mutex> lock(this->mtx);
+                        for (const auto& [pid, peer] : this->peers) {
+                            if (wanted.count(pid) == 0) cached.push_back(pid);
+                        }
+                    }
+                    for (Pid pid : cached) {
+                        if (!this->is_alive(pid)) dead.push_back(pid);
+                    }
+                }
+
+                std::map<Pid, json::object> results;
+                if (!wanted.empty()) {
+                    auto batch = std::make_shared<Batch>();
+                    batch->remaining = wanted.size();
+                    for (const auto& [pid, entry] : wanted) {
+                        const bool queued = this->probes->submit("probe", [batch, probe = this->probe, pid = pid, entry = entry]() {
+                            json::object info;
+                            try {
+                                info = probe(entry);
+                            } catch (...) { }
+                            std::lock_guard<std::mutex> lock(batch->mtx);
+                            batch->results[pid] = std::move(info);
+                            batch->remaining--;
+                            batch->cv.notify_all();
+                        });
+                        if (!queued) {
+                            std::lock_guard<std::mutex> lock(batch->mtx);
+                            batch->remaining--;
+                        }
+                    }
+                    std::unique_lock<std::mutex> lock(batch->mtx);
+                    batch->cv.wait_until(lock, started + this->opts.deadline, [&batch]() { return batch->remaining == 0; });
+                    // Late answers land in the batch after we stop looking and are dropped with it
+                    results = batch->results;
+                }
+
+                std::vector<Pid> unanswered;
+                for (const auto& [pid, entry] : wanted) {
+                    auto result = results.find(pid);
+                    if (result == results.end() || result->second.empty()) unanswered.push_back(pid);
+                }
+                std::vector<Pid> unanswered_dead;
+                for (Pid pid : unanswered) {
+                    if (!this->is_alive(pid)) unanswered_dead.push_back(pid);
+                }
+
+                uint64_t current_generation = 0;
+                bool notify = false;
+                {
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    const auto now = Clock::now();
+                    for (Pid pid : dead) {
+                        if (this->peers.erase(pid) > 0) {
+                            removed.push_back(pid);
+                            this->evictions++;
+                        }
+                    }
+                    this->probes_sent += wanted.size();
+                    for (auto& [pid, entry] : wanted) {
+                        auto result = results.find(pid);
+                        auto peer = this->peers.find(pid);
+                        if (result != results.end() && !result->second.empty()) {
+                            if (peer == this->peers.end() || peer->second.entry != entry) {
+                                added.push_back(result->second);
+                            }
+                            this->peers[pid] = Peer{std::move(entry), std::move(result->second), now, 0};
+                            continue;
+                        }
+                        if (result == results.end()) {
+                            this->probe_timeouts++;
+                        } else {
+                            this->probe_failures++;
+                        }
+                        if (peer == this->peers.end()) continue;
+                        const bool is_dead = std::find(unanswered_dead.begin(), unanswered_dead.end(), pid) != unanswered_dead.end();
+                        if (is_dead || ++peer->second.misses >= this->opts.miss_limit) {
+                            this->peers.erase(peer);
+                            removed.push_back(pid);
+                            this->evictions++;
+                        }
+                    }
+                    const bool changed = !added.empty() || !removed.empty();
+                    if (changed) this->generation++;
+                    // The first fill answers whoever asked for it, so it isn't announced
+                    notify = changed && this->populated;
+                    current_generation = this->generation;
+                    if (full) {
+                        this->refreshed_at = now;
+                        this->full_refreshes++;
+                        this->populated = true;
+                    }
+                    this->refreshes++;
+                    this->last_refresh_ms = std::chrono::duration<double, std::milli>(now - started).count();
+                }
+                this->published.notify_all();
+                if (notify) {
+                    this->logger->debug("[proc] Peer directory generation " + std::to_string(current_generation) + ": "
+                        + std::to_string(added.size()) + " added, " + std::to_string(removed.size()) + " removed");
+                    try {
+                        this->on_change(current_generation, added, removed);
+                    } catch (const std::exception& e) {
+                        this->logger->error("[proc] Peer change handler threw: " + std::string(e.what()));
+                    }
+                }
+            }
+        public:
+            PeerDirectory(
+                std::shared_ptr<ILogger> logger,
+                std::filesystem::path registry_path,
+                Registry read_registry,
+                Probe probe,
+                Liveness is_alive,
+                ChangeHandler on_change,
+                Options opts,
+                Pid self
+            ) : logger(logger),
+                registry_path(std::move(registry_path)),
+                read_registry(std::move(read_registry)),
+                probe(std::move(probe)),
+                is_alive(std::move(is_alive)),
+                on_change(std::move(on_change)),
+                opts(opts),
+                self(self),
+                probes(std::make_unique<TaskManager>(std::max<size_t>(1, opts.probe_threads), 256))
+            {
+                this->refresher = std::thread([this]() { this->run(); });
+            }
+            ~PeerDirectory() {
+                this->stop();
+            }
+            PeerDirectory(const PeerDirectory&) = delete;
+            PeerDirectory& operator=(const PeerDirectory&) = delete;
+
+            // Joins the refresher and the probe pool; probes in flight finish first
+            void stop() {
+                std::unique_ptr<TaskManager> pool;
+                {
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    this->stopping = true;
+                }
+                this->wake.notify_all();
+                this->published.notify_all();
+                if (this->refresher.joinable()) this->refresher.join();
+                {
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    pool = std::move(this->probes);
+                }
+                pool.reset();
+            }
+
+            // Cached peer info ordered by PID. Stale data is returned as is while a refresh runs.
+            json::array snapshot() {
+                std::unique_lock<std::mutex> lock(this->mtx);
+                if (!this->populated) {
+                    this->published.wait_for(lock, this->opts.deadline + std::chrono::milliseconds(250),
+                        [this]() { return this->populated || this->stopping; });
+                } else if (Clock::now() - this->refreshed_at >= this->opts.ttl) {
+                    this->stale_reads++;
+                    if (!this->refresh_requested) {
+                        this->refresh_requested = true;
+                        this->wake.notify_all();
+                    }
+                }
+                json::array processes;
+                processes.reserve(this->peers.size());
+                for (const auto& [pid, peer] : this->peers) {
+                    processes.push_back(peer.info);
+                }
+                return processes;
+            }
+
+            uint64_t getGeneration() {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                return this->generation;
+            }
+
+            json::object getStats() {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                json::object pool = this->probes ? this->probes->getStats() : json::object{};
+                pool.erase("bindings");
+                const double age_ms = this->populated
+                    ? std::chrono::duration<double, std::milli>(Clock::now() - this->refreshed_at).count()
+                    : 0.0;
+                return json::object{
+                    {"peers", this->peers.size()},
+                    {"generation", this->generation},
+                    {"age_ms", age_ms},
+                    {"ttl_ms", this->opts.ttl.count()},
+                    {"deadline_ms", this->opts.deadline.count()},
+                    {"refreshes", this->refreshes},
+                    {"full_refreshes", this->full_refreshes},
+                    {"last_refresh_ms", this->last_refresh_ms},
+                    {"stale_reads", this->stale_reads},
+                    {"probes", this->probes_sent},
+                    {"probe_failures", this->probe_failures},
+                    {"probe_timeouts", this->probe_timeouts},
+                    {"evictions", this->evictions},
+                    {"pool", std::move(pool)}
+                };
+            }
+    };
+};
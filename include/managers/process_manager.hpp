@@ -33,6 +33,7 @@
 #include "../app.hpp"
 #include "../file.hpp"
 #include "../locate.hpp"
+#include "peer_directory.hpp"
 #if __has_include(<boost/process/v1/child.hpp>)
     #include <boost/process/v1/child.hpp>
     #include <boost/process/v1/io.hpp>
@@ -56,8 +57,10 @@
 #include <algorithm>
 #include <map>
 #include <deque>
-#include <future>
 #include <atomic>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <cstdlib>
 
 #if defined(_WIN32)
@@ -128,11 +131,17 @@ namespace RenWeb {
         private:
             std::shared_ptr<ILogger> logger;
             App* app;
+            // Bindings on the task lanes read this while the UI thread creates and detaches children.
+            // Never hold a reference into it past the lock; child::running() reaps, so it goes under the lock too.
             mutable std::map<Pid, Process> child_processes;
+            mutable std::mutex children_mtx;
             std::unique_ptr<boost::asio::io_context> signal_io_context;
             std::unique_ptr<boost::asio::signal_set> signals;
             std::thread signal_thread;
             std::atomic<bool> shutdown_requested{false};
+            mutable std::mutex discovery_mtx;
+            mutable std::shared_ptr<PeerDirectory> discovery;
+            mutable bool discovery_stopped = false;
             
             static std::filesystem::path getRegistryPath();
             static std::filesystem::path getProcessOutputDir(Pid pid);
@@ -140,6 +149,14 @@ namespace RenWeb {
             static json::array readRegistryFile();
             static bool writeRegistryFile(const json::array& entries);
             static void cleanStaleEntries();
+            static std::string getPeerSocket(const json::object& entry);
+            json::object queryPeer(const json::object& entry, time_t timeout_s = 2, time_t timeout_ms = 0) const;
+            std::shared_ptr<PeerDirectory> getPeerDirectory() const;
+            bool isChild(Pid pid) const;
+            // nullopt when pid is not a managed child
+            std::optional<bool> childRunning(Pid pid) const;
+            std::vector<Pid> childPids() const;
+            void notifyPeersChanged(uint64_t generation, const json::array& added, const json::array& removed) const;
             std::filesystem::path searchExecutableInPath(const std::string& executable);
             void setupSignalHandler();
 
@@ -197,9 +214,13 @@ namespace RenWeb {
             std::vector<std::string> listen(Pid pid, int64_t lines = INT64_MAX, bool tail = false) const override;
             void wait(Pid pid) override;
             void waitAll() override;
+            bool waitFor(Pid pid, std::chrono::milliseconds timeout) override;
+            bool waitAllFor(std::chrono::milliseconds timeout) override;
 
             void registerProcess() const override;
             void unregisterProcess() const;
+            void stopPeerDiscovery() override;
+            json::object getDiscoveryStats() const override;
     };
 };
 
@@ -383,6 +404,97 @@ inline /*static*/ void PM::cleanStaleEntries() {
 // ----------------------------------------------------------
 // ----------------------------------------------------------
 
+inline /*static*/ std::string PM::getPeerSocket(const json::object& entry) {
+    const json::value* socket = entry.if_contains("socket");
+    if (socket == nullptr || !socket->is_string() || socket->as_string().empty()) return "";
+    std::string path = socket->as_string().c_str();
+    std::error_code ec;
+    return std::filesystem::exists(path, ec) ? path : "";
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
+// Asks a registered peer who it is, over its IPC socket when it has one and TCP otherwise
+inline json::object PM::queryPeer(const json::object& entry, time_t timeout_s, time_t timeout_ms) const {
+    const std::string socket = PM::getPeerSocket(entry);
+    if (!socket.empty()) {
+        json::object proc_info = this->app->ws->whoAreYou("unix:" + socket, timeout_s, timeout_ms);
+        if (!proc_info.empty()) return proc_info;
+        this->logger->debug("[proc] No answer on " + socket + ", falling back to TCP");
+    }
+    return this->app->ws->whoAreYou(entry.at("url").as_string().c_str(), timeout_s, timeout_ms);
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
+// Started on the first listing so processes that never look for peers never probe them
+inline std::shared_ptr<PeerDirectory> PM::getPeerDirectory() const {
+    std::lock_guard<std::mutex> lock(this->discovery_mtx);
+    if (this->discovery || this->discovery_stopped) return this->discovery;
+
+    PeerDirectory::Options opts;
+    if (this->app->info) {
+        const json::value server_opts = this->app->info->getProperty("server");
+        if (server_opts.is_object()) {
+            const json::object& server = server_opts.as_object();
+            auto read_ms = [&server](const char* key, std::chrono::milliseconds& target) {
+                if (server.contains(key) && server.at(key).is_number()) {
+                    target = std::chrono::milliseconds(std::max<int64_t>(0, server.at(key).to_number<int64_t>()));
+                }
+            };
+            read_ms("peer_cache_ttl_ms", opts.ttl);
+            read_ms("peer_probe_deadline_ms", opts.deadline);
+            if (server.contains("peer_probe_threads") && server.at("peer_probe_threads").is_number()) {
+                opts.probe_threads = static_cast<size_t>(std::max<int64_t>(1, server.at("peer_probe_threads").to_number<int64_t>()));
+            }
+        }
+    }
+    opts.deadline = std::max(opts.deadline, std::chrono::milliseconds(100));
+    const time_t timeout_s = static_cast<time_t>(opts.deadline.count() / 1000);
+    const time_t timeout_ms = static_cast<time_t>(opts.deadline.count() % 1000);
+    this->discovery = std::make_shared<PeerDirectory>(
+        this->logger,
+        PM::getRegistryPath(),
+        []() { return PM::readRegistryFile(); },
+        [this, timeout_s, timeout_ms](const json::object& entry) { return this->queryPeer(entry, timeout_s, timeout_ms); },
+        [](Pid pid) { return PM::isProcessAlive(pid); },
+        [this](uint64_t generation, const json::array& added, const json::array& removed) {
+            this->notifyPeersChanged(generation, added, removed);
+        },
+        opts,
+        this->getPid()
+    );
+    this->logger->debug("[proc] Peer directory started (ttl " + std::to_string(opts.ttl.count())
+        + "ms, deadline " + std::to_string(opts.deadline.count()) + "ms)");
+    return this->discovery;
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
+inline void PM::notifyPeersChanged(uint64_t generation, const json::array& added, const json::array& removed) const {
+    if (!this->app || !this->app->w) return;
+    const std::string event = json::serialize(json::object{
+        {"generation", generation},
+        {"added", added},
+        {"removed", removed}
+    });
+    const std::string script =
+        "(async () => {"
+        "  if (typeof window.renweb?.onProcessesChanged === 'function') await window.renweb.onProcessesChanged(" + event + ");"
+        "})().catch(function(e) { console.error('[renweb] onProcessesChanged error:', e); });";
+    this->app->w->queue_eval(script);
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
 inline json::object PM::buildProcessInfo(
     Pid pid, 
     Pid ppid, 
@@ -497,11 +609,9 @@ inline json::object PM::dumpSystemProcess(Pid pid) const {
     }
         
     // Check if this is a managed child process and get actual running state
-    bool is_child = (this->child_processes.find(pid) != this->child_processes.end());
-    bool is_running = true;
-    if (is_child) {
-        is_running = this->child_processes.at(pid).process.running();
-    }
+    const std::optional<bool> child_running = this->childRunning(pid);
+    bool is_child = child_running.has_value();
+    bool is_running = child_running.value_or(true);
     
     return buildProcessInfo(pid, parent_pid, name, exe_path, args,
                            is_background,
@@ -551,11 +661,9 @@ inline json::object PM::dumpSystemProcess(Pid pid) const {
     }
         
     // Check if this is a managed child process and get actual running state
-    bool is_child = (this->child_processes.find(pid) != this->child_processes.end());
-    bool is_running = true;
-    if (is_child) {
-        is_running = this->child_processes.at(pid).process.running();
-    }
+    const std::optional<bool> child_running = this->childRunning(pid);
+    bool is_child = child_running.has_value();
+    bool is_running = child_running.value_or(true);
     
     return buildProcessInfo(pid, ppid, name, exe_path, args,
                            is_background,
@@ -652,11 +760,9 @@ inline json::object PM::dumpSystemProcess(Pid pid) const {
     }
     
  // check if child
-    bool is_child = (this->child_processes.find(pid) != this->child_processes.end());
-    bool is_running = true;
-    if (is_child) {
-        is_running = this->child_processes.at(pid).process.running();
-    }
+    const std::optional<bool> child_running = this->childRunning(pid);
+    bool is_child = child_running.has_value();
+    bool is_running = child_running.value_or(true);
     
     return buildProcessInfo(pid, ppid, name, exe_path, args,
                            is_background,
@@ -692,11 +798,10 @@ inline json::object PM::dumpRenWebProcess(Pid pid) const {
         Pid entry_pid = static_cast<Pid>(obj.at("pid").as_int64());
         if (entry_pid != pid) continue;
         
-        std::string url = obj.at("url").as_string().c_str();
-        json::object proc_info = this->app->ws->whoAreYou(url);
+        json::object proc_info = this->queryPeer(obj);
         
         if (!proc_info.empty()) {
-            proc_info["is_child"] = (this->child_processes.find(pid) != this->child_processes.end());
+            proc_info["is_child"] = this->isChild(pid);
             return proc_info;
         }
         
@@ -722,6 +827,7 @@ inline PM::ProcessManager(std::shared_ptr<ILogger> logger, App* app)
 // ----------------------------------------------------------
 
 inline PM::~ProcessManager() {
+    this->stopPeerDiscovery();
     if (this->signal_io_context) {
         this->signal_io_context->stop();
     }
@@ -731,6 +837,7 @@ inline PM::~ProcessManager() {
     
     this->unregisterProcess();
     
+    // Unlocked: the task lanes that read child_processes are torn down before the process manager
     for (auto& [pid, child_info] : this->child_processes) {
         if (child_info.process.running()) {
             if (child_info.is_detachable) {
@@ -782,13 +889,15 @@ inline PM::~ProcessManager() {
 inline json::object PM::dumpProcess(Pid pid) const {
     if (pid == this->getPid()) {
         return dumpCurrentProcess();
-    } else if (this->child_processes.find(pid) != this->child_processes.end()) {
-        const auto& child = this->child_processes.at(pid);
-        if (child.is_renweb) {
-            return dumpRenWebProcess(pid);
-        } else {
-            return dumpSystemProcess(pid);
-        }
+    }
+    std::optional<bool> child_is_renweb;
+    {
+        std::lock_guard<std::mutex> lock(this->children_mtx);
+        auto it = this->child_processes.find(pid);
+        if (it != this->child_processes.end()) child_is_renweb = it->second.is_renweb;
+    }
+    if (child_is_renweb.has_value()) {
+        return *child_is_renweb ? dumpRenWebProcess(pid) : dumpSystemProcess(pid);
     }
     
     json::object process = dumpRenWebProcess(pid);
@@ -810,6 +919,7 @@ inline json::object PM::dumpCurrentProcess() const {
         proc["args"] = json::array(this->app->orig_args.begin(), this->app->orig_args.end());
         proc["renweb"] = true;
         proc["url"] = this->app->ws->getURL();
+        proc["socket"] = this->app->ws->getSocketPath();
         if (this->app->config) {
             proc["page"] = this->app->config->current_page;
         }
@@ -832,51 +942,22 @@ inline json::array PM::dumpRenWebProcesses() const {
         return json::array();
     }
     
-    json::array registry = PM::readRegistryFile();
-    this->logger->debug("[proc] Found " + std::to_string(registry.size()) + " RenWeb processes in registry");
-    
     json::array processes;
-    std::vector<std::future<json::object>> futures;
-    futures.reserve(registry.size());
-    
-    for (const auto& entry : registry) {
-        if (!entry.is_object()) continue;
-        
-        const auto& obj = entry.as_object();
-        if (!obj.contains("pid") || !obj.contains("url")) continue;
-        
-        Pid pid = static_cast<Pid>(obj.at("pid").as_int64());
-        std::string url = obj.at("url").as_string().c_str();
-        
-        if (pid == this->getPid()) {
-            processes.push_back(this->dumpCurrentProcess());
-            continue;
-        }
-        
-        this->logger->trace("[proc] Querying " + url + " for PID " + std::to_string(pid));
-        
-        futures.push_back(std::async(std::launch::async, [this, url, pid]() -> json::object {
-            json::object proc_info = this->app->ws->whoAreYou(url);
-            
-            if (!proc_info.empty()) {
-                this->logger->debug("[proc] Got details from " + url);
-                proc_info["is_child"] = (this->child_processes.find(pid) != this->child_processes.end());
-                return proc_info;
-            } else {
-                this->logger->trace("[proc] No response from " + url);
+    processes.push_back(this->dumpCurrentProcess());
+
+    std::shared_ptr<PeerDirectory> directory = this->getPeerDirectory();
+    if (directory) {
+        for (auto& peer : directory->snapshot()) {
+            json::object& proc_info = peer.as_object();
+            const json::value* pid = proc_info.if_contains("pid");
+            if (pid != nullptr && pid->is_int64()) {
+                proc_info["is_child"] = this->isChild(static_cast<Pid>(pid->as_int64()));
             }
-            return json::object();
-        }));
-    }
-    
-    for (auto& future : futures) {
-        json::object result = future.get();
-        if (!result.empty()) {
-            processes.push_back(result);
+            processes.push_back(std::move(peer));
         }
     }
     
-    this->logger->info("[proc] Found " + std::to_string(processes.size()) + " RenWeb processes");
+    this->logger->debug("[proc] Found " + std::to_string(processes.size()) + " RenWeb processes");
     return processes;
 }
 
@@ -885,9 +966,17 @@ inline json::array PM::dumpRenWebProcesses() const {
 // ----------------------------------------------------------
 
 inline json::array PM::dumpChildProcesses() const {
+    // Dumping queries peers and /proc, so only the list is taken under the lock
+    std::vector<std::pair<Pid, bool>> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(this->children_mtx);
+        for (auto& [pid, child] : this->child_processes) {
+            snapshot.emplace_back(pid, child.is_renweb && child.process.running());
+        }
+    }
     json::array children;
-    for (auto& [pid, child] : this->child_processes) {
-        if (child.is_renweb && child.process.running()) {
+    for (const auto& [pid, live_renweb] : snapshot) {
+        if (live_renweb) {
             children.push_back(this->dumpRenWebProcess(pid));
         } else {
             children.push_back(this->dumpSystemProcess(pid));
@@ -900,6 +989,30 @@ inline json::array PM::dumpChildProcesses() const {
 // ----------------------------------------------------------
 // ----------------------------------------------------------
 
+inline bool PM::isChild(Pid pid) const {
+    std::lock_guard<std::mutex> lock(this->children_mtx);
+    return this->child_processes.find(pid) != this->child_processes.end();
+}
+
+inline std::optional<bool> PM::childRunning(Pid pid) const {
+    std::lock_guard<std::mutex> lock(this->children_mtx);
+    auto it = this->child_processes.find(pid);
+    if (it == this->child_processes.end()) return std::nullopt;
+    return it->second.process.running();
+}
+
+inline std::vector<Pid> PM::childPids() const {
+    std::lock_guard<std::mutex> lock(this->children_mtx);
+    std::vector<Pid> pids;
+    pids.reserve(this->child_processes.size());
+    for (const auto& entry : this->child_processes) pids.push_back(entry.first);
+    return pids;
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
 inline json::array PM::dumpSystemProcesses() const {
     json::array system_processes;
 #if defined(_WIN32)
@@ -1359,12 +1472,15 @@ inline json::object PM::createChildProcess(const std::vector<std::string>& args,
 #endif
         }
 
-        this->child_processes.emplace(pid, Process{
-            std::move(proc),
-            is_detachable,
-            is_renweb,
-            std::move(out_file)
-        });
+        {
+            std::lock_guard<std::mutex> lock(this->children_mtx);
+            this->child_processes.emplace(pid, Process{
+                std::move(proc),
+                is_detachable,
+                is_renweb,
+                std::move(out_file)
+            });
+        }
 
 #if defined(_WIN32)
         {
@@ -1378,6 +1494,7 @@ inline json::object PM::createChildProcess(const std::vector<std::string>& args,
                     AssignProcessToJobObject(hJob, hProc);
                     CloseHandle(hProc);
                 }
+                std::lock_guard<std::mutex> lock(this->children_mtx);
                 this->child_processes.at(pid).job_handle = hJob;
             }
         }
@@ -1471,6 +1588,7 @@ inline void PM::kill(Pid pid, int32_t sig) {
         #define SIGKILL 9
     #endif
 
+    std::lock_guard<std::mutex> lock(this->children_mtx);
     auto it = this->child_processes.find(pid);
     const bool is_managed = (it != this->child_processes.end());
 
@@ -1538,6 +1656,7 @@ inline void PM::kill(Pid pid, int32_t sig) {
 // ----------------------------------------------------------
 
 inline void PM::detach(Pid pid) {
+    std::lock_guard<std::mutex> lock(this->children_mtx);
     auto it = this->child_processes.find(pid);
     if (it == this->child_processes.end()) {
         this->logger->warn("[proc] detach: PID " + std::to_string(pid) + " is not a managed child process");
@@ -1572,7 +1691,9 @@ inline void PM::send(Pid pid, const json::value& message) {
         return;
     }
     if (this->app && this->app->ws) {
-        this->app->ws->sendMessage(proc["url"].as_string().c_str(), message);
+        // dumpRenWebProcess just reached the peer, so its socket is live if it reported one
+        const std::string socket = PM::getPeerSocket(proc);
+        this->app->ws->sendMessage(socket.empty() ? std::string(proc["url"].as_string().c_str()) : "unix:" + socket, message);
     } else {
         this->logger->error("[proc] App and/or Webserver are null. Cannot send message to PID " + std::to_string(pid));
     }
@@ -1587,6 +1708,7 @@ inline std::vector<std::string> PM::listen(Pid pid, int64_t lines, bool tail) co
     if (this->getPid() == pid) {
         file_path = Locate::currentDirectory() / "log.txt";
     } else {
+        std::lock_guard<std::mutex> lock(this->children_mtx);
         auto it = this->child_processes.find(pid);
         if (it != this->child_processes.end() && !it->second.out_file.getPath().empty()) {
             file_path = it->second.out_file.getPath();
@@ -1670,15 +1792,13 @@ inline std::vector<std::string> PM::listen(Pid pid, int64_t lines, bool tail) co
 // ----------------------------------------------------------
 
 inline void PM::wait(Pid pid) {
-    auto it = this->child_processes.find(pid);
-    if (it != this->child_processes.end()) {
-        auto& proc = it->second.process;
-        if (proc.running()) {
-            this->logger->info("[proc] Waiting for child process PID " + std::to_string(pid));
-            proc.wait();
-        }
+    if (this->childRunning(pid).value_or(false)) {
+        // Polled rather than child::wait() so the lock is never held while blocking
+        this->logger->info("[proc] Waiting for child process PID " + std::to_string(pid));
+        while (!this->waitFor(pid, std::chrono::seconds(1))) { }
         return;
     }
+    if (this->isChild(pid)) return;
     
 #if defined(_WIN32)
     HANDLE hProcess = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(pid));
@@ -1703,8 +1823,8 @@ inline void PM::wait(Pid pid) {
 // ----------------------------------------------------------
 
 inline void PM::waitAll() {
-    for (auto& [pid, child] : this->child_processes) {
-        if (child.process.running()) {
+    for (const Pid pid : this->childPids()) {
+        if (this->childRunning(pid).value_or(false)) {
             this->wait(pid);
         }
     }
@@ -1714,6 +1834,54 @@ inline void PM::waitAll() {
 // ----------------------------------------------------------
 // ----------------------------------------------------------
 
+// Polls instead of blocking so a worker running this can give up when the app shuts down
+inline bool PM::waitFor(Pid pid, std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    const auto poll = std::chrono::milliseconds(20);
+    // Looked up again on every poll: the UI thread may detach the child meanwhile
+    std::optional<bool> running = this->childRunning(pid);
+    while (running.value_or(false)) {
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(poll);
+        running = this->childRunning(pid);
+    }
+    if (running.has_value()) return true;
+    // Not, or no longer, a managed child
+#if defined(_WIN32)
+    HANDLE hProcess = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(pid));
+    if (!hProcess) return true;
+    const auto left = std::max(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()), std::chrono::milliseconds(0));
+    const DWORD result = WaitForSingleObject(hProcess, static_cast<DWORD>(left.count()));
+    CloseHandle(hProcess);
+    return result != WAIT_TIMEOUT;
+#else
+    while (::kill(pid, 0) == 0) {
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(poll);
+    }
+    return true;
+#endif
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
+inline bool PM::waitAllFor(std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (const Pid pid : this->childPids()) {
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (this->childRunning(pid).value_or(false) && !this->waitFor(pid, std::max(left, std::chrono::milliseconds(0)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
 inline void PM::registerProcess() const /*override*/ {
     if (!this->app || !this->app->ws) {
         this->logger->warn("[proc] Cannot register process: app/webserver not initialized");
@@ -1726,6 +1894,7 @@ inline void PM::registerProcess() const /*override*/ {
         json::object entry;
         entry["pid"] = this->getPid();
         entry["url"] = this->app->ws->getURL();
+        entry["socket"] = this->app->ws->getSocketPath();
         entry["timestamp"] = std::chrono::system_clock::now().time_since_epoch().count();
         
         json::array new_entries;
@@ -1787,6 +1956,36 @@ inline void PM::unregisterProcess() const {
 // ----------------------------------------------------------
 // ----------------------------------------------------------
 
+inline void PM::stopPeerDiscovery() /*override*/ {
+    std::shared_ptr<PeerDirectory> directory;
+    {
+        std::lock_guard<std::mutex> lock(this->discovery_mtx);
+        this->discovery_stopped = true;
+        directory = std::move(this->discovery);
+    }
+    if (directory) {
+        directory->stop();
+        this->logger->debug("[proc] Peer directory stopped");
+    }
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
+inline json::object PM::getDiscoveryStats() const /*override*/ {
+    std::shared_ptr<PeerDirectory> directory;
+    {
+        std::lock_guard<std::mutex> lock(this->discovery_mtx);
+        directory = this->discovery;
+    }
+    return directory ? directory->getStats() : json::object{{"peers", 0}, {"generation", 0}};
+}
+
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+// ----------------------------------------------------------
+
 inline void PM::setupSignalHandler() {
     this->signal_io_context = std::make_unique<boost::asio::io_context>();
     this->signals = std::make_unique<boost::asio::signal_set>(*this->signal_io_context, SIGINT, SIGTERM);
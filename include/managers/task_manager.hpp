@@ -0,0 +1,191 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <boost/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace json = boost::json;
+
+namespace RenWeb {
+    /* Bounded worker pool for bindings that shouldn't run on the UI thread.
+     * Tasks are labelled so queue wait and run time can be reported per binding.
+     * Tasks still queued at shutdown run their cancel callback instead, so no caller is left waiting. */
+    class TaskManager {
+        private:
+            using Clock = std::chrono::steady_clock;
+            struct Task {
+                std::string name;
+                std::function<void()> fn;
+                std::function<void()> cancel;
+                Clock::time_point queued;
+            };
+            struct Latency {
+                uint64_t count = 0;
+                double total_ms = 0;
+                double max_ms = 0;
+            };
+            std::vector<std::thread> workers;
+            std::deque<Task> tasks;
+            std::mutex mtx;
+            std::condition_variable cv;
+            const size_t max_queue;
+            bool stopping = false;
+
+            size_t active = 0;
+            size_t max_depth = 0;
+            uint64_t submitted = 0;
+            uint64_t completed = 0;
+            uint64_t rejected = 0;
+            uint64_t cancelled = 0;
+            Latency wait_latency;
+            std::map<std::string, Latency> run_latency;
+
+            static double elapsedMs(Clock::time_point since, Clock::time_point until) {
+                return std::chrono::duration<double, std::milli>(until - since).count();
+            }
+            static void record(Latency& latency, double ms) {
+                latency.count++;
+                latency.total_ms += ms;
+                latency.max_ms = std::max(latency.max_ms, ms);
+            }
+            static json::object toJson(const Latency& latency) {
+                return json::object{
+                    {"count", latency.count},
+                    {"avg_ms", (latency.count > 0) ? latency.total_ms / static_cast<double>(latency.count) : 0.0},
+                    {"max_ms", latency.max_ms}
+                };
+            }
+            void work() {
+                while (true) {
+                    Task task;
+                    {
+                        std::unique_lock<std::mutex> lock(this->mtx);
+                        this->cv.wait(lock, [this]() { return this->stopping || !this->tasks.empty(); });
+                        if (this->stopping) return;
+                        task = std::move(this->tasks.front());
+                        this->tasks.pop_front();
+                        this->active++;
+                        record(this->wait_latency, elapsedMs(task.queued, Clock::now()));
+                    }
+                    const auto started = Clock::now();
+                    try {
+                        task.fn();
+                    } catch (...) { }
+                    const double run_ms = elapsedMs(started, Clock::now());
+                    {
+                        std::lock_guard<std::mutex> lock(this->mtx);
+                        this->active--;
+                        this->completed++;
+                        record(this->run_latency[task.name], run_ms);
+                    }
+                }
+            }
+        public:
+            TaskManager(size_t num_workers = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 4), size_t max_queue = 64)
+                : max_queue(max_queue)
+            {
+                for (size_t i = 0; i < num_workers; i++) {
+                    this->workers.emplace_back([this]() { this->work(); });
+                }
+            }
+            ~TaskManager() {
+                std::deque<Task> dropped;
+                {
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    this->stopping = true;
+                    dropped.swap(this->tasks);
+                    this->cancelled += dropped.size();
+                }
+                this->cv.notify_all();
+                for (auto& task : dropped) {
+                    try {
+                        if (task.cancel) task.cancel();
+                    } catch (...) { }
+                }
+                for (auto& worker : this->workers) {
+                    if (worker.joinable()) worker.join();
+                }
+            }
+            TaskManager(const TaskManager&) = delete;
+            TaskManager& operator=(const TaskManager&) = delete;
+
+            // Returns false when the queue is full or the pool is shutting down.
+            // cancel runs instead of fn if the pool shuts down before fn starts.
+            bool submit(const std::string& name, std::function<void()> fn, std::function<void()> cancel = nullptr) {
+                {
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    if (this->stopping || this->tasks.size() >= this->max_queue) {
+                        this->rejected++;
+                        return false;
+                    }
+                    this->tasks.push_back(Task{name, std::move(fn), std::move(cancel), Clock::now()});
+                    this->submitted++;
+                    this->max_depth = std::max(this->max_depth, this->tasks.size());
+                }
+                this->cv.notify_one();
+                return true;
+            }
+            // For long-running tasks to poll so shutdown does not wait on them
+            bool isStopping() {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                return this->stopping;
+            }
+            json::object getStats() {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                json::object bindings;
+                for (const auto& [name, latency] : this->run_latency) {
+                    bindings[name] = toJson(latency);
+                }
+                return json::object{
+                    {"workers", this->workers.size()},
+                    {"queue_depth", this->tasks.size()},
+                    {"max_queue_depth", this->max_depth},
+                    {"queue_capacity", this->max_queue},
+                    {"active", this->active},
+                    {"submitted", this->submitted},
+                    {"completed", this->completed},
+                    {"rejected", this->rejected},
+                    {"cancelled", this->cancelled},
+                    {"queue_wait", toJson(this->wait_latency)},
+                    {"bindings", std::move(bindings)}
+                };
+            }
+    };
+};
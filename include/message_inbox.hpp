@@ -0,0 +1,79 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <atomic>
+#include <boost/json.hpp>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace json = boost::json;
+
+// Bounded inbox for messages from other RenWeb processes. Each message gets a sequence
+// number from one atomic counter and lands in its own ring slot, so concurrent writers only
+// contend when they hit the same slot. Readers page through with a cursor instead of
+// copying the whole history. Old messages are dropped once either limit is exceeded.
+namespace RenWeb {
+    class MessageInbox {
+        public:
+            // max_messages must be at least 1; max_bytes 0 disables the byte limit
+            MessageInbox(size_t max_messages, size_t max_bytes);
+            MessageInbox(const MessageInbox&) = delete;
+            MessageInbox& operator=(const MessageInbox&) = delete;
+
+            // Stores message under the next sequence number (starting at 1) and returns it.
+            // Objects get a "seq" key.
+            uint64_t push(json::value message, size_t bytes);
+            // Up to max messages with seq > since_seq, oldest first, plus the cursor to pass next time:
+            // { messages, last_seq, first_seq, dropped }
+            json::object read(uint64_t since_seq, size_t max) const;
+            json::object getStats() const;
+            // Highest sequence number handed out so far (its message may still be being stored)
+            uint64_t getNewestSeq() const;
+        private:
+            struct Slot {
+                mutable std::mutex mtx;
+                uint64_t seq = 0;
+                // Null when the slot is empty or its message was dropped for the byte limit
+                std::shared_ptr<const json::value> message;
+                size_t bytes = 0;
+            };
+            const size_t capacity;
+            const size_t max_bytes;
+            std::unique_ptr<Slot[]> slots;
+            std::atomic<uint64_t> next_seq{0};
+            // Lowest sequence number that may still be retained
+            std::atomic<uint64_t> floor_seq{1};
+            std::atomic<size_t> bytes{0};
+            std::atomic<uint64_t> dropped{0};
+
+            void trimBytes(uint64_t newest);
+    };
+};
@@ -30,14 +30,18 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <sstream>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <type_traits>
 #include <boost/json/value.hpp>
 #include <boost/json/array.hpp>
 #include <boost/json/object.hpp>
 #include <boost/json/parse.hpp>
+#include "encoding.hpp"
 
 namespace json = boost::json;
 namespace RenWeb {
@@ -90,15 +94,8 @@ namespace RenWeb {
             }
             
             json::value processInput(const json::object& input) {
-                if (input.contains("__encoding_type__") && input.at("__encoding_type__").is_string() && input.contains("__val__")) {
-                    if (input.at("__encoding_type__").as_string() == "base64" && input.at("__val__").is_array()) {
-                        std::stringstream ss;
-                        for (const auto& item : input.at("__val__").as_array()) {
-                            ss << char(item.as_int64());
-                        }
-                        return json::value(ss.str());
-                    }
-                    throw std::runtime_error("[plugin] Unsupported encoding type in processInput(json::object): " + std::string(input.at("__encoding_type__").as_string()));
+                if (Encoding::isEncoded(input)) {
+                    return json::value(Encoding::decodeString(input));
                 } else {
                     json::object processed_input;
                     for (const auto& item : input) {
@@ -121,7 +118,7 @@ namespace RenWeb {
                 json::object formatted_output_obj;
                 switch (output.kind()) {
                     case json::kind::string:
-                        return this->formatOutput(output.as_string().c_str());
+                        return Encoding::encodeString(std::string_view(output.as_string().data(), output.as_string().size()));
                     case json::kind::int64:
                     case json::kind::uint64:
                     case json::kind::double_:
@@ -134,6 +131,9 @@ namespace RenWeb {
                         }
                         return formatted_output_arr;
                     case json::kind::object:
+                        if (Encoding::isEncoded(output.as_object())) {
+                            return output;
+                        }
                         for (const auto& item : output.as_object()) {
                             formatted_output_obj[item.key()] = this->formatOutput(item.value());
                         }
@@ -144,15 +144,7 @@ namespace RenWeb {
             }
             
             json::value formatOutput(const std::string& output) {
-                json::object formatted_output = {
-                    {"__encoding_type__", "base64"},
-                    {"__val__", json::array()}
-                };
-                json::array& val_array = formatted_output["__val__"].as_array();
-                for (const char& ch : output) {
-                    val_array.push_back(static_cast<int64_t>(ch));
-                }
-                return formatted_output;
+                return Encoding::encodeString(output);
             }
             
             template <typename T>
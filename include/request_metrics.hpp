@@ -0,0 +1,101 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <boost/json.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace json = boost::json;
+
+// Lock-free request counters for the embedded web server. Every field is a relaxed
+// atomic, so recording from httplib worker threads never blocks or allocates.
+namespace RenWeb {
+    // Log-linear histogram over microseconds: values below 8 get exact buckets, every
+    // power of two above that is split into 8 linear sub-buckets (<= 12.5% error).
+    class LatencyHistogram {
+        public:
+            static constexpr unsigned SUB_BITS = 3;
+            static constexpr unsigned SUB_BUCKETS = 1u << SUB_BITS;
+            // Values at or above 2^MAX_EXPONENT us (~38 minutes) land in the last bucket
+            static constexpr unsigned MAX_EXPONENT = 31;
+            static constexpr size_t BUCKETS = (MAX_EXPONENT - SUB_BITS + 1) * SUB_BUCKETS;
+
+            static size_t bucketOf(uint64_t us);
+            // Smallest value that lands in the bucket after index
+            static uint64_t upperBound(size_t index);
+
+            void record(uint64_t us);
+            uint64_t getCount() const;
+            uint64_t getSum() const;
+            uint64_t getMax() const;
+            // Upper edge of the bucket holding the q-th quantile (0..1)
+            uint64_t quantile(double q) const;
+            // Count of samples below 2^exponent us, which is always a bucket edge
+            uint64_t countBelow(unsigned exponent) const;
+        private:
+            std::array<std::atomic<uint64_t>, BUCKETS> buckets{};
+            std::atomic<uint64_t> count{0};
+            std::atomic<uint64_t> sum{0};
+            std::atomic<uint64_t> max{0};
+    };
+
+    class RequestMetrics {
+        public:
+            enum class Route : size_t { File, IpcGet, IpcPost, Blob, Events, Metrics, Error, Other, Count };
+            static constexpr size_t ROUTES = static_cast<size_t>(Route::Count);
+            static constexpr int MIN_STATUS = 100;
+            static constexpr int MAX_STATUS = 599;
+
+            static const char* routeName(Route route);
+
+            void record(Route route, int status, uint64_t bytes, std::chrono::steady_clock::duration elapsed);
+            void recordUntimed(Route route, int status, uint64_t bytes);
+            json::object toJson() const;
+            // Prometheus text exposition format (version 0.0.4)
+            std::string toPrometheus() const;
+        private:
+            struct RouteMetrics {
+                std::atomic<uint64_t> requests{0};
+                std::atomic<uint64_t> bytes{0};
+                // 1xx..5xx
+                std::array<std::atomic<uint64_t>, 5> status_classes{};
+                LatencyHistogram latency;
+            };
+            std::array<RouteMetrics, ROUTES> routes{};
+            std::array<std::atomic<uint64_t>, MAX_STATUS - MIN_STATUS + 1> statuses{};
+            std::atomic<uint64_t> untimed{0};
+            const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+
+            void count(Route route, int status, uint64_t bytes);
+    };
+};
@@ -0,0 +1,60 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <boost/json.hpp>
+
+namespace json = boost::json;
+
+namespace RenWeb {
+    // Single-pass codec for the BIND_* bridge.
+    //
+    // decode() runs a SAX-style parse that builds the argument tree straight
+    // into the given storage and collapses wire-format string objects
+    // ({ "__encoding_type__", "__val__" }, see encoding.hpp) as each object
+    // closes, so there is no second walk to rebuild the tree.
+    //
+    // encode() serializes a callback result, writing every string as its
+    // wire-format object on the fly instead of building an encoded copy of the
+    // tree first.
+    //
+    // Bindings allocate everything for one call out of makeArena(), which is
+    // released in one shot when the last reference to it goes away. The arena
+    // is reference counted, so a callback that keeps a copy of an argument
+    // keeps the arena alive rather than dangling.
+    namespace Transcoder {
+        json::storage_ptr makeArena(std::size_t request_size);
+        json::value decode(std::string_view wire, json::storage_ptr sp = {});
+        void encode(const json::value& value, std::string& out);
+        std::string encode(const json::value& value);
+    };
+};
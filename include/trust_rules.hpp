@@ -0,0 +1,57 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <boost/json/value.hpp>
+
+namespace json = boost::json;
+
+namespace RenWeb {
+    // info.json "trusted"/"origins" rules, compiled once into hashed lookups.
+    //
+    // A rule is either a URI ("https://app.example.com/anything"), matched on
+    // its lowercased origin, or a bare name ("main", "app.example.com"),
+    // matched against a local page name or a remote page's host. A leading
+    // '!' makes it a deny rule, and a deny always wins over an allow.
+    struct TrustRules {
+        bool present = false;
+        std::unordered_set<std::string> allow_origins;
+        std::unordered_set<std::string> allow_names;
+        std::unordered_set<std::string> deny_origins;
+        std::unordered_set<std::string> deny_names;
+
+        bool denies(const std::string& target) const;
+        bool allows(const std::string& target) const;
+
+        static TrustRules compile(const json::value& rules);
+        static bool isUriLike(const std::string& value);
+    };
+};
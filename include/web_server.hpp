@@ -34,10 +34,23 @@
 #define BUFFER_SIZE 16 * 1024
 
 #include <httplib.h>
+#include "asset_pack.hpp"
+#include "message_inbox.hpp"
+#include "request_metrics.hpp"
 #include "managers/callback_manager.hpp"
 #include "interfaces/Iweb_server.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
 #include <filesystem>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
 
 namespace RenWeb {
     class App;
@@ -56,38 +69,209 @@ namespace RenWeb {
             );
             ~WebServer() override;
             std::string getURL() const override;
+            std::string getSocketPath() const override;
             std::string getBasePath() const override;
+            bool hasAsset(const std::string& target) override;
             void start() override;
             void stop() override;
             bool isURI(const std::string& uri) const override;            
-            const std::vector<json::value>& getMessages() const override;
+            json::object getMessages(uint64_t since_seq, size_t max) const override;
             void sendMessage(const std::string& ip, const json::value& message, time_t timeout_s, time_t timeout_ms) const override;
+            void onDeliveryFailure(DeliveryFailureHandler handler) override;
+            void stopOutbox() override;
             json::object whoAreYou(const std::string& ip, time_t timeout_s, time_t timeout_ms) const override;
+            std::string registerBlob(const std::filesystem::path& path, std::chrono::seconds ttl) override;
+            void releaseBlob(const std::string& token) override;
+            json::object getStats() override;
+            json::object getMetrics() const override;
+            std::string getPrometheusMetrics() const override;
+            void refreshCachePolicy() override;
+            std::string getInitScript() const override;
+            std::string_view getMimeType(const std::filesystem::path& file) const;
         private: 
+            struct Blob {
+                std::filesystem::path path;
+                std::chrono::steady_clock::time_point expires;
+            };
+            // Result of the custom/content/root/backup search. An empty path is a cached 404.
+            struct ResolvedAsset {
+                std::filesystem::path path;
+                std::uintmax_t size = 0;
+                std::filesystem::file_time_type mtime;
+                std::string mime;
+                std::time_t modified = 0;
+                std::chrono::steady_clock::time_point resolved_at;
+                // Content-Encoding of this file ("" for identity) and its fresh .br/.gz sidecars, best first
+                std::string encoding;
+                std::vector<ResolvedAsset> encoded;
+                // Set when the bytes live in the asset pack rather than at path
+                std::shared_ptr<const AssetPack> pack;
+                const char* packed = nullptr;
+            };
+            // Read-only mapping of a whole file, shared by every response (and range) that serves it
+            struct MappedFile {
+                const char* data = nullptr;
+                size_t size = 0;
+                std::filesystem::file_time_type mtime;
+                // Kept open so responses can notice the file shrinking underneath the mapping
+                int fd = -1;
+                // Windows file mapping handle
+                void* mapping = nullptr;
+                MappedFile() = default;
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+                ~MappedFile();
+                bool intact(size_t end) const;
+            };
+            class WorkerPool;
+            class PeerOutbox;
+            // Live gauges for the HTTP worker pool; outlives the pools httplib creates on each listen
+            struct PoolStats {
+                std::atomic<size_t> workers{0};
+                std::atomic<size_t> queue_depth{0};
+                std::atomic<size_t> max_queue_depth{0};
+                std::atomic<size_t> busy{0};
+                std::atomic<uint64_t> completed{0};
+                std::atomic<uint64_t> rejected{0};
+                std::atomic<uint64_t> wait_ns_total{0};
+                std::atomic<uint64_t> wait_ns_max{0};
+            };
+            struct CachedAsset {
+                std::shared_ptr<const std::string> data;
+                std::filesystem::file_time_type mtime;
+                std::uintmax_t source_size = 0;
+                std::list<std::string>::iterator lru;
+            };
             std::shared_ptr<ILogger> logger;
             App* app;
             std::filesystem::path base_path;
             std::unique_ptr<RenWeb::CallbackManager<std::string, void, const httplib::Request&, httplib::Response&>> method_callbacks;
             std::unique_ptr<httplib::Server> server;
             std::thread server_thread;
+            // Per-PID Unix domain socket for IPC from sibling processes (POSIX only)
+            std::unique_ptr<httplib::Server> socket_server;
+            std::thread socket_thread;
+            std::filesystem::path socket_path;
             unsigned short port = 0;
             const std::string ip = "127.0.0.1";
-            std::vector<json::value> messages{};
+            size_t http_workers = 0;
+            size_t http_max_queued = 0;
+            size_t keep_alive_max_count = 100;
+            time_t keep_alive_timeout_s = 5;
+            time_t read_timeout_ms = 10000;
+            time_t write_timeout_ms = 10000;
+            PoolStats pool_stats;
+            RequestMetrics request_metrics;
+            bool metrics_endpoint = true;
+            std::string metrics_token;
+            // Outbound messages: one keep-alive client per peer, flushed in batches by a few I/O threads
+            std::shared_ptr<PeerOutbox> outbox;
+            size_t peer_threads = 2;
+            size_t peer_queue_limit = 1024;
+            size_t peer_batch_max = 64;
+            std::vector<DeliveryFailureHandler> delivery_failure_handlers{};
+            mutable std::mutex delivery_failure_mtx;
+            // Set once destruction starts, when the webview may already be gone
+            std::atomic<bool> closing{false};
+            std::unique_ptr<MessageInbox> inbox;
+            size_t inbox_messages = 1024;
+            size_t inbox_bytes = 8 * 1024 * 1024;
+            // Wakes /??events streams when the inbox grows or the server stops
+            std::mutex events_mtx;
+            std::condition_variable events_cv;
+            bool events_closing = false;
+            std::atomic<size_t> event_subscribers{0};
+            // Newest seq the last closing stream handed to the script fallback (under events_mtx)
+            uint64_t events_replayed_seq = 0;
+            // Newest inbox seq when the last page document was served
+            std::atomic<uint64_t> document_seq{0};
+            std::map<std::string, Blob> blobs{};
+            std::mutex blobs_mtx;
             
+            std::unordered_map<std::string, ResolvedAsset> resolved_assets{};
+            std::shared_mutex resolved_assets_mtx;
+            // Bumped by every invalidation, so a resolve that raced one does not cache what it found
+            std::atomic<uint64_t> resolved_assets_generation{0};
+            // Cache-Control compiled on the UI thread; request workers only ever read this snapshot
+            std::shared_ptr<const std::string> cache_control = std::make_shared<const std::string>("no-cache");
+            mutable std::mutex cache_control_mtx;
+            std::atomic<bool> assets_watched{false};
+            std::atomic<bool> stop_asset_watch{false};
+            std::thread asset_watch_thread;
+            std::shared_ptr<const AssetPack> asset_pack;
+            std::mutex asset_pack_mtx;
+            std::atomic<bool> asset_pack_stale{true};
+            std::chrono::steady_clock::time_point asset_pack_checked;
+            std::filesystem::file_time_type asset_pack_seen_mtime;
+            std::uintmax_t asset_pack_seen_size = 0;
+            std::unordered_map<std::string, CachedAsset> asset_cache{};
+            std::list<std::string> asset_cache_lru{};
+            std::mutex asset_cache_mtx;
+            std::size_t asset_cache_bytes = 0;
+            std::size_t asset_cache_budget = 16 * 1024 * 1024;
+            std::size_t asset_cache_max_file = 1024 * 1024;
+            std::atomic<uint64_t> asset_cache_hits{0};
+            std::atomic<uint64_t> asset_cache_misses{0};
+            std::atomic<uint64_t> asset_cache_evictions{0};
+            bool map_large_files = true;
+            std::unordered_map<std::string, std::weak_ptr<MappedFile>> mapped_files{};
+            std::mutex mapped_files_mtx;
+            std::atomic<uint64_t> mapped_file_failures{0};
+            std::atomic<uint64_t> sidecar_responses{0};
+            std::atomic<uint64_t> compressed_responses{0};
+            std::atomic<uint64_t> compressions{0};
+            std::atomic<uint64_t> not_modified_responses{0};
+            // Lowercase suffix (no leading dot) -> MIME type, from info.json "server.mime_types"
+            std::unordered_map<std::string, std::string> mime_overrides{};
+            
+            bool findBlob(const std::string& token, std::filesystem::path& path);
+            bool isSameOriginRequest(const httplib::Request& req) const;
+            bool isMetricsRequestTrusted(const httplib::Request& req) const;
+            void streamEvents(const httplib::Request& req, httplib::Response& res);
+            void closeEventStreams();
+            void releaseEventSubscriber(uint64_t cursor);
+            void recordRequest(const httplib::Request& req, const httplib::Response& res);
+            bool resolveAsset(const std::string& target, ResolvedAsset& asset);
+            void invalidateResolvedAssets();
+            std::string getCacheControl() const;
+            static std::string compileCachePolicy(const json::value& policy);
+            void startAssetWatch();
+            void stopAssetWatch();
+            static std::time_t toTimeT(std::filesystem::file_time_type mtime);
+            std::shared_ptr<const AssetPack> getAssetPack();
+            void findEncodedVariants(ResolvedAsset& asset, const std::string& pack_path);
+            std::shared_ptr<const std::string> findCachedAsset(const std::string& key, const ResolvedAsset& source);
+            void storeCachedAsset(const std::string& key, const ResolvedAsset& source, std::shared_ptr<const std::string> data);
+            std::shared_ptr<const std::string> getCachedAsset(const ResolvedAsset& asset);
+            std::shared_ptr<const std::string> getCompressedAsset(const ResolvedAsset& asset);
+            std::shared_ptr<const MappedFile> getMappedFile(const ResolvedAsset& asset);
             void setHandles();
             void setMethodCallbacks();
+            void startOutbox();
+            json::object getPeerStats();
+            void reportDeliveryFailure(const std::string& peer, const json::value& message, const std::string& error) const;
+            static std::unique_ptr<httplib::Client> makePeerClient(const std::string& address, time_t timeout_s, time_t timeout_ms);
+            void startSocketListener();
+            void stopSocketListener();
+            void serveProcessInfo(const httplib::Request& req, httplib::Response& res);
+            void receiveMessage(const httplib::Request& req, httplib::Response& res);
+            void deliverMessagesByScript(const std::string& body);
             void sendFile(
                 const httplib::Request& req, 
                 httplib::Response& res,
                 const std::filesystem::path& path
             );
+            void sendFile(
+                const httplib::Request& req, 
+                httplib::Response& res,
+                const ResolvedAsset& asset
+            );
             void sendStatus(
                 const httplib::Request& req, 
                 httplib::Response& res, 
                 const httplib::StatusCode& code,
                 const std::string& desc =""
             );
-            std::string getMimeType(const std::filesystem::path& file);
-            static std::map<std::string, std::string> mime_types;            
+            void setMimeOverrides(const json::object& overrides);
     };
 }
\ No newline at end of file
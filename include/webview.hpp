@@ -30,6 +30,8 @@
 
 #include "interfaces/Iwebview.hpp"
 #include "interfaces/Ilogger.hpp"
+#include "eval_queue.hpp"
+#include "event_coalescer.hpp"
 #include <webview/webview.h>
 #include <memory>
 #include <string>
@@ -39,6 +41,9 @@ namespace RenWeb {
     class Webview : public IWebview {
         private:
             std::unique_ptr<webview::webview> webview_impl;
+            // Declared after webview_impl so they are destroyed before the webview they post to
+            std::unique_ptr<EvalQueue> eval_queue;
+            std::unique_ptr<EventCoalescer> events;
             void addWindowCallbacks();
 #if defined(__APPLE__)
             void* _close_observer = nullptr;
@@ -60,15 +65,22 @@ namespace RenWeb {
             void terminate() override;
             void navigate(const std::string& url) override;
             void bind(const std::string& name, std::function<std::string(std::string)> fn) override;
+            void bind_async(const std::string& name, std::function<void(std::string, std::string)> fn) override;
+            void resolve(const std::string& id, int status, const std::string& result) override;
             void unbind(const std::string& name) override;
             void dispatch(std::function<void()> fn) override;
             void set_title(const std::string& title) override;
             void set_size(int64_t width, int64_t height) override;
             void set_html(const std::string& html) override;
             void eval(const std::string& js) override;
+            void queue_eval(std::string js) override;
+            json::object get_eval_stats() override;
             void init(const std::string& js) override;
             std::optional<void*> window() override;
             std::optional<void*> widget() override;
+            void set_event_frame_interval(std::chrono::microseconds interval) override;
+            void set_event_throttle(const std::string& event, std::chrono::milliseconds interval) override;
+            json::object get_event_stats() override;
             #if defined(_WIN32)
                 std::optional<void*> get_controller() override;
                 void register_navigation_handler(std::function<bool(const std::string&)> callback) override;
@@ -35,6 +35,11 @@
 #include "config.hpp"
 #include "managers/in_out_manager.hpp"
 #include "managers/callback_manager.hpp"
+#include "managers/task_manager.hpp"
+#include "binding_profiler.hpp"
+#include "trust_rules.hpp"
+#include <optional>
+#include <set>
 
 using File = RenWeb::File;
 using Config = RenWeb::Config;
@@ -53,18 +58,31 @@ namespace RenWeb {
             RenWeb::App* app;
             std::map<std::string, json::value> saved_states;
             std::unique_ptr<CM> internal_callbacks;
+            std::unique_ptr<RenWeb::TaskManager> task_manager;
+            // Separate lane for bindings that block until something external happens (process waits),
+            // so they cannot starve file I/O on task_manager
+            std::unique_ptr<RenWeb::TaskManager> blocking_task_manager;
+            std::unique_ptr<RenWeb::BindingProfiler> profiler;
+            bool dump_profile_at_exit = false;
+            std::set<std::string> async_callbacks;
+            std::set<std::string> blocking_callbacks;
+
+            std::optional<RenWeb::TrustRules> trusted_rules;
+            std::optional<RenWeb::TrustRules> origin_rules;
+            std::optional<std::pair<std::string, bool>> trust_verdict;
+            bool isTrustedExecutionContext();
+            bool isOriginAllowlisted(const std::string& target_uri);
 
             json::value formatOutput(const json::value& output);
             json::value formatOutput(const std::string& output);
             template<typename T>
                 json::value formatOutput(const T& output);
-            json::value processInput(const std::string& input);
-            json::value processInput(const json::value& input);
-            json::value processInput(const json::object& input);
-            json::value processInput(const json::array& input);
             json::value getSingleParameter(const json::value& param);
+            json::value runBinding(const std::string& fn_name, const json::value& args);
+            json::value runBatch(const json::value& calls);
 
             WindowFunctions* bindDefaults();
+            WindowFunctions* runsAsync(const std::string& key, bool blocking = false);
          /* Exposed-API function setters */
             WindowFunctions* setGetSets();
             WindowFunctions* setWindowCallbacks();
@@ -101,6 +119,7 @@ namespace RenWeb {
             WindowFunctions& operator=(WindowFunctions&&) = delete;
             
             WindowFunctions* bindFunction(const std::string&, std::function<std::string(std::string)>);
+            WindowFunctions* bindAsyncFunction(const std::string&, std::function<std::string(std::string)>, bool blocking = false);
             WindowFunctions* unbindFunction(const std::string&);
             json::value get(const std::string& property);
             void set(const std::string& property, const json::value& value);
@@ -53,6 +53,17 @@
 using namespace RenWeb;
 using JSON = RenWeb::JSON;
 
+App::~App() {
+    // Peer discovery probes through ws and notifies through w, both of which go before procm
+    if (this->procm) {
+        this->procm->stopPeerDiscovery();
+    }
+    // Outbox threads report failed batches through w, which is destroyed before ws
+    if (this->ws) {
+        this->ws->stopOutbox();
+    }
+}
+
 void App::showErrorPopup(const std::string& message) {
 #if defined(_WIN32)
     int len = MultiByteToWideChar(CP_UTF8, 0, message.c_str(), -1, nullptr, 0);
@@ -229,6 +240,8 @@ std::unique_ptr<App> AppBuilder::build() {
 
 void App::run() {
     this->ws->start();
+    // Needs the bound port, so it is added after the server starts and before the first navigation
+    this->w->init(this->ws->getInitScript());
     
     this->procm->registerProcess();
     
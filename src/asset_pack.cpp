@@ -0,0 +1,199 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/asset_pack.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+using AssetPack = RenWeb::AssetPack;
+
+// Byte-wise so big-endian targets read the same file
+template <typename T>
+static T readLE(const char* p) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+    }
+    return static_cast<T>(value);
+}
+
+AssetPack::AssetPack(const std::filesystem::path& path)
+    : path(path)
+{
+    std::error_code ec;
+    const uintmax_t file_size = std::filesystem::file_size(path, ec);
+    if (!ec) this->mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        throw std::runtime_error("Could not stat asset pack '" + path.string() + "': " + ec.message());
+    }
+    if (file_size < HEADER_SIZE || file_size > static_cast<uintmax_t>(SIZE_MAX)) {
+        throw std::runtime_error("Asset pack '" + path.string() + "' has an invalid size.");
+    }
+    this->size = static_cast<size_t>(file_size);
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file != INVALID_HANDLE_VALUE) {
+        HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (mapping != NULL) {
+            this->data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            if (this->data == nullptr) CloseHandle(mapping);
+            else this->mapping = mapping;
+        }
+    }
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        void* addr = mmap(nullptr, this->size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr != MAP_FAILED) {
+            this->data = static_cast<const char*>(addr);
+        }
+    }
+#endif
+    if (this->data == nullptr) {
+        throw std::runtime_error("Could not map asset pack '" + path.string() + "'.");
+    }
+    try {
+        if (std::memcmp(this->data, MAGIC, 8) != 0) {
+            throw std::runtime_error("bad magic");
+        }
+        if (readLE<uint32_t>(this->data + 8) != VERSION) {
+            throw std::runtime_error("unsupported version " + std::to_string(readLE<uint32_t>(this->data + 8)));
+        }
+        const uint64_t count = readLE<uint32_t>(this->data + 12);
+        const uint64_t strings_offset = readLE<uint64_t>(this->data + 16);
+        const uint64_t strings_size = readLE<uint64_t>(this->data + 24);
+        if (count > (this->size - HEADER_SIZE) / ENTRY_SIZE
+            || strings_offset < HEADER_SIZE + count * ENTRY_SIZE
+            || strings_offset > this->size
+            || strings_size > this->size - strings_offset
+        ) {
+            throw std::runtime_error("index out of bounds");
+        }
+        this->entries.reserve(static_cast<size_t>(count));
+        for (uint64_t i = 0; i < count; i++) {
+            const char* p = this->data + HEADER_SIZE + i * ENTRY_SIZE;
+            const uint32_t path_offset = readLE<uint32_t>(p + 8);
+            const uint32_t path_length = readLE<uint32_t>(p + 12);
+            const uint64_t data_offset = readLE<uint64_t>(p + 16);
+            const uint64_t data_size = readLE<uint64_t>(p + 24);
+            if (static_cast<uint64_t>(path_offset) + path_length > strings_size
+                || data_offset > this->size || data_size > this->size - data_offset
+            ) {
+                throw std::runtime_error("entry " + std::to_string(i) + " out of bounds");
+            }
+            Entry entry{
+                readLE<uint64_t>(p),
+                std::string_view(this->data + strings_offset + path_offset, path_length),
+                this->data + data_offset,
+                data_size,
+                readLE<int64_t>(p + 32)
+            };
+            if (!this->entries.empty()) {
+                const Entry& prev = this->entries.back();
+                if (std::tie(prev.hash, prev.path) >= std::tie(entry.hash, entry.path)) {
+                    throw std::runtime_error("index is not sorted");
+                }
+            }
+            this->roots.insert(entry.path.substr(0, entry.path.find('/')));
+            this->entries.push_back(entry);
+        }
+    } catch (const std::exception& e) {
+        this->unmap();
+        throw std::runtime_error("Invalid asset pack '" + path.string() + "': " + e.what());
+    }
+}
+
+AssetPack::~AssetPack() {
+    this->unmap();
+}
+
+void AssetPack::unmap() {
+    if (this->data == nullptr) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(this->data);
+    CloseHandle(static_cast<HANDLE>(this->mapping));
+#else
+    munmap(const_cast<char*>(this->data), this->size);
+#endif
+    this->data = nullptr;
+}
+
+uint64_t AssetPack::hash(std::string_view path) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (const char c : path) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+const AssetPack::Entry* AssetPack::find(std::string_view path) const {
+    const uint64_t h = AssetPack::hash(path);
+    auto it = std::lower_bound(this->entries.begin(), this->entries.end(), std::make_pair(h, path),
+        [](const Entry& entry, const std::pair<uint64_t, std::string_view>& key) {
+            return std::tie(entry.hash, entry.path) < std::tie(key.first, key.second);
+        });
+    if (it == this->entries.end() || it->hash != h || it->path != path) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+bool AssetPack::owns(std::string_view root) const {
+    return this->roots.count(root) > 0;
+}
+
+const std::filesystem::path& AssetPack::getPath() const {
+    return this->path;
+}
+
+std::filesystem::file_time_type AssetPack::getMtime() const {
+    return this->mtime;
+}
+
+uintmax_t AssetPack::getFileSize() const {
+    return static_cast<uintmax_t>(this->size);
+}
+
+size_t AssetPack::getEntryCount() const {
+    return this->entries.size();
+}
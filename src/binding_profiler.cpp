@@ -0,0 +1,309 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/binding_profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <utility>
+#include <boost/json/serialize.hpp>
+
+using BindingProfiler = RenWeb::BindingProfiler;
+using Clock = BindingProfiler::Clock;
+
+static constexpr auto RELAXED = std::memory_order_relaxed;
+
+static std::atomic<uint64_t> next_thread_index{0};
+static thread_local BindingProfiler::Call* current_call = nullptr;
+
+// Small, stable per-thread number: picks the counter shard and is the trace tid
+static uint64_t threadIndex() {
+    thread_local const uint64_t index = next_thread_index.fetch_add(1, RELAXED);
+    return index;
+}
+
+static uint64_t nanos(Clock::duration elapsed) {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    return ns > 0 ? static_cast<uint64_t>(ns) : 0;
+}
+
+static void storeMax(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t current = target.load(RELAXED);
+    while (value > current && !target.compare_exchange_weak(current, value, RELAXED)) { }
+}
+
+BindingProfiler::Call::Call(BindingProfiler* profiler, Slot* slot, size_t request_bytes)
+    : profiler(profiler),
+      slot(slot),
+      outer(current_call),
+      request_bytes(request_bytes),
+      started(Clock::now())
+{
+    current_call = this;
+}
+
+BindingProfiler::Call::~Call() {
+    current_call = this->outer;
+    if (this->profiler != nullptr && this->slot != nullptr && this->profiler->isEnabled()) {
+        this->profiler->record(*this, Clock::now());
+    }
+}
+
+/*static*/ void BindingProfiler::Call::decoded() {
+    if (current_call != nullptr) current_call->decode_end = Clock::now();
+}
+
+/*static*/ void BindingProfiler::Call::executed() {
+    if (current_call != nullptr) current_call->execute_end = Clock::now();
+}
+
+/*static*/ void BindingProfiler::Call::failed() {
+    if (current_call != nullptr) current_call->error = true;
+}
+
+BindingProfiler::BindingProfiler() { }
+
+BindingProfiler::Slot* BindingProfiler::slot(const std::string& name) {
+    std::lock_guard<std::mutex> lock(this->slots_mtx);
+    auto& slot = this->slots[name];
+    if (!slot) {
+        slot = std::make_unique<Slot>(name);
+    }
+    return slot.get();
+}
+
+void BindingProfiler::record(const Call& call, Clock::time_point ended) {
+    const Clock::time_point execute_start = call.decode_end.value_or(call.started);
+    const Clock::time_point execute_end = call.execute_end.value_or(ended);
+    const uint64_t decode_ns = call.decode_end ? nanos(*call.decode_end - call.started) : 0;
+    const uint64_t execute_ns = nanos(execute_end - execute_start);
+    const uint64_t encode_ns = call.execute_end ? nanos(ended - *call.execute_end) : 0;
+    const uint64_t thread = threadIndex();
+
+    Slot& slot = *call.slot;
+    Slot::Shard& shard = slot.shards[thread % SHARDS];
+    shard.calls.fetch_add(1, RELAXED);
+    if (call.error) shard.errors.fetch_add(1, RELAXED);
+    shard.decode_ns.fetch_add(decode_ns, RELAXED);
+    shard.execute_ns.fetch_add(execute_ns, RELAXED);
+    shard.encode_ns.fetch_add(encode_ns, RELAXED);
+    shard.request_bytes.fetch_add(call.request_bytes, RELAXED);
+    shard.response_bytes.fetch_add(call.response_bytes, RELAXED);
+    storeMax(slot.max_request_bytes, call.request_bytes);
+    storeMax(slot.max_response_bytes, call.response_bytes);
+    slot.latency.record(nanos(ended - call.started) / 1000);
+
+    if (this->tracing.load(RELAXED)) {
+        std::lock_guard<std::mutex> lock(this->trace_mtx);
+        if (!this->tracing.load(RELAXED)) return;
+        if (this->trace_events.size() < MAX_TRACE_EVENTS) {
+            this->trace_events.push_back(TraceEvent{
+                &slot, thread, call.started, decode_ns, execute_ns, encode_ns,
+                call.request_bytes, call.response_bytes, call.error
+            });
+        } else {
+            this->trace_dropped++;
+        }
+    }
+}
+
+void BindingProfiler::startTrace(const std::filesystem::path& path) {
+    std::lock_guard<std::mutex> lock(this->trace_mtx);
+    this->trace_path = path;
+    if (!this->tracing.load(RELAXED)) {
+        this->trace_events.clear();
+        this->trace_events.reserve(4096);
+        this->trace_dropped = 0;
+        this->tracing.store(true, RELAXED);
+    }
+}
+
+std::optional<std::filesystem::path> BindingProfiler::stopTrace() {
+    std::vector<TraceEvent> events;
+    std::filesystem::path path;
+    uint64_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(this->trace_mtx);
+        if (!this->tracing.load(RELAXED)) return std::nullopt;
+        this->tracing.store(false, RELAXED);
+        events.swap(this->trace_events);
+        path = this->trace_path;
+        dropped = this->trace_dropped;
+    }
+    if (!path.parent_path().empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.good()) {
+        throw std::runtime_error("[profiler] Could not write binding trace to " + path.string());
+    }
+    // Trace Event Format: complete ("X") events in microseconds. The call span
+    // nests its decode/execute/encode phases on the same thread row.
+    // Names are JSON-quoted once per binding and streamed as-is, so any length stays valid JSON
+    std::map<const Slot*, std::string> names;
+    out << std::fixed << std::setprecision(3);
+    auto span = [&out](const std::string& name, const char* cat, uint64_t tid, double ts, double dur) -> std::ofstream& {
+        out << ",\n{\"name\":" << name << ",\"cat\":\"" << cat << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+            << ",\"ts\":" << ts << ",\"dur\":" << dur;
+        return out;
+    };
+    out << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":" << dropped << "},\"traceEvents\":[\n"
+        << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"RenWeb bindings\"}}";
+    const std::string decode_name = "\"decode\"", execute_name = "\"execute\"", encode_name = "\"encode\"";
+    for (const TraceEvent& event : events) {
+        auto name = names.find(event.slot);
+        if (name == names.end()) {
+            name = names.emplace(event.slot, json::serialize(json::value(event.slot->getName()))).first;
+        }
+        const double ts = static_cast<double>(nanos(event.started - this->created)) / 1000.0;
+        const double decode = static_cast<double>(event.decode_ns) / 1000.0;
+        const double execute = static_cast<double>(event.execute_ns) / 1000.0;
+        const double encode = static_cast<double>(event.encode_ns) / 1000.0;
+        span(name->second, "binding", event.thread, ts, decode + execute + encode)
+            << ",\"args\":{\"request_bytes\":" << event.request_bytes
+            << ",\"response_bytes\":" << event.response_bytes
+            << ",\"error\":" << (event.error ? "true" : "false") << "}}";
+        if (event.decode_ns > 0) span(decode_name, "phase", event.thread, ts, decode) << "}";
+        span(execute_name, "phase", event.thread, ts + decode, execute) << "}";
+        if (event.encode_ns > 0) span(encode_name, "phase", event.thread, ts + decode + execute, encode) << "}";
+    }
+    out << "\n]}\n";
+    out.close();
+    if (out.fail()) {
+        throw std::runtime_error("[profiler] Could not write binding trace to " + path.string());
+    }
+    return path;
+}
+
+namespace {
+    struct Totals {
+        std::string name;
+        uint64_t calls = 0;
+        uint64_t errors = 0;
+        uint64_t decode_ns = 0;
+        uint64_t execute_ns = 0;
+        uint64_t encode_ns = 0;
+        uint64_t request_bytes = 0;
+        uint64_t response_bytes = 0;
+        uint64_t totalNs() const { return this->decode_ns + this->execute_ns + this->encode_ns; }
+    };
+}
+
+json::object BindingProfiler::toJson() const {
+    std::vector<std::pair<Totals, const Slot*>> rows;
+    {
+        std::lock_guard<std::mutex> lock(this->slots_mtx);
+        for (const auto& [name, slot] : this->slots) {
+            Totals totals;
+            totals.name = name;
+            for (const Slot::Shard& shard : slot->shards) {
+                totals.calls += shard.calls.load(RELAXED);
+                totals.errors += shard.errors.load(RELAXED);
+                totals.decode_ns += shard.decode_ns.load(RELAXED);
+                totals.execute_ns += shard.execute_ns.load(RELAXED);
+                totals.encode_ns += shard.encode_ns.load(RELAXED);
+                totals.request_bytes += shard.request_bytes.load(RELAXED);
+                totals.response_bytes += shard.response_bytes.load(RELAXED);
+            }
+            if (totals.calls > 0) rows.emplace_back(std::move(totals), slot.get());
+        }
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+        return a.first.totalNs() > b.first.totalNs();
+    });
+    auto ms = [](uint64_t ns) { return static_cast<double>(ns) / 1e6; };
+    json::object bindings;
+    uint64_t calls = 0, errors = 0, total_ns = 0;
+    for (const auto& [totals, slot] : rows) {
+        calls += totals.calls;
+        errors += totals.errors;
+        total_ns += totals.totalNs();
+        const LatencyHistogram& latency = slot->latency;
+        bindings[totals.name] = json::object{
+            {"calls", totals.calls},
+            {"errors", totals.errors},
+            {"total_ms", ms(totals.totalNs())},
+            {"decode_ms", ms(totals.decode_ns)},
+            {"execute_ms", ms(totals.execute_ns)},
+            {"encode_ms", ms(totals.encode_ns)},
+            {"avg_ms", ms(totals.totalNs()) / static_cast<double>(totals.calls)},
+            {"p50_ms", static_cast<double>(latency.quantile(0.50)) / 1000.0},
+            {"p99_ms", static_cast<double>(latency.quantile(0.99)) / 1000.0},
+            {"max_ms", static_cast<double>(latency.getMax()) / 1000.0},
+            {"request_bytes", totals.request_bytes},
+            {"response_bytes", totals.response_bytes},
+            {"max_request_bytes", slot->max_request_bytes.load(RELAXED)},
+            {"max_response_bytes", slot->max_response_bytes.load(RELAXED)}
+        };
+    }
+    return json::object{
+        {"enabled", this->isEnabled()},
+        {"tracing", this->isTracing()},
+        {"uptime_s", std::chrono::duration_cast<std::chrono::seconds>(Clock::now() - this->created).count()},
+        {"calls", calls},
+        {"errors", errors},
+        {"total_ms", ms(total_ns)},
+        {"bindings", std::move(bindings)}
+    };
+}
+
+std::string BindingProfiler::summary(size_t top) const {
+    const json::object stats = this->toJson();
+    const json::object& bindings = stats.at("bindings").as_object();
+    char line[256];
+    std::snprintf(line, sizeof(line), "%llu binding calls, %llu errors, %.1f ms total\n",
+        static_cast<unsigned long long>(stats.at("calls").as_uint64()),
+        static_cast<unsigned long long>(stats.at("errors").as_uint64()),
+        stats.at("total_ms").as_double());
+    std::string out = line;
+    std::snprintf(line, sizeof(line), "  %-32s %8s %6s %10s %9s %9s %9s %9s %9s %10s\n",
+        "binding", "calls", "errors", "total ms", "avg ms", "p99 ms", "decode", "execute", "encode", "resp KiB");
+    out += line;
+    size_t shown = 0;
+    for (const auto& item : bindings) {
+        if (shown++ == top) break;
+        const json::object& b = item.value().as_object();
+        std::snprintf(line, sizeof(line), "  %-32.32s %8llu %6llu %10.2f %9.3f %9.3f %9.2f %9.2f %9.2f %10.1f\n",
+            std::string(item.key()).c_str(),
+            static_cast<unsigned long long>(b.at("calls").as_uint64()),
+            static_cast<unsigned long long>(b.at("errors").as_uint64()),
+            b.at("total_ms").as_double(),
+            b.at("avg_ms").as_double(),
+            b.at("p99_ms").as_double(),
+            b.at("decode_ms").as_double(),
+            b.at("execute_ms").as_double(),
+            b.at("encode_ms").as_double(),
+            static_cast<double>(b.at("response_bytes").as_uint64()) / 1024.0);
+        out += line;
+    }
+    return out;
+}
@@ -0,0 +1,154 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/eval_queue.hpp"
+
+#include <boost/json/serialize.hpp>
+
+using EvalQueue = RenWeb::EvalQueue;
+
+static uint64_t micros(EvalQueue::Clock::duration d) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+}
+
+// A lone script is evaluated as is. In a batch each one gets its own global-scope eval, so a
+// syntax error, a throw or a repeated top-level let/const only loses that script.
+static void appendIsolated(std::string& batch, const std::string& script) {
+    batch += "try{(0,eval)(";
+    batch += json::serialize(json::value(script));
+    batch += ")}catch(e){console.error('[renweb] queued script failed:',e)}\n";
+}
+
+static json::object latencyJson(const RenWeb::LatencyHistogram& histogram) {
+    const uint64_t count = histogram.getCount();
+    return json::object{
+        {"avg_ms", count ? static_cast<double>(histogram.getSum()) / static_cast<double>(count) / 1000.0 : 0.0},
+        {"p50_ms", static_cast<double>(histogram.quantile(0.50)) / 1000.0},
+        {"p99_ms", static_cast<double>(histogram.quantile(0.99)) / 1000.0},
+        {"max_ms", static_cast<double>(histogram.getMax()) / 1000.0}
+    };
+}
+
+EvalQueue::EvalQueue(Dispatch dispatch, Eval eval)
+    : dispatch(std::move(dispatch))
+    , eval(std::move(eval))
+{
+    Node* stub = new Node();
+    this->head.store(stub);
+    this->tail = stub;
+}
+
+EvalQueue::~EvalQueue() {
+    Node* node = this->tail;
+    while (node) {
+        Node* next = node->next.load(std::memory_order_acquire);
+        delete node;
+        node = next;
+    }
+}
+
+void EvalQueue::push(std::string script) {
+    Node* node = new Node();
+    node->script = std::move(script);
+    node->queued = Clock::now();
+
+    const int64_t depth = this->depth.fetch_add(1, std::memory_order_relaxed) + 1;
+    int64_t seen = this->max_depth.load(std::memory_order_relaxed);
+    while (depth > seen && !this->max_depth.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) { }
+    this->queued.fetch_add(1, std::memory_order_relaxed);
+
+    Node* prev = this->head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+
+    // Linked before the flag is checked: a drain that cleared the flag first is followed by
+    // this push's own wakeup, and one that clears it later is guaranteed to see the node
+    if (this->wake_pending.exchange(true, std::memory_order_acq_rel)) return;
+    this->wakeups.fetch_add(1, std::memory_order_relaxed);
+    try {
+        this->dispatch([this, alive = std::weak_ptr<bool>(this->alive)]() {
+            if (alive.lock()) this->drain();
+        });
+    } catch (...) {
+        this->wake_pending.store(false, std::memory_order_release);
+        throw;
+    }
+}
+
+void EvalQueue::drain(const std::string& trailing) {
+    this->wake_pending.exchange(false, std::memory_order_acq_rel);
+    const Clock::time_point now = Clock::now();
+    std::vector<std::string> pending;
+    // A producer that has swapped head but not linked yet ends the walk early; its
+    // wakeup brings the rest
+    Node* node = this->tail;
+    while (Node* next = node->next.load(std::memory_order_acquire)) {
+        this->latency.record(micros(now - next->queued));
+        // next becomes the new stub; its script is no longer needed
+        pending.push_back(std::move(next->script));
+        delete node;
+        node = next;
+    }
+    this->tail = node;
+    const uint64_t count = pending.size();
+    this->depth.fetch_sub(static_cast<int64_t>(count), std::memory_order_relaxed);
+
+    if (!trailing.empty()) pending.push_back(trailing);
+    if (pending.empty()) return;
+    std::string batch;
+    if (pending.size() == 1) {
+        batch = std::move(pending.front());
+    } else {
+        for (const std::string& script : pending) {
+            appendIsolated(batch, script);
+        }
+    }
+    this->evals.fetch_add(1, std::memory_order_relaxed);
+    this->scripts.fetch_add(count, std::memory_order_relaxed);
+    this->bytes.fetch_add(batch.size(), std::memory_order_relaxed);
+    const Clock::time_point started = Clock::now();
+    try {
+        this->eval(batch);
+    } catch (...) { }
+    this->eval_time.record(micros(Clock::now() - started));
+}
+
+json::object EvalQueue::getStats() const {
+    const uint64_t evals = this->evals.load(std::memory_order_relaxed);
+    const uint64_t scripts = this->scripts.load(std::memory_order_relaxed);
+    return json::object{
+        {"depth", this->depth.load(std::memory_order_relaxed)},
+        {"max_depth", this->max_depth.load(std::memory_order_relaxed)},
+        {"queued", this->queued.load(std::memory_order_relaxed)},
+        {"wakeups", this->wakeups.load(std::memory_order_relaxed)},
+        {"evals", evals},
+        {"scripts_per_eval", evals ? static_cast<double>(scripts) / static_cast<double>(evals) : 0.0},
+        {"bytes", this->bytes.load(std::memory_order_relaxed)},
+        {"latency", latencyJson(this->latency)},
+        {"eval", latencyJson(this->eval_time)}
+    };
+}
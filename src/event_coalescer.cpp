@@ -0,0 +1,196 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/event_coalescer.hpp"
+
+#include <algorithm>
+
+using EventCoalescer = RenWeb::EventCoalescer;
+
+EventCoalescer::EventCoalescer(Dispatch dispatch, Eval eval, std::chrono::microseconds frame_interval)
+    : dispatch(std::move(dispatch))
+    , eval(std::move(eval))
+    , frame_interval(frame_interval)
+{
+    this->pacer = std::thread([this]() { this->run(); });
+}
+
+EventCoalescer::~EventCoalescer() {
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->stopping = true;
+    }
+    this->wake.notify_all();
+    if (this->pacer.joinable()) {
+        this->pacer.join();
+    }
+}
+
+void EventCoalescer::post(const std::string& event, std::string payload_js) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    Event& state = this->events[event];
+    state.posted++;
+    auto it = std::find_if(this->pending.begin(), this->pending.end(),
+        [&event](const Pending& p) { return p.event == event; });
+    if (it != this->pending.end()) {
+        // Superseded before it was delivered
+        state.dropped++;
+        it->payload_js = std::move(payload_js);
+    } else {
+        this->pending.push_back(Pending{event, std::move(payload_js)});
+    }
+    this->schedule();
+}
+
+void EventCoalescer::setFrameInterval(std::chrono::microseconds interval) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    this->frame_interval = std::max(interval, std::chrono::microseconds(0));
+    this->schedule();
+}
+
+void EventCoalescer::setThrottle(const std::string& event, std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    this->events[event].throttle = std::max(interval, std::chrono::milliseconds(0));
+    this->schedule();
+}
+
+json::object EventCoalescer::getStats() const {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    uint64_t posted = 0;
+    uint64_t delivered = 0;
+    uint64_t dropped = 0;
+    json::object per_event;
+    for (const auto& [name, state] : this->events) {
+        posted += state.posted;
+        delivered += state.delivered;
+        dropped += state.dropped;
+        per_event[name] = json::object{
+            {"throttle_ms", state.throttle.count()},
+            {"posted", state.posted},
+            {"delivered", state.delivered},
+            {"dropped", state.dropped}
+        };
+    }
+    return json::object{
+        {"frame_ms", std::chrono::duration<double, std::milli>(this->frame_interval).count()},
+        {"posted", posted},
+        {"delivered", delivered},
+        {"dropped", dropped},
+        {"flushes", this->flushes},
+        {"pending", this->pending.size()},
+        {"events", std::move(per_event)}
+    };
+}
+
+void EventCoalescer::schedule() {
+    if (this->flush_queued || this->pending.empty()) return;
+    Clock::time_point next = this->flushed_at + this->frame_interval;
+    Clock::time_point released = Clock::time_point::max();
+    for (const Pending& p : this->pending) {
+        const Event& state = this->events[p.event];
+        released = std::min(released, state.delivered_at + state.throttle);
+    }
+    next = std::max(next, released);
+    if (next < this->deadline) {
+        this->deadline = next;
+        this->wake.notify_one();
+    }
+}
+
+void EventCoalescer::run() {
+    std::unique_lock<std::mutex> lock(this->mtx);
+    while (!this->stopping) {
+        this->wake.wait(lock, [this]() { return this->stopping || this->deadline != Clock::time_point::max(); });
+        if (this->stopping) break;
+        // An earlier event or a shorter throttle can pull the deadline in while waiting
+        while (!this->stopping && Clock::now() < this->deadline) {
+            const Clock::time_point until = this->deadline;
+            this->wake.wait_until(lock, until);
+        }
+        if (this->stopping) break;
+        this->deadline = Clock::time_point::max();
+        this->flush_queued = true;
+        lock.unlock();
+        try {
+            this->dispatch([this, alive = std::weak_ptr<bool>(this->alive)]() {
+                if (alive.lock()) this->flush();
+            });
+        } catch (...) {
+            lock.lock();
+            this->flush_queued = false;
+            continue;
+        }
+        lock.lock();
+    }
+}
+
+void EventCoalescer::flush() {
+    std::vector<Pending> batch;
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->flush_queued = false;
+        const Clock::time_point now = Clock::now();
+        // Throttled events stay pending, in order, for a later flush
+        auto held = std::stable_partition(this->pending.begin(), this->pending.end(),
+            [this, now](const Pending& p) {
+                const Event& state = this->events[p.event];
+                return now < state.delivered_at + state.throttle;
+            });
+        for (auto it = held; it != this->pending.end(); ++it) {
+            Event& state = this->events[it->event];
+            state.delivered_at = now;
+            state.delivered++;
+            batch.push_back(std::move(*it));
+        }
+        this->pending.erase(held, this->pending.end());
+        if (!batch.empty()) {
+            this->flushed_at = now;
+            this->flushes++;
+        }
+        this->schedule();
+    }
+    if (batch.empty()) return;
+    try {
+        this->eval(EventCoalescer::makeScript(batch));
+    } catch (...) { }
+}
+
+/*static*/ std::string EventCoalescer::makeScript(const std::vector<Pending>& batch) {
+    std::string events = "[";
+    for (const Pending& p : batch) {
+        if (events.size() > 1) events += ",";
+        events += "['" + p.event + "'," + p.payload_js + "]";
+    }
+    events += "]";
+    // Handlers run independently, as they did when each event had its own eval
+    return events + ".forEach(function(ev) {"
+           "  if (typeof window.renweb?.[ev[0]] !== 'function') return;"
+           "  (async () => { await window.renweb[ev[0]](ev[1]); })()"
+           "    .catch(function(e) { console.error('[renweb] ' + ev[0] + ' error:', e); });"
+           "});";
+}
@@ -0,0 +1,143 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/message_inbox.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+using MessageInbox = RenWeb::MessageInbox;
+
+MessageInbox::MessageInbox(size_t max_messages, size_t max_bytes)
+    : capacity(max_messages)
+    , max_bytes(max_bytes)
+{
+    if (this->capacity == 0) {
+        throw std::runtime_error("[inbox] Capacity must be at least one message");
+    }
+    this->slots.reset(new Slot[this->capacity]);
+}
+
+uint64_t MessageInbox::push(json::value message, size_t bytes) {
+    const uint64_t seq = this->next_seq.fetch_add(1) + 1;
+    if (message.is_object()) {
+        message.as_object()["seq"] = seq;
+    }
+    auto stored = std::make_shared<const json::value>(std::move(message));
+    Slot& slot = this->slots[seq % this->capacity];
+    {
+        std::lock_guard<std::mutex> lock(slot.mtx);
+        if (slot.seq > seq) {
+            // Writers lapped the whole ring while this one was preempted; it is already stale
+            this->dropped++;
+            return seq;
+        }
+        if (slot.message) {
+            this->bytes -= slot.bytes;
+            this->dropped++;
+        }
+        slot.seq = seq;
+        slot.message = std::move(stored);
+        slot.bytes = bytes;
+    }
+    this->bytes += bytes;
+    // The ring only holds the newest `capacity` sequence numbers
+    if (seq >= this->capacity) {
+        uint64_t floor = this->floor_seq.load();
+        const uint64_t lowest = seq - this->capacity + 1;
+        while (floor < lowest && !this->floor_seq.compare_exchange_weak(floor, lowest)) { }
+    }
+    if (this->max_bytes > 0 && this->bytes.load() > this->max_bytes) {
+        this->trimBytes(seq);
+    }
+    return seq;
+}
+
+// Drops the oldest messages until the byte limit holds, always keeping newest
+void MessageInbox::trimBytes(uint64_t newest) {
+    while (this->bytes.load() > this->max_bytes) {
+        uint64_t floor = this->floor_seq.load();
+        if (floor >= newest) return;
+        Slot& slot = this->slots[floor % this->capacity];
+        {
+            std::lock_guard<std::mutex> lock(slot.mtx);
+            if (slot.seq == floor && slot.message) {
+                slot.message.reset();
+                this->bytes -= slot.bytes;
+                slot.bytes = 0;
+                this->dropped++;
+            } else if (slot.seq < floor) {
+                // Claimed but not written yet; let that writer finish first
+                return;
+            }
+        }
+        this->floor_seq.compare_exchange_strong(floor, floor + 1);
+    }
+}
+
+json::object MessageInbox::read(uint64_t since_seq, size_t max) const {
+    const uint64_t newest = this->next_seq.load();
+    const uint64_t first = this->floor_seq.load();
+    uint64_t seq = std::max(since_seq + 1, first);
+    uint64_t last = std::max(since_seq, first - 1);
+    json::array messages;
+    for (; seq <= newest && messages.size() < max; seq++) {
+        const Slot& slot = this->slots[seq % this->capacity];
+        std::shared_ptr<const json::value> message;
+        {
+            std::lock_guard<std::mutex> lock(slot.mtx);
+            if (slot.seq < seq) break; // still being written; stop so the cursor cannot skip it
+            if (slot.seq == seq) message = slot.message;
+        }
+        last = seq;
+        if (message) messages.push_back(*message);
+    }
+    return json::object{
+        {"messages", std::move(messages)},
+        {"last_seq", last},
+        {"first_seq", first},
+        {"dropped", this->dropped.load()}
+    };
+}
+
+uint64_t MessageInbox::getNewestSeq() const {
+    return this->next_seq.load();
+}
+
+json::object MessageInbox::getStats() const {
+    const uint64_t newest = this->next_seq.load();
+    const uint64_t first = this->floor_seq.load();
+    return json::object{
+        {"received", newest},
+        {"retained", newest >= first ? newest - first + 1 : 0},
+        {"bytes", this->bytes.load()},
+        {"max_messages", this->capacity},
+        {"max_bytes", this->max_bytes},
+        {"dropped", this->dropped.load()}
+    };
+}
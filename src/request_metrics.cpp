@@ -0,0 +1,244 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/request_metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using LatencyHistogram = RenWeb::LatencyHistogram;
+using RequestMetrics = RenWeb::RequestMetrics;
+
+static constexpr auto RELAXED = std::memory_order_relaxed;
+
+static void storeMax(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t current = target.load(RELAXED);
+    while (value > current && !target.compare_exchange_weak(current, value, RELAXED)) { }
+}
+
+// Start of bucket index; one past the last index is the histogram's upper edge
+static uint64_t bucketStart(size_t index) {
+    if (index < LatencyHistogram::SUB_BUCKETS) return index;
+    const size_t group = index / LatencyHistogram::SUB_BUCKETS;
+    const uint64_t sub = index % LatencyHistogram::SUB_BUCKETS;
+    const unsigned msb = static_cast<unsigned>(group) + LatencyHistogram::SUB_BITS - 1;
+    return (uint64_t{1} << msb) + (sub << (msb - LatencyHistogram::SUB_BITS));
+}
+
+size_t LatencyHistogram::bucketOf(uint64_t us) {
+    if (us < SUB_BUCKETS) return static_cast<size_t>(us);
+    if (us >= (uint64_t{1} << MAX_EXPONENT)) return BUCKETS - 1;
+    unsigned msb = SUB_BITS;
+    while ((us >> (msb + 1)) != 0) msb++;
+    const uint64_t sub = (us >> (msb - SUB_BITS)) & (SUB_BUCKETS - 1);
+    return (msb - SUB_BITS + 1) * SUB_BUCKETS + static_cast<size_t>(sub);
+}
+
+uint64_t LatencyHistogram::upperBound(size_t index) {
+    return bucketStart(index + 1);
+}
+
+void LatencyHistogram::record(uint64_t us) {
+    this->buckets[LatencyHistogram::bucketOf(us)].fetch_add(1, RELAXED);
+    this->count.fetch_add(1, RELAXED);
+    this->sum.fetch_add(us, RELAXED);
+    storeMax(this->max, us);
+}
+
+uint64_t LatencyHistogram::getCount() const {
+    return this->count.load(RELAXED);
+}
+
+uint64_t LatencyHistogram::getSum() const {
+    return this->sum.load(RELAXED);
+}
+
+uint64_t LatencyHistogram::getMax() const {
+    return this->max.load(RELAXED);
+}
+
+uint64_t LatencyHistogram::quantile(double q) const {
+    // Buckets are read one by one while writers keep adding, so sum them instead of trusting count
+    std::array<uint64_t, BUCKETS> snapshot;
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKETS; i++) {
+        snapshot[i] = this->buckets[i].load(RELAXED);
+        total += snapshot[i];
+    }
+    if (total == 0) return 0;
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; i++) {
+        seen += snapshot[i];
+        if (seen >= rank) return std::min(LatencyHistogram::upperBound(i) - 1, this->getMax());
+    }
+    return this->getMax();
+}
+
+uint64_t LatencyHistogram::countBelow(unsigned exponent) const {
+    const size_t end = (exponent >= MAX_EXPONENT)
+        ? BUCKETS
+        : LatencyHistogram::bucketOf(uint64_t{1} << exponent);
+    uint64_t total = 0;
+    for (size_t i = 0; i < end; i++) {
+        total += this->buckets[i].load(RELAXED);
+    }
+    return total;
+}
+
+const char* RequestMetrics::routeName(Route route) {
+    switch (route) {
+        case Route::File: return "file";
+        case Route::IpcGet: return "ipc_get";
+        case Route::IpcPost: return "ipc_post";
+        case Route::Blob: return "blob";
+        case Route::Events: return "events";
+        case Route::Metrics: return "metrics";
+        case Route::Error: return "error";
+        default: return "other";
+    }
+}
+
+void RequestMetrics::count(Route route, int status, uint64_t bytes) {
+    RouteMetrics& metrics = this->routes[static_cast<size_t>(route)];
+    metrics.requests.fetch_add(1, RELAXED);
+    metrics.bytes.fetch_add(bytes, RELAXED);
+    if (status >= MIN_STATUS && status <= MAX_STATUS) {
+        metrics.status_classes[static_cast<size_t>(status / 100 - 1)].fetch_add(1, RELAXED);
+        this->statuses[static_cast<size_t>(status - MIN_STATUS)].fetch_add(1, RELAXED);
+    }
+}
+
+void RequestMetrics::record(Route route, int status, uint64_t bytes, std::chrono::steady_clock::duration elapsed) {
+    this->count(route, status, bytes);
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    this->routes[static_cast<size_t>(route)].latency.record(us > 0 ? static_cast<uint64_t>(us) : 0);
+}
+
+void RequestMetrics::recordUntimed(Route route, int status, uint64_t bytes) {
+    this->count(route, status, bytes);
+    this->untimed.fetch_add(1, RELAXED);
+}
+
+json::object RequestMetrics::toJson() const {
+    json::object routes;
+    for (size_t i = 0; i < ROUTES; i++) {
+        const RouteMetrics& metrics = this->routes[i];
+        json::object status_classes;
+        for (size_t c = 0; c < metrics.status_classes.size(); c++) {
+            const uint64_t n = metrics.status_classes[c].load(RELAXED);
+            if (n != 0) status_classes[std::to_string(c + 1) + "xx"] = n;
+        }
+        const LatencyHistogram& latency = metrics.latency;
+        const uint64_t timed = latency.getCount();
+        routes[RequestMetrics::routeName(static_cast<Route>(i))] = json::object{
+            {"requests", metrics.requests.load(RELAXED)},
+            {"bytes", metrics.bytes.load(RELAXED)},
+            {"status", std::move(status_classes)},
+            {"latency_ms", json::object{
+                {"count", timed},
+                {"avg", timed == 0 ? 0.0 : static_cast<double>(latency.getSum()) / static_cast<double>(timed) / 1000.0},
+                {"p50", static_cast<double>(latency.quantile(0.50)) / 1000.0},
+                {"p90", static_cast<double>(latency.quantile(0.90)) / 1000.0},
+                {"p99", static_cast<double>(latency.quantile(0.99)) / 1000.0},
+                {"max", static_cast<double>(latency.getMax()) / 1000.0}
+            }}
+        };
+    }
+    json::object statuses;
+    for (size_t i = 0; i < this->statuses.size(); i++) {
+        const uint64_t n = this->statuses[i].load(RELAXED);
+        if (n != 0) statuses[std::to_string(static_cast<int>(i) + MIN_STATUS)] = n;
+    }
+    return json::object{
+        {"uptime_s", std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - this->started).count()},
+        {"routes", std::move(routes)},
+        {"statuses", std::move(statuses)},
+        {"untimed", this->untimed.load(RELAXED)}
+    };
+}
+
+std::string RequestMetrics::toPrometheus() const {
+    // 128us, 512us, 2ms ... 33.5s: every other power of two keeps the series count small
+    static constexpr unsigned FIRST_EXPONENT = 7;
+    static constexpr unsigned LAST_EXPONENT = 25;
+    std::string out;
+    out.reserve(8192);
+    char number[32];
+    auto append_seconds = [&out, &number](double seconds) {
+        std::snprintf(number, sizeof(number), "%.6g", seconds);
+        out += number;
+    };
+
+    out += "# HELP renweb_http_requests_total HTTP requests by route and status class.\n"
+           "# TYPE renweb_http_requests_total counter\n";
+    for (size_t i = 0; i < ROUTES; i++) {
+        const char* route = RequestMetrics::routeName(static_cast<Route>(i));
+        for (size_t c = 0; c < this->routes[i].status_classes.size(); c++) {
+            const uint64_t n = this->routes[i].status_classes[c].load(RELAXED);
+            if (n == 0) continue;
+            out += "renweb_http_requests_total{route=\"" + std::string(route) + "\",code_class=\""
+                + std::to_string(c + 1) + "xx\"} " + std::to_string(n) + "\n";
+        }
+    }
+    out += "# HELP renweb_http_responses_total HTTP responses by status code.\n"
+           "# TYPE renweb_http_responses_total counter\n";
+    for (size_t i = 0; i < this->statuses.size(); i++) {
+        const uint64_t n = this->statuses[i].load(RELAXED);
+        if (n == 0) continue;
+        out += "renweb_http_responses_total{code=\"" + std::to_string(static_cast<int>(i) + MIN_STATUS) + "\"} "
+            + std::to_string(n) + "\n";
+    }
+    out += "# HELP renweb_http_response_bytes_total Response body bytes by route.\n"
+           "# TYPE renweb_http_response_bytes_total counter\n";
+    for (size_t i = 0; i < ROUTES; i++) {
+        out += "renweb_http_response_bytes_total{route=\"" + std::string(RequestMetrics::routeName(static_cast<Route>(i)))
+            + "\"} " + std::to_string(this->routes[i].bytes.load(RELAXED)) + "\n";
+    }
+    out += "# HELP renweb_http_request_duration_seconds Time from routing to the last byte written.\n"
+           "# TYPE renweb_http_request_duration_seconds histogram\n";
+    for (size_t i = 0; i < ROUTES; i++) {
+        const std::string route = RequestMetrics::routeName(static_cast<Route>(i));
+        const LatencyHistogram& latency = this->routes[i].latency;
+        for (unsigned e = FIRST_EXPONENT; e <= LAST_EXPONENT; e += 2) {
+            out += "renweb_http_request_duration_seconds_bucket{route=\"" + route + "\",le=\"";
+            append_seconds(static_cast<double>(uint64_t{1} << e) / 1e6);
+            out += "\"} " + std::to_string(latency.countBelow(e)) + "\n";
+        }
+        const uint64_t total = latency.countBelow(LatencyHistogram::MAX_EXPONENT);
+        out += "renweb_http_request_duration_seconds_bucket{route=\"" + route + "\",le=\"+Inf\"} " + std::to_string(total) + "\n";
+        out += "renweb_http_request_duration_seconds_sum{route=\"" + route + "\"} ";
+        append_seconds(static_cast<double>(latency.getSum()) / 1e6);
+        out += "\nrenweb_http_request_duration_seconds_count{route=\"" + route + "\"} " + std::to_string(total) + "\n";
+    }
+    out += "# HELP renweb_http_untimed_requests_total Requests that failed before routing, so have no latency sample.\n"
+           "# TYPE renweb_http_untimed_requests_total counter\n"
+           "renweb_http_untimed_requests_total " + std::to_string(this->untimed.load(RELAXED)) + "\n";
+    return out;
+}
@@ -0,0 +1,315 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/transcoder.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/json/basic_parser_impl.hpp>
+#include <boost/json/serializer.hpp>
+#include "../include/encoding.hpp"
+
+namespace json = boost::json;
+namespace Encoding = RenWeb::Encoding;
+
+namespace {
+    // Initial arena block. Requests are usually a few hundred bytes; the
+    // decoded tree is a small multiple of that.
+    constexpr std::size_t MIN_ARENA_BYTES = 1024;
+    constexpr std::size_t MAX_ARENA_BYTES = 64 * 1024;
+
+    // Lets the parse stack live in the arena with everything else
+    template <typename T>
+    struct ArenaAllocator {
+        using value_type = T;
+        json::memory_resource* resource;
+
+        explicit ArenaAllocator(json::memory_resource* resource) noexcept : resource(resource) { }
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : resource(other.resource) { }
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(this->resource->allocate(n * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* p, std::size_t n) noexcept {
+            this->resource->deallocate(p, n * sizeof(T), alignof(T));
+        }
+        template <typename U>
+        bool operator==(const ArenaAllocator<U>& other) const noexcept { return this->resource == other.resource; }
+        template <typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const noexcept { return this->resource != other.resource; }
+    };
+
+    // basic_parser handler that builds the value tree directly. Containers are
+    // attached to their parent when they close, so by the time an object is
+    // complete it can be checked (and collapsed) as a wire-format string.
+    class DecodeHandler {
+        public:
+            static constexpr std::size_t max_object_size = json::object::max_size();
+            static constexpr std::size_t max_array_size = json::array::max_size();
+            static constexpr std::size_t max_key_size = json::string::max_size();
+            static constexpr std::size_t max_string_size = json::string::max_size();
+
+            explicit DecodeHandler(json::storage_ptr sp)
+                : sp(std::move(sp)),
+                  stack(ArenaAllocator<Frame>(this->sp.get())),
+                  part(this->sp),
+                  root(this->sp)
+            {
+                this->stack.reserve(8);
+            }
+
+            json::value release() {
+                return std::move(this->root);
+            }
+
+            bool on_document_begin(json::error_code&) { return true; }
+            bool on_document_end(json::error_code&) { return true; }
+
+            bool on_array_begin(json::error_code&) {
+                this->stack.push_back(Frame{json::value(json::array(this->sp)), json::string(this->sp)});
+                return true;
+            }
+            bool on_array_end(std::size_t, json::error_code&) {
+                json::value done = std::move(this->stack.back().container);
+                this->stack.pop_back();
+                this->attach(std::move(done));
+                return true;
+            }
+            bool on_object_begin(json::error_code&) {
+                this->stack.push_back(Frame{json::value(json::object(this->sp)), json::string(this->sp)});
+                return true;
+            }
+            bool on_object_end(std::size_t, json::error_code&) {
+                json::value done = std::move(this->stack.back().container);
+                this->stack.pop_back();
+                json::object& obj = done.get_object();
+                if (Encoding::isEncoded(obj)) {
+                    this->attach(this->collapse(obj));
+                } else {
+                    this->attach(std::move(done));
+                }
+                return true;
+            }
+
+            bool on_string_part(json::string_view s, std::size_t, json::error_code&) {
+                this->part.append(s);
+                return true;
+            }
+            bool on_string(json::string_view s, std::size_t, json::error_code&) {
+                if (this->part.empty()) {
+                    this->attach(json::value(json::string(s, this->sp)));
+                } else {
+                    this->part.append(s);
+                    this->attach(json::value(std::move(this->part)));
+                    this->part = json::string(this->sp);
+                }
+                return true;
+            }
+            bool on_key_part(json::string_view s, std::size_t, json::error_code&) {
+                this->stack.back().key.append(s);
+                return true;
+            }
+            bool on_key(json::string_view s, std::size_t, json::error_code&) {
+                this->stack.back().key.append(s);
+                return true;
+            }
+
+            bool on_number_part(json::string_view, json::error_code&) { return true; }
+            bool on_int64(std::int64_t i, json::string_view, json::error_code&) {
+                this->attach(json::value(i, this->sp));
+                return true;
+            }
+            bool on_uint64(std::uint64_t u, json::string_view, json::error_code&) {
+                this->attach(json::value(u, this->sp));
+                return true;
+            }
+            bool on_double(double d, json::string_view, json::error_code&) {
+                this->attach(json::value(d, this->sp));
+                return true;
+            }
+            bool on_bool(bool b, json::error_code&) {
+                this->attach(json::value(b, this->sp));
+                return true;
+            }
+            bool on_null(json::error_code&) {
+                this->attach(json::value(nullptr, this->sp));
+                return true;
+            }
+
+            bool on_comment_part(json::string_view, json::error_code&) { return true; }
+            bool on_comment(json::string_view, json::error_code&) { return true; }
+
+        private:
+            struct Frame {
+                json::value container;
+                json::string key;
+            };
+
+            json::storage_ptr sp;
+            std::vector<Frame, ArenaAllocator<Frame>> stack;
+            json::string part;
+            json::value root;
+
+            void attach(json::value&& value) {
+                if (this->stack.empty()) {
+                    this->root = std::move(value);
+                    return;
+                }
+                Frame& top = this->stack.back();
+                if (top.container.is_array()) {
+                    top.container.get_array().emplace_back(std::move(value));
+                } else {
+                    top.container.get_object().insert_or_assign(top.key, std::move(value));
+                    top.key.clear();
+                }
+            }
+
+            // utf8 payloads are already a string in the arena, so they are moved
+            // out rather than copied
+            json::value collapse(json::object& encoded) {
+                const json::string& type = encoded.at(Encoding::TYPE_KEY).get_string();
+                json::value& val = encoded.at(Encoding::VALUE_KEY);
+                if (type == Encoding::UTF8 && val.is_string()) {
+                    return std::move(val);
+                }
+                const std::string decoded = Encoding::decodeString(encoded);
+                return json::value(json::string(json::string_view(decoded.data(), decoded.size()), this->sp));
+            }
+    };
+
+    // Writes through a serializer so scalars and escaping match json::serialize
+    void put(json::serializer& sr, std::string& out) {
+        char buf[512];
+        while (!sr.done()) {
+            const json::string_view chunk = sr.read(buf, sizeof(buf));
+            out.append(chunk.data(), chunk.size());
+        }
+    }
+
+    void putString(json::serializer& sr, std::string_view str, std::string& out) {
+        if (Encoding::isValidUtf8(str)) {
+            out.append("{\"__encoding_type__\":\"utf8\",\"__val__\":");
+            sr.reset(json::string_view(str.data(), str.size()));
+            put(sr, out);
+        } else {
+            const std::string b64 = Encoding::base64Encode(str);
+            out.append("{\"__encoding_type__\":\"base64\",\"__val__\":\"");
+            out.append(b64);
+            out.push_back('"');
+        }
+        out.push_back('}');
+    }
+
+    void encodeValue(json::serializer& sr, const json::value& value, std::string& out) {
+        switch (value.kind()) {
+            case json::kind::string: {
+                const json::string& str = value.get_string();
+                putString(sr, std::string_view(str.data(), str.size()), out);
+                return;
+            }
+            case json::kind::int64:
+            case json::kind::uint64:
+            case json::kind::double_:
+            case json::kind::bool_:
+            case json::kind::null:
+                sr.reset(&value);
+                put(sr, out);
+                return;
+            case json::kind::array: {
+                out.push_back('[');
+                bool first = true;
+                for (const auto& item : value.get_array()) {
+                    if (!first) out.push_back(',');
+                    first = false;
+                    encodeValue(sr, item, out);
+                }
+                out.push_back(']');
+                return;
+            }
+            case json::kind::object: {
+                const json::object& obj = value.get_object();
+                // Already in wire format (e.g. a callback that encoded by hand)
+                if (Encoding::isEncoded(obj)) {
+                    sr.reset(&value);
+                    put(sr, out);
+                    return;
+                }
+                out.push_back('{');
+                bool first = true;
+                for (const auto& item : obj) {
+                    if (!first) out.push_back(',');
+                    first = false;
+                    sr.reset(item.key());
+                    put(sr, out);
+                    out.push_back(':');
+                    encodeValue(sr, item.value(), out);
+                }
+                out.push_back('}');
+                return;
+            }
+            default:
+                throw std::runtime_error("[transcoder] Unsupported JSON value kind in encode");
+        }
+    }
+}
+
+json::storage_ptr RenWeb::Transcoder::makeArena(std::size_t request_size) {
+    const std::size_t hint = (request_size > MAX_ARENA_BYTES / 4) ? MAX_ARENA_BYTES : request_size * 4;
+    return json::make_shared_resource<json::monotonic_resource>(std::max(hint, MIN_ARENA_BYTES));
+}
+
+json::value RenWeb::Transcoder::decode(std::string_view wire, json::storage_ptr sp) {
+    json::basic_parser<DecodeHandler> parser(json::parse_options(), sp);
+    json::error_code ec;
+    const std::size_t consumed = parser.write_some(false, wire.data(), wire.size(), ec);
+    if (!ec && consumed < wire.size()) {
+        ec = json::error::extra_data;
+    }
+    if (ec) {
+        throw std::runtime_error("[transcoder] Could not parse binding arguments: " + ec.message());
+    }
+    return parser.handler().release();
+}
+
+void RenWeb::Transcoder::encode(const json::value& value, std::string& out) {
+    json::serializer sr;
+    encodeValue(sr, value, out);
+}
+
+std::string RenWeb::Transcoder::encode(const json::value& value) {
+    std::string out;
+    out.reserve(256);
+    encode(value, out);
+    return out;
+}
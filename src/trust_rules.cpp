@@ -0,0 +1,121 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/trust_rules.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <regex>
+
+using TrustRules = RenWeb::TrustRules;
+
+static std::string toLowerAscii(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+static std::string normalizeOriginOrUri(const std::string& value) {
+    static const std::regex origin_regex(R"(^([a-zA-Z][a-zA-Z0-9+.-]*://[^/\s?#]+))");
+    std::smatch match;
+    if (std::regex_search(value, match, origin_regex) && match.size() > 1) {
+        return toLowerAscii(match[1].str());
+    }
+    return toLowerAscii(value);
+}
+
+static std::string extractHostFromUri(const std::string& value) {
+    static const std::regex host_regex(R"(^[a-zA-Z][a-zA-Z0-9+.-]*://([^/:?#\s]+))");
+    std::smatch match;
+    if (std::regex_search(value, match, host_regex) && match.size() > 1) {
+        return toLowerAscii(match[1].str());
+    }
+    return std::string();
+}
+
+static std::string trimAscii(std::string value) {
+    const auto start = value.find_first_not_of(" \t\n\r");
+    if (start == std::string::npos) {
+        return std::string();
+    }
+    const auto end = value.find_last_not_of(" \t\n\r");
+    return value.substr(start, end - start + 1);
+}
+
+static bool matchesRuleSets(const std::unordered_set<std::string>& origins, const std::unordered_set<std::string>& names, const std::string& target) {
+    if (TrustRules::isUriLike(target)) {
+        const std::string target_origin = normalizeOriginOrUri(target);
+        return origins.count(target_origin) > 0
+            || names.count(target_origin) > 0
+            || names.count(extractHostFromUri(target)) > 0;
+    }
+    return names.count(toLowerAscii(target)) > 0;
+}
+
+/*static*/ bool TrustRules::isUriLike(const std::string& value) {
+    static const std::regex uri_regex(R"(^[a-zA-Z][a-zA-Z0-9+.-]*://[^\s]+$)");
+    return std::regex_match(value, uri_regex);
+}
+
+bool TrustRules::denies(const std::string& target) const {
+    return matchesRuleSets(this->deny_origins, this->deny_names, target);
+}
+
+bool TrustRules::allows(const std::string& target) const {
+    return !this->denies(target) && matchesRuleSets(this->allow_origins, this->allow_names, target);
+}
+
+/*static*/ TrustRules TrustRules::compile(const json::value& rules) {
+    TrustRules compiled;
+    compiled.present = rules.is_array() || rules.is_string();
+
+    auto process_rule = [&compiled](const std::string& raw) {
+        std::string r = trimAscii(raw);
+        if (r.empty()) return;
+        const bool deny = (r[0] == '!');
+        if (deny) {
+            r = trimAscii(r.substr(1));
+            if (r.empty()) return;
+        }
+        if (TrustRules::isUriLike(r)) {
+            (deny ? compiled.deny_origins : compiled.allow_origins).insert(normalizeOriginOrUri(r));
+        } else {
+            (deny ? compiled.deny_names : compiled.allow_names).insert(toLowerAscii(r));
+        }
+    };
+
+    if (rules.is_array()) {
+        for (const auto& entry : rules.as_array()) {
+            if (entry.is_string())
+                process_rule(std::string(entry.as_string().c_str()));
+        }
+    } else if (rules.is_string()) {
+        process_rule(std::string(rules.as_string().c_str()));
+    }
+    return compiled;
+}
@@ -33,7 +33,16 @@
 #include "../include/config.hpp"
 #include "../include/locate.hpp"
 #include <boost/json/serialize.hpp>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdio>
+#include <condition_variable>
+#include <deque>
 #include <exception>
+#include <functional>
+#include <random>
+#include <type_traits>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -46,10 +55,18 @@
     #include <filesystem>
     #include <fstream>
 #endif
+#if !defined(_WIN32)
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <sys/un.h>
+#endif
 
 using WebServer = RenWeb::WebServer;
 using MethodsCM = RenWeb::CallbackManager<std::string, void, const httplib::Request&, httplib::Response&>;
 
+// Mapped bodies are written in slices so a truncated file is noticed before its pages are touched
+static constexpr size_t MAPPED_WRITE_SLICE = 1024 * 1024;
+
 
 WebServer::WebServer(
     std::shared_ptr<ILogger> logger,
@@ -63,13 +80,60 @@ WebServer::WebServer(
     if (!port.is_null()) {
         this->port =  static_cast<unsigned short>(port.as_int64());
     }
+    // Media range requests mostly wait on I/O, so default to more workers than cores
+    this->http_workers = std::clamp<size_t>(std::thread::hardware_concurrency() * 2, 8, 64);
+    const json::value server_opts = this->app->info->getProperty("server");
+    if (server_opts.is_object()) {
+        const json::object& opts = server_opts.as_object();
+        auto read_count = [&opts](const char* key, auto& target) {
+            if (opts.contains(key) && opts.at(key).is_number()) {
+                target = static_cast<std::remove_reference_t<decltype(target)>>(std::max<int64_t>(0, opts.at(key).to_number<int64_t>()));
+            }
+        };
+        read_count("asset_cache_bytes", this->asset_cache_budget);
+        read_count("asset_cache_max_file_bytes", this->asset_cache_max_file);
+        read_count("workers", this->http_workers);
+        read_count("max_queued_requests", this->http_max_queued);
+        read_count("keep_alive_max_count", this->keep_alive_max_count);
+        read_count("keep_alive_timeout_s", this->keep_alive_timeout_s);
+        read_count("read_timeout_ms", this->read_timeout_ms);
+        read_count("write_timeout_ms", this->write_timeout_ms);
+        read_count("peer_threads", this->peer_threads);
+        read_count("peer_queue_limit", this->peer_queue_limit);
+        read_count("peer_batch_max", this->peer_batch_max);
+        read_count("inbox_messages", this->inbox_messages);
+        read_count("inbox_bytes", this->inbox_bytes);
+        this->http_workers = std::max<size_t>(1, this->http_workers);
+        this->peer_threads = std::max<size_t>(1, this->peer_threads);
+        this->peer_batch_max = std::max<size_t>(1, this->peer_batch_max);
+        this->inbox_messages = std::max<size_t>(1, this->inbox_messages);
+        if (opts.contains("mime_types") && opts.at("mime_types").is_object()) {
+            this->setMimeOverrides(opts.at("mime_types").as_object());
+        }
+        if (opts.contains("mmap") && opts.at("mmap").is_bool()) {
+            this->map_large_files = opts.at("mmap").as_bool();
+        }
+        if (opts.contains("metrics") && opts.at("metrics").is_bool()) {
+            this->metrics_endpoint = opts.at("metrics").as_bool();
+        }
+        if (opts.contains("metrics_token") && opts.at("metrics_token").is_string()) {
+            this->metrics_token = opts.at("metrics_token").as_string().c_str();
+        }
+    }
+    this->inbox = std::make_unique<MessageInbox>(this->inbox_messages, this->inbox_bytes);
     this->server = std::make_unique<httplib::Server>();
         
     this->setHandles();
     this->setMethodCallbacks();
+    this->startOutbox();
 }
 
 WebServer::~WebServer() {
+    this->closing = true;
+    this->stopOutbox();
+    this->closeEventStreams();
+    this->stopAssetWatch();
+    this->stopSocketListener();
     if (this->server && this->server->is_running()) {
         this->logger->trace("[server] Stopping server during WebServer destruction");
         try {
@@ -88,6 +152,18 @@ std::string WebServer::getURL() const /*override*/ {
     return "http://" + this->ip + ":" + std::to_string(this->port);
 }
 
+std::string WebServer::getSocketPath() const /*override*/ {
+    return this->socket_path.string();
+}
+
+json::object WebServer::getMetrics() const /*override*/ {
+    return this->request_metrics.toJson();
+}
+
+std::string WebServer::getPrometheusMetrics() const /*override*/ {
+    return this->request_metrics.toPrometheus();
+}
+
 std::string WebServer::getBasePath() const /*override*/ {
     return this->base_path.string();
 }
@@ -100,6 +176,11 @@ void WebServer::start() /*override*/ {
         this->logger->error("[server] Can't start server while the server thread is in use.");
         return;
     }
+    {
+        std::lock_guard<std::mutex> lock(this->events_mtx);
+        this->events_closing = false;
+    }
+    this->refreshCachePolicy();
     this->server_thread = std::thread([this](){
         try {
             if (this->port == 0) {
@@ -117,6 +198,8 @@ void WebServer::start() /*override*/ {
         }
     });
     this->server->wait_until_ready();
+    this->startSocketListener();
+    this->startAssetWatch();
 }
 
 void WebServer::stop() /*override*/ {
@@ -127,6 +210,7 @@ void WebServer::stop() /*override*/ {
         this->logger->error("[server] Can't stop server while the server thread isn't being used.");
         return;
     }
+    this->closeEventStreams();
     try {
         if (this->server->is_running()) {
             this->server->wait_until_ready();
@@ -138,6 +222,8 @@ void WebServer::stop() /*override*/ {
     } catch (const std::exception& e) {
         this->logger->error("[server] " + std::string(e.what()));
     }
+    this->stopSocketListener();
+    this->stopAssetWatch();
     this->logger->trace("[server] Server stopped");
 }
 
@@ -148,56 +234,288 @@ bool WebServer::isURI(const std::string& uri) const {
     return std::regex_match(uri, uri_regex);
 }
 
-const std::vector<json::value>& WebServer::getMessages() const /*override*/ {
-    return this->messages;
+// A connection is served start to finish on one worker, so the pre-routing hook can hand
+// the start time to the logger (which runs after the last byte is written) without locking.
+// Requests rejected before routing never set it and are counted as untimed.
+static thread_local std::chrono::steady_clock::time_point request_started;
+static thread_local bool request_timed = false;
+
+static httplib::Server::HandlerResponse stampRequestStart(const httplib::Request& req, httplib::Response& res) {
+    (void)req;
+    (void)res;
+    request_started = std::chrono::steady_clock::now();
+    request_timed = true;
+    return httplib::Server::HandlerResponse::Unhandled;
 }
 
-void WebServer::sendMessage(const std::string& ip, const json::value& message, time_t timeout_s, time_t timeout_ms) const /*override*/ {
-    json::object payload;
-    payload["message"] = message;
-    payload["sender"] = this->app->procm->dumpCurrentProcess();
-    payload["timestamp"] = std::chrono::duration_cast<std::chrono::nanoseconds>(
-        std::chrono::system_clock::now().time_since_epoch()
-    ).count();    
-    std::string url = ip;
-    if (url.find("://") == std::string::npos) {
-        url = "http://" + url; // assume http if no protocol specified
+// Serves only the IPC routes (/??q=) on .renweb/proc/<pid>/ipc.sock. Siblings on the same
+// machine skip TCP and loopback overhead; the TCP listener keeps serving everything else.
+void WebServer::startSocketListener() {
+#if defined(_WIN32)
+    this->logger->trace("[server] Unix domain socket IPC is not used on Windows");
+#else
+    if (this->socket_thread.joinable()) return;
+    const std::filesystem::path pid_dir = Locate::tempDirectory() / ".renweb" / "proc" / std::to_string(this->app->procm->getPid());
+    const std::filesystem::path path = pid_dir / "ipc.sock";
+    if (path.string().size() >= sizeof(sockaddr_un::sun_path)) {
+        this->logger->debug("[server] Socket path too long for AF_UNIX, peers will use TCP: " + path.string());
+        return;
     }
-    
-    this->logger->trace("[server] Sending message to " + url + ": " + json::serialize(message));
-    std::thread([url, payload, timeout_s, timeout_ms](){
-        httplib::Client client(url);
-        client.set_connection_timeout(timeout_s, timeout_ms);
-        client.set_read_timeout(timeout_s, timeout_ms);
-        client.set_write_timeout(timeout_s, timeout_ms);
-        client.Post("/??q=", json::serialize(payload), "application/json");
-        client.stop();
-    }).detach();
-}
-
-json::object WebServer::whoAreYou(const std::string& ip, time_t timeout_s, time_t timeout_ms) const /*override*/ {
-    std::string url = ip;
-    if (url.find("://") == std::string::npos) {
-        url = "http://" + url; // assume http if no protocol specified
+    std::error_code ec;
+    std::filesystem::create_directories(pid_dir, ec);
+    // A previous process with the same PID may have left its socket behind
+    std::filesystem::remove(path, ec);
+
+    auto server = std::make_unique<httplib::Server>();
+    server->set_address_family(AF_UNIX);
+    server->set_keep_alive_max_count(this->keep_alive_max_count);
+    server->set_keep_alive_timeout(this->keep_alive_timeout_s);
+    server->set_pre_routing_handler(stampRequestStart);
+    server->set_logger([this](const httplib::Request& req, const httplib::Response& res) {
+        this->recordRequest(req, res);
+        this->logger->debug("[server] unix " + req.method + " " + req.path + " -> " + std::to_string(res.status));
+    });
+    server->Get(".*", [this](const httplib::Request& req, httplib::Response& res) {
+        if (req.target == "/??q=") {
+            this->serveProcessInfo(req, res);
+        } else {
+            this->sendStatus(req, res, httplib::StatusCode::NotFound_404, "Only IPC routes are served on this socket.");
+        }
+    });
+    server->Post(".*", [this](const httplib::Request& req, httplib::Response& res) {
+        if (req.target == "/??q=") {
+            this->receiveMessage(req, res);
+        } else {
+            this->sendStatus(req, res, httplib::StatusCode::MethodNotAllowed_405, "POST cannot be used in this context: " + req.target);
+        }
+    });
+    if (!server->bind_to_port(path.string(), 80)) {
+        this->logger->warn("[server] Could not bind " + path.string() + ", peers will use TCP");
+        return;
     }
-    
-    httplib::Client client(url);
-    client.set_connection_timeout(timeout_s, timeout_ms);
-    client.set_read_timeout(timeout_s, timeout_ms);
-    client.set_write_timeout(timeout_s, timeout_ms);
-    auto res = client.Get("/??q=");
-    client.stop();
+    // Same user only; the directory lives in a shared temp dir
+    ::chmod(path.c_str(), S_IRUSR | S_IWUSR);
+    this->socket_server = std::move(server);
+    this->socket_path = path;
+    this->socket_thread = std::thread([this]() {
+        try {
+            this->socket_server->listen_after_bind();
+        } catch (const std::exception& e) {
+            this->logger->error("[server] unix socket: " + std::string(e.what()));
+        }
+    });
+    this->socket_server->wait_until_ready();
+    this->logger->info("[server] IPC socket at " + path.string());
+#endif
+}
 
-    this->logger->trace("[server] whoAreYou queried " + url);
-    return (res && res->status == 200) ? json::parse(res->body).as_object() : json::object{};
+void WebServer::stopSocketListener() {
+    if (this->socket_server && this->socket_server->is_running()) {
+        try {
+            this->socket_server->stop();
+        } catch (...) { }
+    }
+    if (this->socket_thread.joinable()) {
+        try {
+            this->socket_thread.join();
+        } catch (...) { }
+    }
+    if (!this->socket_path.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(this->socket_path, ec);
+        this->socket_path.clear();
+    }
+    this->socket_server.reset();
+}
+
+json::object WebServer::getMessages(uint64_t since_seq, size_t max) const /*override*/ {
+    return this->inbox->read(since_seq, max);
 }
 
+std::string WebServer::registerBlob(const std::filesystem::path& path, std::chrono::seconds ttl) /*override*/ {
+    static const char hex[] = "0123456789abcdef";
+    std::random_device rd;
+    std::string token;
+    token.reserve(32);
+    for (int i = 0; i < 4; i++) {
+        uint32_t r = rd();
+        for (int j = 0; j < 8; j++) {
+            token += hex[r & 0xF];
+            r >>= 4;
+        }
+    }
+    const auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(this->blobs_mtx);
+        for (auto it = this->blobs.begin(); it != this->blobs.end();) {
+            it = (it->second.expires <= now) ? this->blobs.erase(it) : std::next(it);
+        }
+        this->blobs[token] = Blob{path, now + ttl};
+    }
+    this->logger->trace("[server] Registered blob for " + path.string() + " (" + std::to_string(ttl.count()) + "s)");
+    return token;
+}
+
+void WebServer::releaseBlob(const std::string& token) /*override*/ {
+    std::lock_guard<std::mutex> lock(this->blobs_mtx);
+    this->blobs.erase(token);
+}
+
+bool WebServer::findBlob(const std::string& token, std::filesystem::path& path) {
+    std::lock_guard<std::mutex> lock(this->blobs_mtx);
+    auto it = this->blobs.find(token);
+    if (it == this->blobs.end()) {
+        return false;
+    } else if (it->second.expires <= std::chrono::steady_clock::now()) {
+        this->blobs.erase(it);
+        return false;
+    }
+    path = it->second.path;
+    return true;
+}
+
+void WebServer::recordRequest(const httplib::Request& req, const httplib::Response& res) {
+    using Route = RequestMetrics::Route;
+    Route route;
+    if (req.target == "/??q=") {
+        route = (req.method == "POST") ? Route::IpcPost : Route::IpcGet;
+    } else if (req.target.rfind("/??blob=", 0) == 0) {
+        route = Route::Blob;
+    } else if (req.target == "/??events") {
+        route = Route::Events;
+    } else if (req.target.rfind("/??metrics", 0) == 0) {
+        route = Route::Metrics;
+    } else if (res.status >= 400) {
+        route = Route::Error;
+    } else if (req.method == "GET" || req.method == "HEAD") {
+        route = Route::File;
+    } else {
+        route = Route::Other;
+    }
+    // httplib fills in Content-Length before writing, which also covers ranged and mapped bodies
+    uint64_t bytes = res.body.size();
+    const std::string length = res.get_header_value("Content-Length");
+    if (!length.empty()) {
+        try {
+            bytes = std::stoull(length);
+        } catch (...) { }
+    }
+    if (request_timed) {
+        request_timed = false;
+        this->request_metrics.record(route, res.status, bytes, std::chrono::steady_clock::now() - request_started);
+    } else {
+        this->request_metrics.recordUntimed(route, res.status, bytes);
+    }
+}
+
+// Loopback only, and never readable from a page of another origin shown in the webview
+bool WebServer::isSameOriginRequest(const httplib::Request& req) const {
+    if (req.remote_addr != "127.0.0.1" && req.remote_addr != "::1") return false;
+    const std::string site = req.get_header_value("Sec-Fetch-Site");
+    if (!site.empty() && site != "same-origin" && site != "none") return false;
+    if (req.has_header("Origin") && req.get_header_value("Origin") != this->getURL()) return false;
+    return true;
+}
+
+bool WebServer::isMetricsRequestTrusted(const httplib::Request& req) const {
+    if (!this->metrics_endpoint || !this->isSameOriginRequest(req)) return false;
+    if (!this->metrics_token.empty() && req.get_header_value("Authorization") != "Bearer " + this->metrics_token) return false;
+    return true;
+}
+
+// Fixed-size pool fed by httplib's accept loop. Unlike httplib::ThreadPool it reports
+// its depth and busy workers, and queued connections are still served on shutdown.
+class WebServer::WorkerPool : public httplib::TaskQueue {
+    public:
+        WorkerPool(size_t num_workers, size_t max_queued, PoolStats& stats)
+            : max_queued(max_queued)
+            , stats(stats)
+        {
+            this->stats.workers = num_workers;
+            for (size_t i = 0; i < num_workers; i++) {
+                this->threads.emplace_back([this]() { this->work(); });
+            }
+        }
+        ~WorkerPool() override {
+            this->shutdown();
+        }
+
+        bool enqueue(std::function<void()> fn) override {
+            {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                if (this->stopping || (this->max_queued > 0 && this->jobs.size() >= this->max_queued)) {
+                    this->stats.rejected++;
+                    return false;
+                }
+                this->jobs.emplace_back(std::move(fn), std::chrono::steady_clock::now());
+                const size_t depth = this->jobs.size();
+                this->stats.queue_depth = depth;
+                if (depth > this->stats.max_queue_depth) this->stats.max_queue_depth = depth;
+            }
+            this->cv.notify_one();
+            return true;
+        }
+
+        void shutdown() override {
+            {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                if (this->stopping && this->threads.empty()) return;
+                this->stopping = true;
+            }
+            this->cv.notify_all();
+            for (auto& thread : this->threads) {
+                if (thread.joinable()) thread.join();
+            }
+            this->threads.clear();
+            this->stats.workers = 0;
+        }
+    private:
+        std::vector<std::thread> threads;
+        std::deque<std::pair<std::function<void()>, std::chrono::steady_clock::time_point>> jobs;
+        std::mutex mtx;
+        std::condition_variable cv;
+        const size_t max_queued;
+        bool stopping = false;
+        PoolStats& stats;
+
+        void work() {
+            while (true) {
+                std::function<void()> fn;
+                {
+                    std::unique_lock<std::mutex> lock(this->mtx);
+                    this->cv.wait(lock, [this]() { return this->stopping || !this->jobs.empty(); });
+                    // Drain before exiting: every queued job owns an accepted socket
+                    if (this->jobs.empty()) return;
+                    const uint64_t wait_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - this->jobs.front().second).count());
+                    fn = std::move(this->jobs.front().first);
+                    this->jobs.pop_front();
+                    this->stats.queue_depth = this->jobs.size();
+                    this->stats.wait_ns_total += wait_ns;
+                    if (wait_ns > this->stats.wait_ns_max) this->stats.wait_ns_max = wait_ns;
+                }
+                this->stats.busy++;
+                try {
+                    fn();
+                } catch (...) { }
+                this->stats.busy--;
+                this->stats.completed++;
+            }
+        }
+};
+
 void WebServer::setHandles() {
-    this->server->set_keep_alive_max_count(100);
-    this->server->set_read_timeout(10, 0);
-    this->server->set_write_timeout(10, 0);
+    this->server->new_task_queue = [this]() -> httplib::TaskQueue* {
+        return new WorkerPool(this->http_workers, this->http_max_queued, this->pool_stats);
+    };
+    this->server->set_keep_alive_max_count(this->keep_alive_max_count);
+    this->server->set_keep_alive_timeout(this->keep_alive_timeout_s);
+    this->server->set_read_timeout(this->read_timeout_ms / 1000, (this->read_timeout_ms % 1000) * 1000);
+    this->server->set_write_timeout(this->write_timeout_ms / 1000, (this->write_timeout_ms % 1000) * 1000);
     
+    this->server->set_pre_routing_handler(stampRequestStart);
     this->server->set_logger([this](const httplib::Request& req, const httplib::Response& res) {
+        this->recordRequest(req, res);
         this->logger->debug("[server] " + req.method + " " + req.path + " -> " + std::to_string(res.status));
     });
     this->server->set_error_logger([this](const httplib::Error& err, const httplib::Request* req) {
@@ -247,31 +565,48 @@ void WebServer::setHandles() {
 void WebServer::setMethodCallbacks() {
     this->server->Get(".*", [this](const httplib::Request &req, httplib::Response &res) {
         if (req.target == "/??q=") {
-            try {
-                json::object proc_info = this->app->procm->dumpCurrentProcess();
-                proc_info["is_child"] = json::value(nullptr);
-                res.set_content(json::serialize(proc_info), "application/json");
-                res.status = httplib::StatusCode::OK_200;
-            } catch (const std::exception& e) {
-                this->sendStatus(req, res, httplib::StatusCode::InternalServerError_500, std::string(e.what()));
+            this->serveProcessInfo(req, res);
+            return;
+        } else if (req.target.rfind("/??blob=", 0) == 0) {
+            std::filesystem::path path;
+            if (!this->findBlob(req.target.substr(8), path)) {
+                this->sendStatus(req, res, httplib::StatusCode::NotFound_404, "Unknown or expired blob.");
+                return;
             }
+            res.set_header("Cache-Control", "no-store");
+            this->sendFile(req, res, path);
+            return;
+        } else if (req.target == "/??events") {
+            this->streamEvents(req, res);
+            return;
+        } else if (req.target == "/??metrics" || req.target.rfind("/??metrics=", 0) == 0) {
+            if (!this->isMetricsRequestTrusted(req)) {
+                this->sendStatus(req, res, httplib::StatusCode::Forbidden_403, "Metrics are only served to trusted local clients.");
+                return;
+            }
+            res.set_header("Cache-Control", "no-store");
+            if (req.target == "/??metrics=prometheus") {
+                res.set_content(this->getPrometheusMetrics(), "text/plain; version=0.0.4; charset=utf-8");
+            } else {
+                res.set_content(json::serialize(this->getMetrics()), "application/json");
+            }
+            res.status = httplib::StatusCode::OK_200;
+            return;
+        }
+        ResolvedAsset asset;
+        if (this->resolveAsset(req.target, asset)) {
+            const std::string dest = req.get_header_value("Sec-Fetch-Dest");
+            if (asset.mime.rfind("text/html", 0) == 0 && (dest.empty() || dest == "document")) {
+                // Marks a page load, from which that page's event stream will replay
+                this->document_seq = this->inbox->getNewestSeq();
+            }
+            res.set_header("Cache-Control", this->getCacheControl());
+            this->sendFile(req, res, asset);
             return;
         }
         std::filesystem::path target_dir = (req.target == "/")
             ? "index.html"
             : std::filesystem::path(req.target.substr(1)).string();  
-            std::array<std::filesystem::path, 4> search_paths = {
-                this->base_path / "custom" / this->app->config->current_page / target_dir,
-                this->base_path / "content" / this->app->config->current_page / target_dir,
-                this->base_path / target_dir,
-                this->base_path / "backup" / this->app->config->current_page / target_dir
-            };
-        for (const auto& path : search_paths) {
-            if (std::filesystem::exists(path)) {
-                this->sendFile(req, res, path);
-                return;
-            }
-        }
         // Build clickable file:// links for searched paths
         auto make_link = [](const std::filesystem::path& p) {
             return "<a href=\"file://" + p.string() + "\" style=\"color: #64b5f6; text-decoration: underline;\">" + p.string() + "</a>";
@@ -288,51 +623,10 @@ void WebServer::setMethodCallbacks() {
     });
     this->server->Post(".*", [this](const httplib::Request &req, httplib::Response &res) {
         if (req.target == "/??q=") {
-            this->messages.push_back(json::parse(req.body));
-            
-            std::string escaped_body;
-            escaped_body.reserve(req.body.length() * 2);
-            for (char c : req.body) {
-                switch (c) {
-                    case '\\': escaped_body += "\\\\"; break;
-                    case '\'': escaped_body += "\\'"; break;
-                    case '\n': escaped_body += "\\n"; break;
-                    case '\r': escaped_body += "\\r"; break;
-                    default: escaped_body += c; break;
-                }
-            }
-            
-            std::string callback_js = 
-                "(async () => {"
-                "  function decode(dec) {"
-                "    if (!dec || typeof dec !== 'object' || !dec.__encoding_type__ || !dec.__val__) return dec;"
-                "    switch (dec.__encoding_type__) {"
-                "      case 'base64':"
-                "        return new TextDecoder().decode(new Uint8Array(dec.__val__));"
-                "      default:"
-                "        return null;"
-                "    }"
-                "  }"
-                "  function decodeObj(obj) {"
-                "    if (!obj || typeof obj !== 'object') return obj;"
-                "    for (const key in obj) {"
-                "      if (obj[key] != null && typeof obj[key] === 'object' && '__encoding_type__' in obj[key] && '__val__' in obj[key]) {"
-                "        obj[key] = decode(obj[key]);"
-                "      }"
-                "    }"
-                "    return obj;"
-                "  }"
-                "  const message = JSON.parse('" + escaped_body + "');"
-                "  const decoded = decodeObj(message);"
-                "  await window.renweb?.onServerMessage?.(decoded);"
-                "})();";
-            this->app->w->dispatch([this, callback_js]() {
-                this->app->w->eval(callback_js);
-            });
+            this->receiveMessage(req, res);
         } else {
             this->sendStatus(req, res, httplib::StatusCode::MethodNotAllowed_405, "POST cannot be used in this context: " + req.target);
         }
-        this->logger->trace("[server] Received message. New count is " + std::to_string(this->messages.size()));
     });
     this->server->Patch(".*", [this](const httplib::Request &req, httplib::Response &res) {
         this->sendStatus(req, res, httplib::StatusCode::MethodNotAllowed_405);
@@ -342,6 +636,236 @@ void WebServer::setMethodCallbacks() {
     });
 }
 
+void WebServer::serveProcessInfo(const httplib::Request& req, httplib::Response& res) {
+    try {
+        json::object proc_info = this->app->procm->dumpCurrentProcess();
+        proc_info["is_child"] = json::value(nullptr);
+        res.set_content(json::serialize(proc_info), "application/json");
+        res.status = httplib::StatusCode::OK_200;
+    } catch (const std::exception& e) {
+        this->sendStatus(req, res, httplib::StatusCode::InternalServerError_500, std::string(e.what()));
+    }
+}
+
+void WebServer::receiveMessage(const httplib::Request& req, httplib::Response& res) {
+    (void)res;
+    // Senders batch queued messages into one JSON array; its size is split evenly for the byte limit
+    json::value received = json::parse(req.body);
+    uint64_t last_seq = 0;
+    if (received.is_array()) {
+        json::array& batch = received.as_array();
+        const size_t share = batch.empty() ? 0 : req.body.size() / batch.size();
+        for (auto& message : batch) {
+            last_seq = this->inbox->push(std::move(message), share);
+        }
+    } else {
+        last_seq = this->inbox->push(std::move(received), req.body.size());
+    }
+    bool by_script;
+    {
+        // Taken so a stream between its predicate check and its wait cannot miss this
+        std::lock_guard<std::mutex> lock(this->events_mtx);
+        // Pages served from here receive messages over /??events; only other pages still need a script.
+        // Messages a closing stream already replayed through the script are not sent twice.
+        by_script = this->event_subscribers == 0 && last_seq > this->events_replayed_seq;
+    }
+    this->events_cv.notify_all();
+    this->logger->trace("[server] Received message. Last sequence number is " + std::to_string(last_seq));
+    if (by_script) this->deliverMessagesByScript(req.body);
+}
+
+void WebServer::deliverMessagesByScript(const std::string& body) {
+    std::string escaped_body;
+    escaped_body.reserve(body.length() * 2);
+    for (char c : body) {
+        switch (c) {
+            case '\\': escaped_body += "\\\\"; break;
+            case '\'': escaped_body += "\\'"; break;
+            case '\n': escaped_body += "\\n"; break;
+            case '\r': escaped_body += "\\r"; break;
+            default: escaped_body += c; break;
+        }
+    }
+    
+    std::string callback_js = 
+        "(async () => {"
+        // Pages subscribed to /??events (or about to be) get this from the stream instead
+        "  if (window.renweb?.__events && window.renweb.__events.readyState !== 2) return;"
+        "  function decode(dec) {"
+        "    if (!dec || typeof dec !== 'object' || !dec.__encoding_type__ || dec.__val__ == null) return dec;"
+        "    switch (dec.__encoding_type__) {"
+        "      case 'utf8':"
+        "        return dec.__val__;"
+        "      case 'base64':"
+        "        return new TextDecoder().decode((typeof dec.__val__ === 'string')"
+        "          ? Uint8Array.from(atob(dec.__val__), c => c.charCodeAt(0))"
+        "          : new Uint8Array(dec.__val__));"
+        "      default:"
+        "        return null;"
+        "    }"
+        "  }"
+        "  function decodeObj(obj) {"
+        "    if (!obj || typeof obj !== 'object') return obj;"
+        "    for (const key in obj) {"
+        "      if (obj[key] != null && typeof obj[key] === 'object' && '__encoding_type__' in obj[key] && '__val__' in obj[key]) {"
+        "        obj[key] = decode(obj[key]);"
+        "      }"
+        "    }"
+        "    return obj;"
+        "  }"
+        "  const received = JSON.parse('" + escaped_body + "');"
+        "  for (const message of (Array.isArray(received) ? received : [received])) {"
+        "    await window.renweb?.onServerMessage?.(decodeObj(message));"
+        "  }"
+        "})();";
+    this->app->w->queue_eval(std::move(callback_js));
+}
+
+// Page glue for /??events. Only pages on this server's exact origin subscribe, so unrelated
+// local dev servers never see the request. The stream is exposed as renweb.__events, which the
+// injected-script fallback in receiveMessage checks to avoid delivering a message twice.
+std::string WebServer::getInitScript() const /*override*/ {
+    const std::string origin = json::serialize(json::value(this->getURL()));
+    return
+        "(function() {"
+        "  if (window.top !== window || location.origin !== " + origin + ""
+        "      || typeof EventSource !== 'function' || !window.renweb) return;"
+        "  var _decode = function(dec) {"
+        "    if (!dec || typeof dec !== 'object' || !dec.__encoding_type__ || dec.__val__ == null) return dec;"
+        "    switch (dec.__encoding_type__) {"
+        "      case 'utf8': return dec.__val__;"
+        "      case 'base64': return new TextDecoder().decode((typeof dec.__val__ === 'string')"
+        "        ? Uint8Array.from(atob(dec.__val__), function(c) { return c.charCodeAt(0); })"
+        "        : new Uint8Array(dec.__val__));"
+        "      default: return null;"
+        "    }"
+        "  };"
+        "  var _delivered = Promise.resolve();"
+        "  var _events = new EventSource('/??events');"
+        "  Object.defineProperty(window.renweb, '__events', { value: _events, configurable: true });"
+        "  _events.onmessage = function(e) {"
+        "    var msg;"
+        "    try { msg = JSON.parse(e.data); } catch (err) { return; }"
+        "    if (msg && typeof msg === 'object') {"
+        "      for (var key in msg) {"
+        "        if (msg[key] != null && typeof msg[key] === 'object' && '__encoding_type__' in msg[key] && '__val__' in msg[key]) {"
+        "          msg[key] = _decode(msg[key]);"
+        "        }"
+        "      }"
+        "    }"
+        // Chained so a slow async handler still sees messages in order
+        "    _delivered = _delivered.then(function() {"
+        "      var fn = window.renweb.onServerMessage;"
+        "      if (typeof fn === 'function') return fn(msg);"
+        "    }).catch(function(err) { console.error('[renweb] onServerMessage error:', err); });"
+        "  };"
+        "})();";
+}
+
+// Server-sent events: one "message" event per inbox entry, with the sequence number as its id
+// so a reconnecting EventSource resumes through Last-Event-ID. A comment line every 15s
+// keeps idle streams from timing out.
+void WebServer::streamEvents(const httplib::Request& req, httplib::Response& res) {
+    if (!this->isSameOriginRequest(req)) {
+        this->sendStatus(req, res, httplib::StatusCode::Forbidden_403, "Events are only streamed to this app's own pages.");
+        return;
+    }
+    // A fresh stream replays everything since its page was served; the previous page's stream
+    // may still have been counted as a subscriber, so those messages skipped the script fallback
+    uint64_t cursor = std::min(this->document_seq.load(), this->inbox->getNewestSeq());
+    const std::string last_event_id = req.get_header_value("Last-Event-ID");
+    if (!last_event_id.empty()) {
+        try {
+            cursor = std::min<uint64_t>(std::stoull(last_event_id), this->inbox->getNewestSeq());
+        } catch (...) { }
+    }
+    res.set_header("Cache-Control", "no-store");
+    this->event_subscribers++;
+    this->logger->debug("[server] Event stream opened (" + std::to_string(this->event_subscribers.load()) + " open)");
+    // Released as soon as the page is seen gone, not only when httplib finally tears the stream down
+    auto subscribed = std::make_shared<std::atomic<bool>>(true);
+    auto delivered = std::make_shared<std::atomic<uint64_t>>(cursor);
+    auto release = [this, subscribed, delivered]() {
+        if (subscribed->exchange(false)) this->releaseEventSubscriber(*delivered);
+    };
+    res.set_chunked_content_provider("text/event-stream",
+        [this, cursor, delivered, release](size_t offset, httplib::DataSink& sink) mutable -> bool {
+            (void)offset;
+            // Wake every second to notice a page that went away, so the subscriber count stays honest
+            const auto keep_alive_at = std::chrono::steady_clock::now() + std::chrono::seconds(15);
+            bool closing = false;
+            while (true) {
+                bool woke;
+                {
+                    std::unique_lock<std::mutex> lock(this->events_mtx);
+                    woke = this->events_cv.wait_for(lock, std::chrono::seconds(1), [this, cursor]() {
+                        return this->events_closing || this->inbox->getNewestSeq() > cursor;
+                    });
+                    closing = this->events_closing;
+                }
+                if (woke || std::chrono::steady_clock::now() >= keep_alive_at) break;
+                if (!sink.is_writable()) {
+                    release();
+                    return false;
+                }
+            }
+            if (closing) {
+                sink.done();
+                return true;
+            }
+            const json::object batch = this->inbox->read(cursor, 256);
+            std::string frames;
+            for (const auto& message : batch.at("messages").as_array()) {
+                const json::value* seq = message.is_object() ? message.as_object().if_contains("seq") : nullptr;
+                if (seq != nullptr) {
+                    frames += "id: " + json::serialize(*seq) + "\n";
+                }
+                frames += "data: " + json::serialize(message) + "\n\n";
+            }
+            const uint64_t last_seq = batch.at("last_seq").to_number<uint64_t>();
+            if (frames.empty()) frames = ": keep-alive\n\n";
+            if (!sink.write(frames.data(), frames.size())) {
+                release();
+                return false;
+            }
+            cursor = last_seq;
+            *delivered = cursor;
+            return true;
+        },
+        [release](bool success) {
+            (void)success;
+            release();
+        }
+    );
+}
+
+// Drops a stream from the subscriber count. When it was the last one, the page most likely navigated
+// elsewhere (possibly to an external origin), so whatever the stream had not delivered goes through the
+// script fallback instead; that script skips pages with a live stream of their own.
+void WebServer::releaseEventSubscriber(uint64_t cursor) {
+    json::array missed;
+    {
+        std::lock_guard<std::mutex> lock(this->events_mtx);
+        if (--this->event_subscribers > 0 || this->events_closing || this->closing) {
+            this->logger->debug("[server] Event stream closed");
+            return;
+        }
+        const json::object batch = this->inbox->read(std::max(cursor, this->events_replayed_seq), this->inbox_messages);
+        missed = batch.at("messages").as_array();
+        this->events_replayed_seq = std::max(this->events_replayed_seq, batch.at("last_seq").to_number<uint64_t>());
+    }
+    this->logger->debug("[server] Event stream closed, " + std::to_string(missed.size()) + " undelivered message(s) sent by script");
+    if (!missed.empty()) this->deliverMessagesByScript(json::serialize(missed));
+}
+
+void WebServer::closeEventStreams() {
+    {
+        std::lock_guard<std::mutex> lock(this->events_mtx);
+        this->events_closing = true;
+    }
+    this->events_cv.notify_all();
+}
+
 void WebServer::sendStatus(const httplib::Request& req, httplib::Response& res, const httplib::StatusCode& code, const std::string& desc) {
     (void)req;
     res.status = code;
@@ -355,7 +879,10 @@ void WebServer::sendStatus(const httplib::Request& req, httplib::Response& res,
 
 void WebServer::sendFile(const httplib::Request& req, httplib::Response& res, const std::filesystem::path& path) {
     std::error_code ec;
-    auto file_size = std::filesystem::file_size(path, ec);
+    ResolvedAsset asset;
+    asset.path = path;
+    asset.size = std::filesystem::file_size(path, ec);
+    if (!ec) asset.mtime = std::filesystem::last_write_time(path, ec);
     if (ec) {
         this->logger->critical("[server] Error getting file size: " + ec.message());
         this->sendStatus(req, res, httplib::StatusCode::InternalServerError_500, 
@@ -363,12 +890,253 @@ void WebServer::sendFile(const httplib::Request& req, httplib::Response& res, co
             "Error: " + ec.message());
         return;
     }
-    
+    asset.mime = this->getMimeType(path);
+    asset.modified = WebServer::toTimeT(asset.mtime);
+    this->sendFile(req, res, asset);
+}
+
+// True when the Accept-Encoding header lists coding without a q=0 weight
+static bool acceptsEncoding(const std::string& header, const std::string& coding) {
+    size_t start = 0;
+    while (start < header.size()) {
+        size_t end = header.find(',', start);
+        if (end == std::string::npos) end = header.size();
+        std::string entry = header.substr(start, end - start);
+        start = end + 1;
+        std::string params;
+        const size_t semi = entry.find(';');
+        if (semi != std::string::npos) {
+            params = entry.substr(semi + 1);
+            entry.resize(semi);
+        }
+        entry.erase(0, entry.find_first_not_of(" \t"));
+        entry.erase(entry.find_last_not_of(" \t") + 1);
+        std::transform(entry.begin(), entry.end(), entry.begin(), [](unsigned char c) { return std::tolower(c); });
+        if (entry != coding && entry != "*") continue;
+        params.erase(std::remove_if(params.begin(), params.end(), [](unsigned char c) { return std::isspace(c); }), params.end());
+        if (params.rfind("q=", 0) == 0) {
+            const std::string q = params.substr(2);
+            if (q.find_first_not_of("0.") == std::string::npos) return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+static const std::array<const char*, 7> HTTP_DAYS = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static const std::array<const char*, 12> HTTP_MONTHS = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+// Days since 1970-01-01 for a proleptic Gregorian date (Howard Hinnant's days_from_civil)
+static int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+// IMF-fixdate, formatted by hand so the process locale cannot change day/month names
+static std::string formatHttpDate(std::time_t time) {
+    const int64_t secs = static_cast<int64_t>(time);
+    int64_t days = secs / 86400;
+    int64_t rem = secs % 86400;
+    if (rem < 0) { rem += 86400; days--; }
+    // civil_from_days
+    const int64_t z = days + 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+    const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+    const int64_t y = static_cast<int64_t>(yoe) + era * 400 + (m <= 2);
+    const int64_t weekday = ((days % 7) + 11) % 7; // 1970-01-01 was a Thursday
+    char buffer[40];
+    std::snprintf(buffer, sizeof(buffer), "%s, %02u %s %04lld %02d:%02d:%02d GMT",
+        HTTP_DAYS[static_cast<size_t>(weekday)], d, HTTP_MONTHS[m - 1], static_cast<long long>(y),
+        static_cast<int>(rem / 3600), static_cast<int>((rem / 60) % 60), static_cast<int>(rem % 60));
+    return buffer;
+}
+
+static bool parseHttpDate(const std::string& value, std::time_t& time) {
+    char month[4] = {0};
+    int d = 0, y = 0, hh = 0, mm = 0, ss = 0;
+    if (std::sscanf(value.c_str(), "%*3s, %d %3s %d %d:%d:%d GMT", &d, month, &y, &hh, &mm, &ss) != 6) {
+        return false;
+    }
+    for (unsigned m = 0; m < HTTP_MONTHS.size(); m++) {
+        if (std::string(month) == HTTP_MONTHS[m]) {
+            time = static_cast<std::time_t>(daysFromCivil(y, m + 1, static_cast<unsigned>(d)) * 86400 + hh * 3600 + mm * 60 + ss);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Strong validator from size and native mtime ticks; encoded representations get their own suffix
+static std::string makeETag(const std::uintmax_t size, const std::filesystem::file_time_type mtime, const std::string& encoding) {
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "\"%llx-%llx", 
+        static_cast<unsigned long long>(size), static_cast<unsigned long long>(mtime.time_since_epoch().count()));
+    return std::string(buffer) + (encoding.empty() ? "" : "-" + encoding) + "\"";
+}
+
+// True when If-None-Match lists tag (weak comparison, as RFC 9110 requires for this header)
+static bool etagListMatches(const std::string& header, const std::string& tag) {
+    size_t start = 0;
+    while (start < header.size()) {
+        size_t end = header.find(',', start);
+        if (end == std::string::npos) end = header.size();
+        std::string entry = header.substr(start, end - start);
+        start = end + 1;
+        entry.erase(0, entry.find_first_not_of(" \t"));
+        entry.erase(entry.find_last_not_of(" \t") + 1);
+        if (entry.rfind("W/", 0) == 0) entry.erase(0, 2);
+        if (entry == "*" || entry == tag) return true;
+    }
+    return false;
+}
+
+static bool isCompressibleMime(const std::string& mime) {
+    if (mime.rfind("text/", 0) == 0) return true;
+    static const std::array<const char*, 6> types = {
+        "application/javascript", "application/json", "application/xml",
+        "application/wasm", "image/svg+xml", "application/manifest+json"
+    };
+    for (const char* type : types) {
+        if (mime == type) return true;
+    }
+    return mime.size() > 5 && (mime.compare(mime.size() - 5, 5, "+json") == 0 || mime.compare(mime.size() - 4, 4, "+xml") == 0);
+}
+
+void WebServer::sendFile(const httplib::Request& req, httplib::Response& res, const ResolvedAsset& source) {
     res.set_header("Accept-Ranges", "bytes");
+
+    // Prefer a precompressed sidecar, then an on-the-fly gzip, then the identity body
+    const bool compressible = isCompressibleMime(source.mime);
+    if (compressible || !source.encoded.empty()) {
+        res.set_header("Vary", "Accept-Encoding");
+    }
+    const std::string accept_encoding = req.get_header_value("Accept-Encoding");
+    const ResolvedAsset* body = &source;
+    for (const auto& variant : source.encoded) {
+        if (acceptsEncoding(accept_encoding, variant.encoding)) {
+            body = &variant;
+            break;
+        }
+    }
+    const bool try_gzip = body == &source && compressible && acceptsEncoding(accept_encoding, "gzip");
+
+    // Answer revalidations from metadata alone. Any representation this client
+    // could receive satisfies If-None-Match, since they all decode to the same bytes.
+    const std::string if_none_match = req.get_header_value("If-None-Match");
+    const std::string if_modified_since = req.get_header_value("If-Modified-Since");
+    if (!if_none_match.empty() || !if_modified_since.empty()) {
+        std::string matched;
+        if (!if_none_match.empty()) {
+            for (const std::string& tag : {
+                makeETag(body->size, body->mtime, body->encoding),
+                try_gzip ? makeETag(source.size, source.mtime, "gzip") : std::string(),
+                makeETag(source.size, source.mtime, "")
+            }) {
+                if (!tag.empty() && etagListMatches(if_none_match, tag)) {
+                    matched = tag;
+                    break;
+                }
+            }
+        } else {
+            std::time_t since = 0;
+            if (parseHttpDate(if_modified_since, since) && source.modified <= since) {
+                matched = makeETag(body->size, body->mtime, body->encoding);
+            }
+        }
+        if (!matched.empty()) {
+            this->not_modified_responses++;
+            res.set_header("ETag", matched);
+            res.set_header("Last-Modified", formatHttpDate(source.modified));
+            res.status = httplib::StatusCode::NotModified_304;
+            return;
+        }
+    }
+    res.set_header("Last-Modified", formatHttpDate(source.modified));
+
+    if (try_gzip) {
+        if (auto data = this->getCompressedAsset(source)) {
+            this->compressed_responses++;
+            res.set_header("ETag", makeETag(source.size, source.mtime, "gzip"));
+            res.set_header("Content-Encoding", "gzip");
+            res.set_content_provider(
+                data->size(),
+                source.mime,
+                [data](size_t offset, size_t length, httplib::DataSink &sink) {
+                    if (offset >= data->size()) return false;
+                    return sink.write(data->data() + offset, std::min(length, data->size() - offset));
+                }
+            );
+            return;
+        }
+    }
+    if (!body->encoding.empty()) {
+        this->sidecar_responses++;
+        res.set_header("Content-Encoding", body->encoding);
+    }
+    res.set_header("ETag", makeETag(body->size, body->mtime, body->encoding));
+    const ResolvedAsset& asset = *body;
+    const std::filesystem::path path = asset.path;
+    const size_t file_size = static_cast<size_t>(asset.size);
+    
+    // Packed assets are already in memory; the pack stays mapped while any response holds it
+    if (asset.packed != nullptr) {
+        const std::shared_ptr<const AssetPack> pack = asset.pack;
+        const char* data = asset.packed;
+        res.set_content_provider(
+            file_size,
+            asset.mime,
+            [pack, data, file_size](size_t offset, size_t length, httplib::DataSink &sink) {
+                if (offset >= file_size) return false;
+                return sink.write(data + offset, std::min(length, file_size - offset));
+            }
+        );
+        return;
+    }
+    // Small and medium files are served from shared in-memory buffers
+    if (auto data = this->getCachedAsset(asset)) {
+        res.set_content_provider(
+            data->size(),
+            asset.mime,
+            [data](size_t offset, size_t length, httplib::DataSink &sink) {
+                if (offset >= data->size()) return false;
+                return sink.write(data->data() + offset, std::min(length, data->size() - offset));
+            }
+        );
+        return;
+    }
+    // Large files are served straight from a shared read-only mapping
+    if (auto mapped = this->map_large_files ? this->getMappedFile(asset) : nullptr) {
+        const std::string mapped_path = asset.path.string();
+        res.set_content_provider(
+            mapped->size,
+            asset.mime,
+            [this, mapped, mapped_path](size_t offset, size_t length, httplib::DataSink &sink) {
+                if (offset >= mapped->size) return false;
+                length = std::min(length, MAPPED_WRITE_SLICE);
+                const size_t end = std::min(offset + length, mapped->size);
+                // Stop rather than fault if the file was truncated after it was mapped
+                if (!mapped->intact(end)) {
+                    this->logger->warn("[server] " + mapped_path + " shrank while being served, aborting response");
+                    return false;
+                }
+                return sink.write(mapped->data + offset, end - offset);
+            }
+        );
+        return;
+    }
     
     res.set_content_provider(
         file_size,
-        this->getMimeType(path),
+        asset.mime,
         [path, file_size](size_t offset, size_t length, httplib::DataSink &sink) {
             if (offset >= file_size) return false;
             if (offset + length > file_size) length = file_size - offset;
@@ -0,0 +1,653 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/web_server.hpp"
+
+#include "../include/app.hpp"
+#include "../include/config.hpp"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string_view>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#if defined(__linux__)
+    #include <poll.h>
+    #include <sys/inotify.h>
+#endif
+#if defined(RENWEB_ZLIB)
+    #include <zlib.h>
+#endif
+
+using WebServer = RenWeb::WebServer;
+
+// Without a filesystem watch, cached resolutions are only trusted for this long
+static constexpr std::chrono::seconds RESOLVED_ASSET_TTL{1};
+static constexpr size_t MAX_RESOLVED_ASSETS = 4096;
+static constexpr size_t MAX_ASSET_WATCHES = 4096;
+static constexpr const char* ASSET_PACK_NAME = "app.rwpack";
+// Below this a gzip header costs more than it saves
+static constexpr std::uintmax_t MIN_COMPRESSIBLE_SIZE = 1024;
+
+bool WebServer::resolveAsset(const std::string& target, ResolvedAsset& asset) {
+    const std::string& page = this->app->config->current_page;
+    const std::string key = page + '\n' + target;
+    const auto now = std::chrono::steady_clock::now();
+    uint64_t generation;
+    {
+        std::shared_lock<std::shared_mutex> lock(this->resolved_assets_mtx);
+        generation = this->resolved_assets_generation;
+        auto it = this->resolved_assets.find(key);
+        if (it != this->resolved_assets.end() 
+            && (this->assets_watched || now - it->second.resolved_at < RESOLVED_ASSET_TTL)
+        ) {
+            asset = it->second;
+            return !asset.path.empty();
+        }
+    }
+
+    const std::string target_file = (target == "/") ? "index.html" : target.substr(1);
+    const std::filesystem::path target_dir = std::filesystem::path(target_file).string();
+    const std::array<std::filesystem::path, 4> search_paths = {
+        this->base_path / "custom" / page / target_dir,
+        this->base_path / "content" / page / target_dir,
+        this->base_path / target_dir,
+        this->base_path / "backup" / page / target_dir
+    };
+    // The same search order inside the pack, which is authoritative for the top-level directories it holds
+    const std::array<std::string, 4> pack_paths = {
+        "custom/" + page + "/" + target_file,
+        "content/" + page + "/" + target_file,
+        target_file,
+        "backup/" + page + "/" + target_file
+    };
+    const std::shared_ptr<const AssetPack> pack = this->getAssetPack();
+    ResolvedAsset resolved;
+    resolved.resolved_at = now;
+    for (size_t i = 0; i < search_paths.size(); i++) {
+        const std::filesystem::path& path = search_paths[i];
+        const std::string& pack_path = pack_paths[i];
+        if (pack && pack->owns(std::string_view(pack_path).substr(0, pack_path.find('/')))) {
+            const AssetPack::Entry* entry = pack->find(pack_path);
+            if (entry == nullptr) continue;
+            resolved.path = path;
+            resolved.size = entry->size;
+            resolved.mtime = std::filesystem::file_time_type(std::chrono::duration_cast<std::filesystem::file_time_type::duration>(
+                std::chrono::nanoseconds(entry->mtime_ns)));
+            resolved.modified = static_cast<std::time_t>(entry->mtime_ns / 1000000000);
+            resolved.mime = this->getMimeType(path);
+            resolved.pack = pack;
+            resolved.packed = entry->data;
+            this->findEncodedVariants(resolved, pack_path);
+            break;
+        }
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(path, ec)) continue;
+        const auto size = std::filesystem::file_size(path, ec);
+        if (ec) continue;
+        const auto mtime = std::filesystem::last_write_time(path, ec);
+        if (ec) continue;
+        resolved.path = path;
+        resolved.size = size;
+        resolved.mtime = mtime;
+        resolved.mime = this->getMimeType(path);
+        resolved.modified = WebServer::toTimeT(mtime);
+        this->findEncodedVariants(resolved, "");
+        break;
+    }
+    {
+        std::unique_lock<std::shared_mutex> lock(this->resolved_assets_mtx);
+        // Invalidated while we were looking: still serve what was found, but the next request looks again
+        if (this->resolved_assets_generation == generation) {
+            if (this->resolved_assets.size() >= MAX_RESOLVED_ASSETS) {
+                this->resolved_assets.clear();
+            }
+            this->resolved_assets[key] = resolved;
+        }
+    }
+    asset = std::move(resolved);
+    return !asset.path.empty();
+}
+
+bool WebServer::hasAsset(const std::string& target) /*override*/ {
+    ResolvedAsset asset;
+    return this->resolveAsset(target, asset);
+}
+
+void WebServer::invalidateResolvedAssets() {
+    std::unique_lock<std::shared_mutex> lock(this->resolved_assets_mtx);
+    this->resolved_assets.clear();
+    this->resolved_assets_generation++;
+    this->asset_pack_stale = true;
+}
+
+// Reopens the pack only when it was replaced, so a rebuilt pack is picked up like any other asset change
+std::shared_ptr<const RenWeb::AssetPack> WebServer::getAssetPack() {
+    std::lock_guard<std::mutex> lock(this->asset_pack_mtx);
+    const auto now = std::chrono::steady_clock::now();
+    if (!this->asset_pack_stale && (this->assets_watched || now - this->asset_pack_checked < RESOLVED_ASSET_TTL)) {
+        return this->asset_pack;
+    }
+    this->asset_pack_stale = false;
+    this->asset_pack_checked = now;
+    const std::filesystem::path path = this->base_path / ASSET_PACK_NAME;
+    std::error_code ec;
+    std::uintmax_t size = 0;
+    std::filesystem::file_time_type mtime;
+    if (std::filesystem::is_regular_file(path, ec)) {
+        size = std::filesystem::file_size(path, ec);
+        if (!ec) mtime = std::filesystem::last_write_time(path, ec);
+    }
+    if (ec || size == 0) {
+        if (this->asset_pack) {
+            this->logger->info("[server] Asset pack removed, serving loose files");
+        }
+        this->asset_pack.reset();
+        this->asset_pack_seen_size = 0;
+        return nullptr;
+    }
+    if (size == this->asset_pack_seen_size && mtime == this->asset_pack_seen_mtime) {
+        return this->asset_pack;
+    }
+    this->asset_pack_seen_size = size;
+    this->asset_pack_seen_mtime = mtime;
+    try {
+        this->asset_pack = std::make_shared<const AssetPack>(path);
+        this->logger->info("[server] Serving " + std::to_string(this->asset_pack->getEntryCount()) + " assets from " + path.string());
+    } catch (const std::exception& e) {
+        this->logger->error("[server] " + std::string(e.what()) + " Serving loose files instead.");
+        this->asset_pack.reset();
+    }
+    return this->asset_pack;
+}
+
+// Pages default to "no-cache": WebKit may keep every asset but revalidates it,
+// which costs a 304 instead of a full body once validators are in place.
+std::string WebServer::compileCachePolicy(const json::value& policy) {
+    if (policy.is_string()) {
+        const std::string value(policy.as_string());
+        if (value == "immutable") return "max-age=31536000, immutable";
+        return value.empty() ? "no-cache" : value;
+    } else if (policy.is_number()) {
+        const int64_t max_age = policy.to_number<int64_t>();
+        return (max_age > 0) ? "max-age=" + std::to_string(max_age) : "no-cache";
+    } else if (policy.is_object()) {
+        const json::object& obj = policy.as_object();
+        if (obj.contains("no_store") && obj.at("no_store").is_bool() && obj.at("no_store").as_bool()) {
+            return "no-store";
+        }
+        int64_t max_age = 0;
+        if (obj.contains("max_age") && obj.at("max_age").is_number()) {
+            max_age = obj.at("max_age").to_number<int64_t>();
+        }
+        if (max_age <= 0) return "no-cache";
+        std::string value = "max-age=" + std::to_string(max_age);
+        if (obj.contains("immutable") && obj.at("immutable").is_bool() && obj.at("immutable").as_bool()) {
+            value += ", immutable";
+        }
+        return value;
+    }
+    return "no-cache";
+}
+
+// Config is not thread-safe, so the policy is read here on the UI thread and published as a snapshot
+void WebServer::refreshCachePolicy() /*override*/ {
+    json::value policy = this->app->config->getProperty("cache_policy");
+    if (policy.is_null()) {
+        policy = this->app->config->getDefaultProperty("cache_policy");
+    }
+    auto compiled = std::make_shared<const std::string>(WebServer::compileCachePolicy(policy));
+    std::lock_guard<std::mutex> lock(this->cache_control_mtx);
+    this->cache_control = std::move(compiled);
+}
+
+std::string WebServer::getCacheControl() const {
+    std::lock_guard<std::mutex> lock(this->cache_control_mtx);
+    return *this->cache_control;
+}
+
+std::time_t WebServer::toTimeT(std::filesystem::file_time_type mtime) {
+#if defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+    return std::chrono::system_clock::to_time_t(
+        std::chrono::time_point_cast<std::chrono::system_clock::duration>(std::chrono::file_clock::to_sys(mtime)));
+#else
+    // No file_clock::to_sys before C++20; shift by the current clock offset, rounded so it is stable
+    const auto offset = std::chrono::round<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+        - std::chrono::duration_cast<std::chrono::system_clock::duration>(std::filesystem::file_time_type::clock::now().time_since_epoch()));
+    return std::chrono::duration_cast<std::chrono::seconds>(mtime.time_since_epoch()).count() + offset.count();
+#endif
+}
+
+void WebServer::findEncodedVariants(ResolvedAsset& asset, const std::string& pack_path) {
+    static const std::array<std::pair<const char*, const char*>, 2> sidecars = {{
+        {".br", "br"},
+        {".gz", "gzip"}
+    }};
+    for (const auto& sidecar : sidecars) {
+        std::filesystem::path path = asset.path;
+        path += sidecar.first;
+        if (asset.pack) {
+            const AssetPack::Entry* entry = asset.pack->find(pack_path + sidecar.first);
+            if (entry == nullptr) continue;
+            ResolvedAsset variant;
+            variant.path = std::move(path);
+            variant.size = entry->size;
+            variant.mtime = std::filesystem::file_time_type(std::chrono::duration_cast<std::filesystem::file_time_type::duration>(
+                std::chrono::nanoseconds(entry->mtime_ns)));
+            if (variant.mtime < asset.mtime) continue;
+            variant.mime = asset.mime;
+            variant.modified = static_cast<std::time_t>(entry->mtime_ns / 1000000000);
+            variant.resolved_at = asset.resolved_at;
+            variant.encoding = sidecar.second;
+            variant.pack = asset.pack;
+            variant.packed = entry->data;
+            asset.encoded.push_back(std::move(variant));
+            continue;
+        }
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(path, ec)) continue;
+        const auto size = std::filesystem::file_size(path, ec);
+        if (ec) continue;
+        const auto mtime = std::filesystem::last_write_time(path, ec);
+        // A sidecar older than its source is stale, serve the source instead
+        if (ec || mtime < asset.mtime) continue;
+        ResolvedAsset variant;
+        variant.path = std::move(path);
+        variant.size = size;
+        variant.mtime = mtime;
+        variant.mime = asset.mime;
+        variant.modified = WebServer::toTimeT(mtime);
+        variant.resolved_at = asset.resolved_at;
+        variant.encoding = sidecar.second;
+        asset.encoded.push_back(std::move(variant));
+    }
+}
+
+std::shared_ptr<const std::string> WebServer::findCachedAsset(const std::string& key, const ResolvedAsset& source) {
+    std::lock_guard<std::mutex> lock(this->asset_cache_mtx);
+    auto it = this->asset_cache.find(key);
+    if (it == this->asset_cache.end()) return nullptr;
+    if (it->second.mtime == source.mtime && it->second.source_size == source.size) {
+        this->asset_cache_lru.splice(this->asset_cache_lru.begin(), this->asset_cache_lru, it->second.lru);
+        this->asset_cache_hits++;
+        return it->second.data;
+    }
+    this->asset_cache_bytes -= it->second.data->size();
+    this->asset_cache_lru.erase(it->second.lru);
+    this->asset_cache.erase(it);
+    return nullptr;
+}
+
+void WebServer::storeCachedAsset(const std::string& key, const ResolvedAsset& source, std::shared_ptr<const std::string> data) {
+    std::lock_guard<std::mutex> lock(this->asset_cache_mtx);
+    if (this->asset_cache.find(key) != this->asset_cache.end()) return;
+    this->asset_cache_bytes += data->size();
+    this->asset_cache_lru.push_front(key);
+    this->asset_cache[key] = CachedAsset{std::move(data), source.mtime, source.size, this->asset_cache_lru.begin()};
+    while (this->asset_cache_bytes > this->asset_cache_budget && !this->asset_cache_lru.empty()) {
+        auto victim = this->asset_cache.find(this->asset_cache_lru.back());
+        this->asset_cache_bytes -= victim->second.data->size();
+        this->asset_cache.erase(victim);
+        this->asset_cache_lru.pop_back();
+        this->asset_cache_evictions++;
+    }
+}
+
+std::shared_ptr<const std::string> WebServer::getCachedAsset(const ResolvedAsset& asset) {
+    if (this->asset_cache_budget == 0 || asset.size > this->asset_cache_max_file) {
+        return nullptr;
+    }
+    const std::string key = asset.path.string();
+    if (auto data = this->findCachedAsset(key, asset)) {
+        return data;
+    }
+    this->asset_cache_misses++;
+
+    std::ifstream ifs(asset.path, std::ios::binary);
+    if (!ifs) return nullptr;
+    auto data = std::make_shared<std::string>(static_cast<size_t>(asset.size), '\0');
+    ifs.read(data->data(), static_cast<std::streamsize>(data->size()));
+    if (static_cast<std::uintmax_t>(ifs.gcount()) != asset.size) return nullptr;
+
+    this->storeCachedAsset(key, asset, data);
+    return data;
+}
+
+#if defined(RENWEB_ZLIB)
+static bool gzipCompress(const char* input, size_t input_size, std::string& output) {
+    z_stream zs{};
+    // 15 + 16: max window with a gzip wrapper
+    if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+    output.resize(deflateBound(&zs, static_cast<uLong>(input_size)));
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input));
+    zs.avail_in = static_cast<uInt>(input_size);
+    zs.next_out = reinterpret_cast<Bytef*>(&output[0]);
+    zs.avail_out = static_cast<uInt>(output.size());
+    const int rc = deflate(&zs, Z_FINISH);
+    output.resize(zs.total_out);
+    deflateEnd(&zs);
+    return rc == Z_STREAM_END;
+}
+
+// Gzipped copies share the hot asset cache (and its budget) under "<path>\ngzip",
+// so they are rebuilt only when the source's mtime or size changes.
+std::shared_ptr<const std::string> WebServer::getCompressedAsset(const ResolvedAsset& asset) {
+    if (this->asset_cache_budget == 0 || asset.size < MIN_COMPRESSIBLE_SIZE || asset.size > this->asset_cache_max_file) {
+        return nullptr;
+    }
+    const std::string key = asset.path.string() + "\ngzip";
+    if (auto data = this->findCachedAsset(key, asset)) {
+        return data->empty() ? nullptr : data;
+    }
+    std::shared_ptr<const std::string> source;
+    const char* bytes = asset.packed;
+    if (bytes == nullptr) {
+        source = this->getCachedAsset(asset);
+        if (!source) return nullptr;
+        bytes = source->data();
+    }
+    const size_t size = static_cast<size_t>(asset.size);
+    auto data = std::make_shared<std::string>();
+    if (!gzipCompress(bytes, size, *data)) {
+        this->logger->debug("[server] Failed to gzip " + asset.path.string());
+        return nullptr;
+    }
+    this->compressions++;
+    // Content that does not shrink is remembered as an empty entry so it is not retried
+    if (data->size() >= size) {
+        data->clear();
+    }
+    this->storeCachedAsset(key, asset, data);
+    return data->empty() ? nullptr : data;
+}
+#else
+std::shared_ptr<const std::string> WebServer::getCompressedAsset(const ResolvedAsset& asset) {
+    (void)asset;
+    return nullptr;
+}
+#endif
+
+WebServer::MappedFile::~MappedFile() {
+#if defined(_WIN32)
+    if (this->data != nullptr) UnmapViewOfFile(this->data);
+    if (this->mapping != nullptr) CloseHandle(this->mapping);
+#else
+    if (this->data != nullptr) munmap(const_cast<char*>(this->data), this->size);
+    if (this->fd >= 0) ::close(this->fd);
+#endif
+}
+
+// Touching a page past EOF of a truncated file raises SIGBUS, so callers check before each read
+bool WebServer::MappedFile::intact(size_t end) const {
+#if defined(_WIN32)
+    // Windows refuses to truncate a file while a view of it is mapped
+    (void)end;
+    return true;
+#else
+    struct stat st;
+    return ::fstat(this->fd, &st) == 0 && static_cast<std::uintmax_t>(st.st_size) >= end;
+#endif
+}
+
+std::shared_ptr<const WebServer::MappedFile> WebServer::getMappedFile(const ResolvedAsset& asset) {
+    if (asset.size == 0 || asset.size > static_cast<std::uintmax_t>(SIZE_MAX)) {
+        return nullptr;
+    }
+    const std::string key = asset.path.string();
+    std::lock_guard<std::mutex> lock(this->mapped_files_mtx);
+    auto it = this->mapped_files.find(key);
+    if (it != this->mapped_files.end()) {
+        if (auto mapped = it->second.lock()) {
+            if (mapped->mtime == asset.mtime && mapped->size == asset.size) {
+                return mapped;
+            }
+        }
+    }
+    for (auto e = this->mapped_files.begin(); e != this->mapped_files.end();) {
+        e = e->second.expired() ? this->mapped_files.erase(e) : std::next(e);
+    }
+
+    auto mapped = std::make_shared<MappedFile>();
+    mapped->size = static_cast<size_t>(asset.size);
+    mapped->mtime = asset.mtime;
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(asset.path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size) || static_cast<std::uintmax_t>(file_size.QuadPart) != asset.size) {
+            CloseHandle(file);
+            this->logger->debug("[server] " + key + " changed size since it was resolved, streaming it instead");
+            return nullptr;
+        }
+        mapped->mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (mapped->mapping != nullptr) {
+            mapped->data = static_cast<const char*>(MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+    }
+#else
+    mapped->fd = ::open(asset.path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (mapped->fd >= 0) {
+        // Map what is on disk now, not what the resolver saw; a mismatch means the file is being rewritten
+        struct stat st;
+        if (::fstat(mapped->fd, &st) != 0 || !S_ISREG(st.st_mode)
+            || static_cast<std::uintmax_t>(st.st_size) != asset.size) {
+            this->logger->debug("[server] " + key + " changed size since it was resolved, streaming it instead");
+            return nullptr;
+        }
+        void* addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, mapped->fd, 0);
+        if (addr != MAP_FAILED) {
+            mapped->data = static_cast<const char*>(addr);
+        }
+    }
+#endif
+    if (mapped->data == nullptr) {
+        this->mapped_file_failures++;
+        this->logger->debug("[server] Failed to map " + key + ", falling back to streaming");
+        return nullptr;
+    }
+    this->mapped_files[key] = mapped;
+    return mapped;
+}
+
+json::object WebServer::getStats() /*override*/ {
+    json::object asset_cache;
+    {
+        std::lock_guard<std::mutex> lock(this->asset_cache_mtx);
+        asset_cache["entries"] = this->asset_cache.size();
+        asset_cache["bytes"] = this->asset_cache_bytes;
+    }
+    asset_cache["budget"] = this->asset_cache_budget;
+    asset_cache["max_file_size"] = this->asset_cache_max_file;
+    asset_cache["hits"] = this->asset_cache_hits.load();
+    asset_cache["misses"] = this->asset_cache_misses.load();
+    asset_cache["evictions"] = this->asset_cache_evictions.load();
+    json::object mapped;
+    {
+        std::lock_guard<std::mutex> lock(this->mapped_files_mtx);
+        size_t live = 0, bytes = 0;
+        for (const auto& entry : this->mapped_files) {
+            if (auto file = entry.second.lock()) {
+                live++;
+                bytes += file->size;
+            }
+        }
+        mapped["files"] = live;
+        mapped["bytes"] = bytes;
+    }
+    mapped["failures"] = this->mapped_file_failures.load();
+    json::value pack = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->asset_pack_mtx);
+        if (this->asset_pack) {
+            pack = json::object{
+                {"path", this->asset_pack->getPath().string()},
+                {"entries", this->asset_pack->getEntryCount()},
+                {"bytes", this->asset_pack->getFileSize()}
+            };
+        }
+    }
+    json::object compression;
+#if defined(RENWEB_ZLIB)
+    compression["dynamic"] = true;
+#else
+    compression["dynamic"] = false;
+#endif
+    compression["sidecar_responses"] = this->sidecar_responses.load();
+    compression["compressed_responses"] = this->compressed_responses.load();
+    compression["compressions"] = this->compressions.load();
+    json::object http_pool;
+    const uint64_t completed = this->pool_stats.completed.load();
+    http_pool["workers"] = this->pool_stats.workers.load();
+    http_pool["busy"] = this->pool_stats.busy.load();
+    http_pool["queue_depth"] = this->pool_stats.queue_depth.load();
+    http_pool["max_queue_depth"] = this->pool_stats.max_queue_depth.load();
+    http_pool["queue_capacity"] = this->http_max_queued;
+    http_pool["completed"] = completed;
+    http_pool["rejected"] = this->pool_stats.rejected.load();
+    http_pool["avg_wait_ms"] = completed == 0 ? 0.0
+        : static_cast<double>(this->pool_stats.wait_ns_total.load()) / static_cast<double>(completed) / 1e6;
+    http_pool["max_wait_ms"] = static_cast<double>(this->pool_stats.wait_ns_max.load()) / 1e6;
+    return json::object{
+        {"http_pool", std::move(http_pool)},
+        {"peers", this->getPeerStats()},
+        {"inbox", this->inbox->getStats()},
+        {"asset_cache", std::move(asset_cache)},
+        {"mapped_files", std::move(mapped)},
+        {"asset_pack", std::move(pack)},
+        {"compression", std::move(compression)},
+        {"not_modified_responses", this->not_modified_responses.load()}
+    };
+}
+
+#if defined(__linux__)
+void WebServer::startAssetWatch() {
+    if (this->asset_watch_thread.joinable()) return;
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        this->logger->warn("[server] inotify unavailable, resolved asset paths will expire after a short TTL");
+        return;
+    }
+    // Watches every non-hidden directory under root. Returns false once the watch limit is hit.
+    auto watch_tree = [fd](const std::filesystem::path& root, std::unordered_map<int, std::filesystem::path>& watches) -> bool {
+        const uint32_t mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO 
+            | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF;
+        auto add = [fd, mask, &watches](const std::filesystem::path& dir) -> bool {
+            if (watches.size() >= MAX_ASSET_WATCHES) return false;
+            const int wd = inotify_add_watch(fd, dir.c_str(), mask);
+            if (wd >= 0) watches[wd] = dir;
+            return true;
+        };
+        if (!add(root)) return false;
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it(root, std::filesystem::directory_options::skip_permission_denied, ec), end; 
+             !ec && it != end; it.increment(ec)) {
+            if (!it->is_directory(ec)) continue;
+            if (it->path().filename().string().rfind('.', 0) == 0) {
+                it.disable_recursion_pending();
+                continue;
+            }
+            if (!add(it->path())) return false;
+        }
+        return true;
+    };
+    std::unordered_map<int, std::filesystem::path> watches;
+    if (!watch_tree(this->base_path, watches)) {
+        this->logger->warn("[server] Too many directories to watch under " + this->base_path.string() + ", resolved asset paths will expire after a short TTL");
+        close(fd);
+        return;
+    }
+    this->logger->trace("[server] Watching " + std::to_string(watches.size()) + " asset directories");
+    this->stop_asset_watch = false;
+    this->assets_watched = true;
+    this->asset_watch_thread = std::thread([this, fd, watch_tree, watches]() mutable {
+        alignas(struct inotify_event) char buffer[16 * 1024];
+        while (!this->stop_asset_watch) {
+            pollfd pfd{fd, POLLIN, 0};
+            if (poll(&pfd, 1, 250) <= 0) continue;
+            const ssize_t len = read(fd, buffer, sizeof(buffer));
+            if (len <= 0) continue;
+            bool stale = false;
+            for (ssize_t i = 0; i < len;) {
+                const auto* event = reinterpret_cast<const struct inotify_event*>(buffer + i);
+                i += static_cast<ssize_t>(sizeof(struct inotify_event) + event->len);
+                // The log (flushed per line in debug builds), the config and editors' temp files are never served
+                if (event->len > 0 && !(event->mask & IN_ISDIR)) {
+                    const std::string_view name(event->name);
+                    if (name.size() >= 4 && name.compare(name.size() - 4, 4, ".tmp") == 0) continue;
+                    auto dir = watches.find(event->wd);
+                    if (dir != watches.end() && dir->second == this->base_path
+                        && (name == "log.txt" || name == "config.json")
+                    ) continue;
+                }
+                stale = true;
+                if (event->mask & IN_Q_OVERFLOW) {
+                    this->logger->debug("[server] Asset watch queue overflowed");
+                } else if (event->mask & IN_IGNORED) {
+                    watches.erase(event->wd);
+                } else if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO)) && event->len > 0) {
+                    auto parent = watches.find(event->wd);
+                    if (parent != watches.end() && event->name[0] != '.' 
+                        && !watch_tree(parent->second / event->name, watches)
+                    ) {
+                        this->logger->warn("[server] Asset watch limit reached, resolved asset paths will expire after a short TTL");
+                        this->assets_watched = false;
+                    }
+                }
+            }
+            if (stale) this->invalidateResolvedAssets();
+        }
+        close(fd);
+    });
+}
+
+void WebServer::stopAssetWatch() {
+    this->stop_asset_watch = true;
+    if (this->asset_watch_thread.joinable()) {
+        this->asset_watch_thread.join();
+    }
+    this->assets_watched = false;
+}
+#else
+void WebServer::startAssetWatch() {
+    this->logger->trace("[server] No asset watcher on this platform, resolved asset paths expire after a short TTL");
+}
+
+void WebServer::stopAssetWatch() { }
+#endif
@@ -148,19 +148,19 @@ std::string WebServer::generateErrorHTML(int status_code, const std::string& sta
         <button class='close-button' onclick='closeApp()'>Close</button>
     </div>
     <script>
-        function encode(enc, { string } = { string: "base64" }) {
+        function encode(enc, { string } = { string: "utf8" }) {
             switch (typeof enc) {
                 case "string":
                     switch (string) {
                         case "base64":
                             return {
                                 __encoding_type__: "base64",
-                                __val__: Array.from(new TextEncoder().encode(enc))
+                                __val__: btoa(Array.from(new TextEncoder().encode(enc), b => String.fromCharCode(b)).join(""))
                             };
                         default:
                             return {
-                                __encoding_type__: "none",
-                                __val__: []
+                                __encoding_type__: "utf8",
+                                __val__: enc
                             };
                     }
                 case "object":
@@ -190,8 +190,12 @@ std::string WebServer::generateErrorHTML(int status_code, const std::string& sta
                     }
                     else if ("__encoding_type__" in dec && "__val__" in dec) {
                         switch (dec.__encoding_type__) {
+                            case "utf8":
+                                return dec.__val__;
                             case "base64":
-                                return new TextDecoder().decode(new Uint8Array(dec.__val__));
+                                return new TextDecoder().decode((typeof dec.__val__ === "string")
+                                    ? Uint8Array.from(atob(dec.__val__), c => c.charCodeAt(0))
+                                    : new Uint8Array(dec.__val__));
                             default:
                                 return dec;
                         }
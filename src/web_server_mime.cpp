@@ -28,1829 +28,1916 @@
 // DEALINGS IN THE SOFTWARE.
 #include "../include/web_server.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <iterator>
+
 using WebServer = RenWeb::WebServer;
 
-std::string WebServer::getMimeType(const std::filesystem::path& file) {
-    auto i = this->mime_types.find(file.extension().string());
-    if (i == this->mime_types.end()) {
-        return "application/octet-stream";
-    } else {
-        return i->second;
+namespace {
+    struct MimeEntry {
+        std::string_view suffix;
+        std::string_view type;
+    };
+
+    // Lowercase suffixes without the leading dot. Compound suffixes ("tar.gz") are matched before their tail ("gz").
+    constexpr MimeEntry MIME_ENTRIES[] = {
+        { "123", "application/vnd.lotus-1-2-3" },
+        { "1km", "application/vnd.1000minds.decision-model+xml" },
+        { "323", "text/h323" },
+        { "3dm", "x-world/x-3dmf" },
+        { "3dmf", "x-world/x-3dmf" },
+        { "3dml", "text/vnd.in3d.3dml" },
+        { "3ds", "image/x-3ds" },
+        { "3g2", "video/3gpp2" },
+        { "3ga", "audio/mp4" },
+        { "3gp", "video/3gpp" },
+        { "3gp2", "video/3gpp2" },
+        { "3gpa", "audio/mp4" },
+        { "3gpp", "video/3gpp" },
+        { "3mf", "model/3mf" },
+        { "7z", "application/x-7z-compressed" },
+        { "7zip", "application/x-7z-compressed" },
+        { "a", "application/octet-stream" },
+        { "aa", "audio/audible" },
+        { "aab", "application/x-authorware-bin" },
+        { "aac", "audio/aac" },
+        { "aaf", "application/octet-stream" },
+        { "aam", "application/x-authorware-map" },
+        { "aas", "application/x-authorware-seg" },
+        { "aax", "audio/vnd.audible.aax" },
+        { "abc", "text/vndabc" },
+        { "abw", "application/x-abiword" },
+        { "ac", "application/pkix-attr-cert" },
+        { "ac3", "audio/ac3" },
+        { "aca", "application/octet-stream" },
+        { "acc", "application/vnd.americandynamics.acc" },
+        { "accda", "application/msaccess.addin" },
+        { "accdb", "application/msaccess" },
+        { "accdc", "application/msaccess.cab" },
+        { "accde", "application/msaccess" },
+        { "accdr", "application/msaccess.runtime" },
+        { "accdt", "application/msaccess" },
+        { "accdw", "application/msaccess.webapplication" },
+        { "accft", "application/msaccess.ftemplate" },
+        { "ace", "application/x-ace-compressed" },
+        { "acgi", "text/html" },
+        { "acu", "application/vnd.acucobol" },
+        { "acutc", "application/vnd.acucorp" },
+        { "acx", "application/internet-property-stream" },
+        { "addin", "text/xml" },
+        { "ade", "application/msaccess" },
+        { "adobebridge", "application/x-bridge-url" },
+        { "adp", "application/msaccess" },
+        { "adt", "audio/vnd.dlna.adts" },
+        { "adts", "audio/aac" },
+        { "aep", "application/vnd.audiograph" },
+        { "aff", "audio/aiff" },
+        { "afl", "video/animaflex" },
+        { "afm", "application/octet-stream" },
+        { "afp", "application/vnd.ibm.modcap" },
+        { "age", "application/vnd.age" },
+        { "ahead", "application/vnd.ahead.space" },
+        { "ai", "application/postscript" },
+        { "aif", "audio/aiff" },
+        { "aifc", "audio/aiff" },
+        { "aiff", "audio/aiff" },
+        { "aim", "application/x-aim" },
+        { "aip", "text/x-audiosoft-intra" },
+        { "air", "application/vnd.adobe.air-application-installer-package+zip" },
+        { "ait", "application/vnd.dvb.ait" },
+        { "alz", "application/x-alz-compressed" },
+        { "amc", "application/mpeg" },
+        { "ami", "application/vnd.amiga.ami" },
+        { "aml", "application/automationml-aml+xml" },
+        { "amlx", "application/automationml-amlx+zip" },
+        { "amr", "audio/amr" },
+        { "ani", "application/x-navi-animation" },
+        { "anx", "application/annodex" },
+        { "aos", "application/x-nokia-9000-communicator-add-on-software" },
+        { "apk", "application/vnd.android.package-archive" },
+        { "apng", "image/apng" },
+        { "appcache", "text/cache-manifest" },
+        { "appinstaller", "application/appinstaller" },
+        { "application", "application/x-ms-application" },
+        { "appx", "application/appx" },
+        { "appxbundle", "application/appxbundle" },
+        { "apr", "application/vnd.lotus-approach" },
+        { "aps", "application/mime" },
+        { "arc", "application/x-freearc" },
+        { "arj", "application/x-arj" },
+        { "art", "image/x-jg" },
+        { "arw", "image/x-sony-arw" },
+        { "asa", "application/xml" },
+        { "asax", "application/xml" },
+        { "asc", "application/pgp-signature" },
+        { "ascx", "application/xml" },
+        { "asd", "application/octet-stream" },
+        { "asf", "video/x-ms-asf" },
+        { "ashx", "application/xml" },
+        { "asi", "application/octet-stream" },
+        { "asm", "text/plain" },
+        { "asmx", "application/xml" },
+        { "aso", "application/vnd.accpac.simply.aso" },
+        { "asp", "text/asp" },
+        { "aspx", "application/xml" },
+        { "asr", "video/x-ms-asf" },
+        { "asx", "video/x-ms-asf" },
+        { "atc", "application/vnd.acucorp" },
+        { "atom", "application/atom+xml" },
+        { "atomcat", "application/atomcat+xml" },
+        { "atomdeleted", "application/atomdeleted+xml" },
+        { "atomsvc", "application/atomsvc+xml" },
+        { "atx", "application/vnd.antix.game-component" },
+        { "au", "audio/basic" },
+        { "avci", "image/avci" },
+        { "avcs", "image/avcs" },
+        { "avi", "video/x-msvideo" },
+        { "avif", "image/avif" },
+        { "avifs", "image/avif-sequence" },
+        { "avs", "video/avs-video" },
+        { "aw", "application/applixware" },
+        { "axa", "audio/annodex" },
+        { "axs", "application/olescript" },
+        { "axv", "video/annodex" },
+        { "azf", "application/vnd.airzip.filesecure.azf" },
+        { "azs", "application/vnd.airzip.filesecure.azs" },
+        { "azv", "image/vnd.airzip.accelerator.azv" },
+        { "azw", "application/vnd.amazon.ebook" },
+        { "b16", "image/vnd.pco.b16" },
+        { "bas", "text/plain" },
+        { "bat", "application/x-msdownload" },
+        { "bcpio", "application/x-bcpio" },
+        { "bdf", "application/x-font-bdf" },
+        { "bdm", "application/vnd.syncml.dm+wbxml" },
+        { "bdoc", "application/x-bdoc" },
+        { "bed", "application/vnd.realvnc.bed" },
+        { "bh2", "application/vnd.fujitsu.oasysprs" },
+        { "bib", "text/x-bibtex" },
+        { "bin", "application/octet-stream" },
+        { "blb", "application/x-blorb" },
+        { "blorb", "application/x-blorb" },
+        { "bmi", "application/vnd.bmi" },
+        { "bmml", "application/vnd.balsamiq.bmml+xml" },
+        { "bmp", "image/bmp" },
+        { "boo", "text/x-boo" },
+        { "book", "application/vnd.framemaker" },
+        { "box", "application/vnd.previewsystems.box" },
+        { "boz", "application/x-bzip2" },
+        { "bpk", "application/octet-stream" },
+        { "bsh", "application/x-bsh" },
+        { "bsp", "model/vnd.valve.source.compiled-map" },
+        { "btf", "image/prs.btif" },
+        { "btif", "image/prs.btif" },
+        { "buffer", "application/octet-stream" },
+        { "bz", "application/x-bzip" },
+        { "bz2", "application/x-bzip2" },
+        { "c", "text/plain" },
+        { "c++", "text/x-c++src" },
+        { "c11amc", "application/vnd.cluetrust.cartomobile-config" },
+        { "c11amz", "application/vnd.cluetrust.cartomobile-config-pkg" },
+        { "c4d", "application/vnd.clonk.c4group" },
+        { "c4f", "application/vnd.clonk.c4group" },
+        { "c4g", "application/vnd.clonk.c4group" },
+        { "c4p", "application/vnd.clonk.c4group" },
+        { "c4u", "application/vnd.clonk.c4group" },
+        { "cab", "application/octet-stream" },
+        { "caf", "audio/x-caf" },
+        { "calx", "application/vnd.ms-office.calx" },
+        { "cap", "application/vnd.tcpdump.pcap" },
+        { "car", "application/vnd.curl.car" },
+        { "cat", "application/vnd.ms-pki.seccat" },
+        { "cb7", "application/x-cb7" },
+        { "cba", "application/x-cbr" },
+        { "cbr", "application/x-cbr" },
+        { "cbt", "application/x-cbt" },
+        { "cbz", "application/x-cbz" },
+        { "cc", "text/plain" },
+        { "ccad", "application/clariscad" },
+        { "cco", "application/x-cocoa" },
+        { "cct", "application/x-director" },
+        { "ccxml", "application/ccxml+xml" },
+        { "cd", "text/plain" },
+        { "cdbcmsg", "application/vnd.contact.cmsg" },
+        { "cdda", "audio/aiff" },
+        { "cdf", "application/x-cdf" },
+        { "cdfx", "application/cdfx+xml" },
+        { "cdkey", "application/vnd.mediastation.cdkey" },
+        { "cdmia", "application/cdmi-capability" },
+        { "cdmic", "application/cdmi-container" },
+        { "cdmid", "application/cdmi-domain" },
+        { "cdmio", "application/cdmi-object" },
+        { "cdmiq", "application/cdmi-queue" },
+        { "cdr", "image/x-coreldraw" },
+        { "cdt", "image/x-coreldrawtemplate" },
+        { "cdx", "chemical/x-cdx" },
+        { "cdxml", "application/vnd.chemdraw+xml" },
+        { "cdy", "application/vnd.cinderella" },
+        { "cer", "application/x-x509-ca-cert" },
+        { "cfg", "text/plain" },
+        { "cfs", "application/x-cfs-compressed" },
+        { "cgm", "image/cgm" },
+        { "cha", "application/x-chat" },
+        { "chat", "application/x-chat" },
+        { "chm", "application/octet-stream" },
+        { "chrt", "application/vnd.kde.kchart" },
+        { "cif", "chemical/x-cif" },
+        { "cii", "application/vnd.anser-web-certificate-issue-initiation" },
+        { "cil", "application/vnd.ms-artgalry" },
+        { "cjs", "application/node" },
+        { "cla", "application/vnd.claymore" },
+        { "class", "application/x-java-applet" },
+        { "cld", "model/vnd.cld" },
+        { "clkk", "application/vnd.crick.clicker.keyboard" },
+        { "clkp", "application/vnd.crick.clicker.palette" },
+        { "clkt", "application/vnd.crick.clicker.template" },
+        { "clkw", "application/vnd.crick.clicker.wordbank" },
+        { "clkx", "application/vnd.crick.clicker" },
+        { "clp", "application/x-msclip" },
+        { "cls", "text/x-tex" },
+        { "cmc", "application/vnd.cosmocaller" },
+        { "cmd", "text/plain" },
+        { "cmdf", "chemical/x-cmdf" },
+        { "cml", "chemical/x-cml" },
+        { "cmp", "application/vnd.yellowriver-custom-menu" },
+        { "cmx", "image/x-cmx" },
+        { "cnf", "text/plain" },
+        { "cod", "image/cis-cod" },
+        { "coffee", "text/coffeescript" },
+        { "com", "application/x-msdownload" },
+        { "conf", "text/plain" },
+        { "config", "application/xml" },
+        { "contact", "text/x-ms-contact" },
+        { "coverage", "application/xml" },
+        { "cpio", "application/x-cpio" },
+        { "cpl", "application/cpl+xml" },
+        { "cpp", "text/plain" },
+        { "cpt", "application/mac-compactpro" },
+        { "cr2", "image/x-canon-cr2" },
+        { "cr3", "image/x-canon-cr3" },
+        { "crd", "application/x-mscardfile" },
+        { "crl", "application/pkix-crl" },
+        { "crt", "application/x-x509-ca-cert" },
+        { "crw", "image/x-canon-crw" },
+        { "crx", "application/x-chrome-extension" },
+        { "cryptonote", "application/vnd.rig.cryptonote" },
+        { "cs", "text/plain" },
+        { "csdproj", "text/plain" },
+        { "csh", "application/x-csh" },
+        { "csl", "application/vnd.citationstyles.style+xml" },
+        { "csml", "chemical/x-csml" },
+        { "csp", "application/vnd.commonspace" },
+        { "csproj", "text/plain" },
+        { "css", "text/css" },
+        { "cst", "application/x-director" },
+        { "csv", "text/csv" },
+        { "cu", "application/cu-seeme" },
+        { "cur", "application/octet-stream" },
+        { "curl", "text/vnd.curl" },
+        { "cwl", "application/cwl" },
+        { "cww", "application/prs.cww" },
+        { "cxt", "application/x-director" },
+        { "cxx", "text/plain" },
+        { "czx", "application/x-czx" },
+        { "d", "text/x-dsrc" },
+        { "dae", "model/vnd.collada+xml" },
+        { "daf", "application/vnd.mobius.daf" },
+        { "dar", "application/x-dar" },
+        { "dart", "application/vnd.dart" },
+        { "dat", "application/octet-stream" },
+        { "dataless", "application/vnd.fdsn.seed" },
+        { "datasource", "application/xml" },
+        { "davmount", "application/davmount+xml" },
+        { "db", "application/vnd.sqlite3" },
+        { "db-shm", "application/vnd.sqlite3" },
+        { "db-wal", "application/vnd.sqlite3" },
+        { "dbf", "application/vnd.dbf" },
+        { "dbk", "application/docbook+xml" },
+        { "dbproj", "text/plain" },
+        { "dcr", "application/x-director" },
+        { "dcurl", "text/vnd.curl.dcurl" },
+        { "dd2", "application/vnd.oma.dd2+xml" },
+        { "ddd", "application/vnd.fujixerox.ddd" },
+        { "ddf", "application/vnd.syncml.dmddf+xml" },
+        { "dds", "image/vnd.ms-dds" },
+        { "deb", "application/x-debian-package" },
+        { "deepv", "application/x-deepv" },
+        { "def", "text/plain" },
+        { "deploy", "application/octet-stream" },
+        { "der", "application/x-x509-ca-cert" },
+        { "dfac", "application/vnd.dreamfactory" },
+        { "dgc", "application/x-dgc-compressed" },
+        { "dgml", "application/xml" },
+        { "dib", "image/bmp" },
+        { "dic", "text/x-c" },
+        { "dif", "video/x-dv" },
+        { "diff", "text/plain" },
+        { "dir", "application/x-director" },
+        { "dis", "application/vnd.mobius.dis" },
+        { "disco", "text/xml" },
+        { "disposition-notification", "message/disposition-notification" },
+        { "dist", "application/octet-stream" },
+        { "distz", "application/octet-stream" },
+        { "divx", "video/divx" },
+        { "djv", "image/vnd.djvu" },
+        { "djvu", "image/vnd.djvu" },
+        { "dl", "video/dl" },
+        { "dll", "application/x-msdownload" },
+        { "dll.config", "text/xml" },
+        { "dlm", "text/dlm" },
+        { "dmg", "application/octet-stream" },
+        { "dmp", "application/vnd.tcpdump.pcap" },
+        { "dms", "application/octet-stream" },
+        { "dna", "application/vnd.dna" },
+        { "dng", "image/x-adobe-dng" },
+        { "doc", "application/msword" },
+        { "docm", "application/vnd.ms-word.document.macroEnabled.12" },
+        { "docx", "application/vnd.openxmlformats-officedocument.wordprocessingml.document" },
+        { "dot", "application/msword" },
+        { "dotm", "application/vnd.ms-word.template.macroEnabled.12" },
+        { "dotx", "application/vnd.openxmlformats-officedocument.wordprocessingml.template" },
+        { "dp", "application/vnd.osgi.dp" },
+        { "dpg", "application/vnd.dpgraph" },
+        { "dpx", "image/dpx" },
+        { "dra", "audio/vnd.dra" },
+        { "drle", "image/dicom-rle" },
+        { "drw", "application/drafting" },
+        { "dsc", "text/prs.lines.tag" },
+        { "dsp", "application/octet-stream" },
+        { "dssc", "application/dssc+der" },
+        { "dsw", "text/plain" },
+        { "dtb", "application/x-dtbook+xml" },
+        { "dtd", "text/xml" },
+        { "dts", "audio/vnd.dts" },
+        { "dtsconfig", "text/xml" },
+        { "dtshd", "audio/vnd.dts.hd" },
+        { "dump", "application/octet-stream" },
+        { "dv", "video/x-dv" },
+        { "dvb", "video/vnd.dvb.file" },
+        { "dvi", "application/x-dvi" },
+        { "dwd", "application/atsc-dwd+xml" },
+        { "dwf", "drawing/x-dwf" },
+        { "dwg", "application/acad" },
+        { "dwp", "application/octet-stream" },
+        { "dxf", "application/x-dxf" },
+        { "dxp", "application/vnd.spotfire.dxp" },
+        { "dxr", "application/x-director" },
+        { "ear", "application/java-archive" },
+        { "ecelp4800", "audio/vnd.nuera.ecelp4800" },
+        { "ecelp7470", "audio/vnd.nuera.ecelp7470" },
+        { "ecelp9600", "audio/vnd.nuera.ecelp9600" },
+        { "ecma", "application/ecmascript" },
+        { "edm", "application/vnd.novadigm.edm" },
+        { "edx", "application/vnd.novadigm.edx" },
+        { "efif", "application/vnd.picsel" },
+        { "ei6", "application/vnd.pg.osasli" },
+        { "el", "text/x-scriptelisp" },
+        { "elc", "application/octet-stream" },
+        { "emf", "image/emf" },
+        { "eml", "message/rfc822" },
+        { "emma", "application/emma+xml" },
+        { "emotionml", "application/emotionml+xml" },
+        { "emz", "application/octet-stream" },
+        { "env", "application/x-envoy" },
+        { "eol", "audio/vnd.digital-winds" },
+        { "eot", "application/vnd.ms-fontobject" },
+        { "eps", "application/postscript" },
+        { "epub", "application/epub+zip" },
+        { "erf", "application/x-endace-erf" },
+        { "es", "application/ecmascript" },
+        { "es3", "application/vnd.eszigno3+xml" },
+        { "esa", "application/vnd.osgi.subsystem" },
+        { "esf", "application/vnd.epson.esf" },
+        { "et3", "application/vnd.eszigno3+xml" },
+        { "etl", "application/etl" },
+        { "etx", "text/x-setext" },
+        { "eva", "application/x-eva" },
+        { "evy", "application/envoy" },
+        { "exe", "application/vnd.microsoft.portable-executable" },
+        { "exe.config", "text/xml" },
+        { "exi", "application/exi" },
+        { "exp", "application/express" },
+        { "exr", "image/aces" },
+        { "ext", "application/vnd.novadigm.ext" },
+        { "ez", "application/andrew-inset" },
+        { "ez2", "application/vnd.ezpix-album" },
+        { "ez3", "application/vnd.ezpix-package" },
+        { "f", "text/x-fortran" },
+        { "f4v", "video/mp4" },
+        { "f77", "text/x-fortran" },
+        { "f90", "text/x-fortran" },
+        { "fb", "application/x-maker" },
+        { "fbdoc", "application/x-maker" },
+        { "fbs", "image/vnd.fastbidsheet" },
+        { "fcdt", "application/vnd.adobe.formscentral.fcdt" },
+        { "fcs", "application/vnd.isac.fcs" },
+        { "fdf", "application/vnd.fdf" },
+        { "fdt", "application/fdt+xml" },
+        { "fe_launch", "application/vnd.denovo.fcselayout-link" },
+        { "feature", "text/x-gherkin" },
+        { "fg5", "application/vnd.fujitsu.oasysgp" },
+        { "fgd", "application/x-director" },
+        { "fh", "image/x-freehand" },
+        { "fh4", "image/x-freehand" },
+        { "fh5", "image/x-freehand" },
+        { "fh7", "image/x-freehand" },
+        { "fhc", "image/x-freehand" },
+        { "fif", "application/fractals" },
+        { "fig", "application/x-xfig" },
+        { "filters", "application/xml" },
+        { "fits", "image/fits" },
+        { "fla", "application/octet-stream" },
+        { "flac", "audio/flac" },
+        { "fli", "video/x-fli" },
+        { "flo", "application/vnd.micrografx.flo" },
+        { "flr", "x-world/x-vrml" },
+        { "flv", "video/x-flv" },
+        { "flw", "application/vnd.kde.kivio" },
+        { "flx", "text/vnd.fmi.flexstor" },
+        { "fly", "text/vnd.fly" },
+        { "fm", "application/vnd.framemaker" },
+        { "fmf", "video/x-atomic3d-feature" },
+        { "fnc", "application/vnd.frogans.fnc" },
+        { "fo", "application/vnd.software602.filler.form+xml" },
+        { "for", "text/x-fortran" },
+        { "fpx", "image/vnd.fpx" },
+        { "frame", "application/vnd.framemaker" },
+        { "frl", "application/freeloader" },
+        { "frm", "application/x-maker" },
+        { "fsc", "application/vnd.fsc.weblaunch" },
+        { "fsscript", "application/fsharp-script" },
+        { "fst", "image/vnd.fst" },
+        { "fsx", "application/fsharp-script" },
+        { "ftc", "application/vnd.fluxtime.clip" },
+        { "fti", "application/vnd.anser-web-funds-transfer-initiation" },
+        { "funk", "audio/make" },
+        { "fvt", "video/vnd.fvt" },
+        { "fxp", "application/vnd.adobe.fxp" },
+        { "fxpl", "application/vnd.adobe.fxp" },
+        { "fzs", "application/vnd.fuzzysheet" },
+        { "g", "text/plain" },
+        { "g2w", "application/vnd.geoplan" },
+        { "g3", "image/g3fax" },
+        { "g3w", "application/vnd.geospace" },
+        { "gac", "application/vnd.groove-account" },
+        { "gam", "application/x-tads" },
+        { "gbr", "application/vnd.gerber" },
+        { "gca", "application/x-gca-compressed" },
+        { "gcd", "text/x-pcs-gcd" },
+        { "gcf", "application/x-graphing-calculator" },
+        { "gdl", "model/vnd.gdl" },
+        { "gdoc", "application/vnd.google-apps.document" },
+        { "ged", "text/vnd.familysearch.gedcom" },
+        { "gemini", "text/gemini" },
+        { "generictest", "application/xml" },
+        { "geo", "application/vnd.dynageo" },
+        { "geojson", "application/geo+json" },
+        { "gex", "application/vnd.geometry-explorer" },
+        { "ggb", "application/vnd.geogebra.file" },
+        { "ggt", "application/vnd.geogebra.tool" },
+        { "ghf", "application/vnd.groove-help" },
+        { "gif", "image/gif" },
+        { "gim", "application/vnd.groove-identity-message" },
+        { "gitattributes", "text/plain" },
+        { "gitignore", "text/plain" },
+        { "gl", "video/gl" },
+        { "glb", "model/gltf-binary" },
+        { "gltf", "model/gltf+json" },
+        { "gmi", "text/gemini" },
+        { "gml", "application/gml+xml" },
+        { "gmx", "application/vnd.gmx" },
+        { "gnumeric", "application/x-gnumeric" },
+        { "gph", "application/vnd.flographit" },
+        { "gpx", "application/gpx+xml" },
+        { "gqf", "application/vnd.grafeq" },
+        { "gqs", "application/vnd.grafeq" },
+        { "gram", "application/srgs" },
+        { "gramps", "application/x-gramps-xml" },
+        { "gre", "application/vnd.geometry-explorer" },
+        { "group", "text/x-ms-group" },
+        { "grv", "application/vnd.groove-injector" },
+        { "grxml", "application/srgs+xml" },
+        { "gsd", "audio/x-gsm" },
+        { "gsf", "application/x-font-ghostscript" },
+        { "gsheet", "application/vnd.google-apps.spreadsheet" },
+        { "gslides", "application/vnd.google-apps.presentation" },
+        { "gsm", "audio/x-gsm" },
+        { "gsp", "application/x-gsp" },
+        { "gss", "application/x-gss" },
+        { "gtar", "application/x-gtar" },
+        { "gtm", "application/vnd.groove-tool-message" },
+        { "gtw", "model/vnd.gtw" },
+        { "gv", "text/vnd.graphviz" },
+        { "gxf", "application/gxf" },
+        { "gxt", "application/vnd.geonext" },
+        { "gz", "application/x-gzip" },
+        { "gzip", "application/x-gzip" },
+        { "h", "text/plain" },
+        { "h++", "text/x-c++hdr" },
+        { "h261", "video/h261" },
+        { "h263", "video/h263" },
+        { "h264", "video/h264" },
+        { "hal", "application/vnd.hal+xml" },
+        { "hbci", "application/vnd.hbci" },
+        { "hbs", "text/x-handlebars-template" },
+        { "hdd", "application/x-virtualbox-hdd" },
+        { "hdf", "application/x-hdf" },
+        { "hdml", "text/x-hdml" },
+        { "hdr", "image/vnd.radiance" },
+        { "heic", "image/heic" },
+        { "heics", "image/heic-sequence" },
+        { "heif", "image/heif" },
+        { "heifs", "image/heif-sequence" },
+        { "hej2", "image/hej2k" },
+        { "held", "application/atsc-held+xml" },
+        { "help", "application/x-helpfile" },
+        { "hgl", "application/vndhp-hpgl" },
+        { "hh", "text/x-c" },
+        { "hhc", "application/x-oleobject" },
+        { "hhk", "application/octet-stream" },
+        { "hhp", "application/octet-stream" },
+        { "hjson", "application/hjson" },
+        { "hlb", "text/x-script" },
+        { "hlp", "application/winhlp" },
+        { "hpg", "application/vndhp-hpgl" },
+        { "hpgl", "application/vnd.hp-hpgl" },
+        { "hpid", "application/vnd.hp-hpid" },
+        { "hpp", "text/plain" },
+        { "hps", "application/vnd.hp-hps" },
+        { "hqx", "application/mac-binhex40" },
+        { "hs", "text/x-haskell" },
+        { "hsj2", "image/hsj2" },
+        { "hta", "application/hta" },
+        { "htc", "text/x-component" },
+        { "htke", "application/vnd.kenameaapp" },
+        { "htm", "text/html" },
+        { "html", "text/html" },
+        { "htmls", "text/html" },
+        { "htt", "text/webviewhtml" },
+        { "htx", "text/html" },
+        { "hvd", "application/vnd.yamaha.hv-dic" },
+        { "hvp", "application/vnd.yamaha.hv-voice" },
+        { "hvs", "application/vnd.yamaha.hv-script" },
+        { "hxa", "application/xml" },
+        { "hxc", "application/xml" },
+        { "hxd", "application/octet-stream" },
+        { "hxe", "application/xml" },
+        { "hxf", "application/xml" },
+        { "hxh", "application/octet-stream" },
+        { "hxi", "application/octet-stream" },
+        { "hxk", "application/xml" },
+        { "hxq", "application/octet-stream" },
+        { "hxr", "application/octet-stream" },
+        { "hxs", "application/octet-stream" },
+        { "hxt", "text/html" },
+        { "hxv", "application/xml" },
+        { "hxw", "application/octet-stream" },
+        { "hxx", "text/plain" },
+        { "i", "text/plain" },
+        { "i2g", "application/vnd.intergeo" },
+        { "ica", "application/x-ica" },
+        { "ical", "text/calendar" },
+        { "icalendar", "text/calendar" },
+        { "icc", "application/vnd.iccprofile" },
+        { "ice", "x-conference/x-cooltalk" },
+        { "icm", "application/vnd.iccprofile" },
+        { "ico", "image/x-icon" },
+        { "ics", "text/calendar" },
+        { "icz", "text/calendar" },
+        { "idc", "text/plain" },
+        { "idl", "text/plain" },
+        { "ief", "image/ief" },
+        { "iefs", "image/ief" },
+        { "ifb", "text/calendar" },
+        { "ifm", "application/vnd.shana.informed.formdata" },
+        { "iges", "model/iges" },
+        { "igl", "application/vnd.igloader" },
+        { "igm", "application/vnd.insors.igm" },
+        { "igs", "model/iges" },
+        { "igx", "application/vnd.micrografx.igx" },
+        { "iif", "application/vnd.shana.informed.interchange" },
+        { "iii", "application/x-iphone" },
+        { "ima", "application/x-ima" },
+        { "imap", "application/x-httpd-imap" },
+        { "img", "application/octet-stream" },
+        { "imp", "application/vnd.accpac.simply.imp" },
+        { "ims", "application/vnd.ms-ims" },
+        { "in", "text/plain" },
+        { "inc", "text/plain" },
+        { "indd", "application/x-indesign" },
+        { "inf", "application/octet-stream" },
+        { "ini", "text/plain" },
+        { "ink", "application/inkml+xml" },
+        { "inkml", "application/inkml+xml" },
+        { "inl", "text/plain" },
+        { "ins", "application/x-internet-signup" },
+        { "install", "application/x-install-instructions" },
+        { "iota", "application/vnd.astraea-software.iota" },
+        { "ip", "application/x-ip2" },
+        { "ipa", "application/x-itunes-ipa" },
+        { "ipfix", "application/ipfix" },
+        { "ipg", "application/x-itunes-ipg" },
+        { "ipk", "application/vnd.shana.informed.package" },
+        { "ipproj", "text/plain" },
+        { "ipsw", "application/x-itunes-ipsw" },
+        { "iqy", "text/x-ms-iqy" },
+        { "irm", "application/vnd.ibm.rights-management" },
+        { "irp", "application/vnd.irepository.package+xml" },
+        { "isma", "application/octet-stream" },
+        { "ismv", "application/octet-stream" },
+        { "iso", "application/x-iso9660-image" },
+        { "isoimg", "application/x-iso9660-image" },
+        { "isp", "application/x-internet-signup" },
+        { "isu", "video/x-isvideo" },
+        { "it", "audio/it" },
+        { "ite", "application/x-itunes-ite" },
+        { "itlp", "application/x-itunes-itlp" },
+        { "itms", "application/x-itunes-itms" },
+        { "itp", "application/vnd.shana.informed.formtemplate" },
+        { "itpc", "application/x-itunes-itpc" },
+        { "its", "application/its+xml" },
+        { "iv", "application/x-inventor" },
+        { "ivf", "video/x-ivf" },
+        { "ivp", "application/vnd.immervision-ivp" },
+        { "ivr", "i-world/i-vrml" },
+        { "ivu", "application/vnd.immervision-ivu" },
+        { "ivy", "application/x-livescreen" },
+        { "jad", "text/vnd.sun.j2me.app-descriptor" },
+        { "jade", "text/jade" },
+        { "jam", "application/vnd.jam" },
+        { "jar", "application/java-archive" },
+        { "jardiff", "application/x-java-archive-diff" },
+        { "jav", "text/x-java-source" },
+        { "java", "application/octet-stream" },
+        { "jck", "application/liquidmotion" },
+        { "jcm", "application/x-java-commerce" },
+        { "jcz", "application/liquidmotion" },
+        { "jfif", "image/pjpeg" },
+        { "jfif-tbnl", "image/jpeg" },
+        { "jhc", "image/jphc" },
+        { "jisp", "application/vnd.jisp" },
+        { "jls", "image/jls" },
+        { "jlt", "application/vnd.hp-jlyt" },
+        { "jmz", "application/x-jmol" },
+        { "jng", "image/x-jng" },
+        { "jnlp", "application/x-java-jnlp-file" },
+        { "joda", "application/vnd.joost.joda-archive" },
+        { "jp2", "image/jp2" },
+        { "jpb", "application/octet-stream" },
+        { "jpe", "image/jpeg" },
+        { "jpeg", "image/jpeg" },
+        { "jpf", "image/jpx" },
+        { "jpg", "image/jpeg" },
+        { "jpg2", "image/jp2" },
+        { "jpgm", "video/jpm" },
+        { "jpgv", "video/jpeg" },
+        { "jph", "image/jph" },
+        { "jpm", "video/jpm" },
+        { "jps", "image/x-jps" },
+        { "jpx", "image/jpx" },
+        { "js", "application/javascript" },
+        { "jsm", "text/javascript" },
+        { "json", "application/json" },
+        { "json5", "application/json5" },
+        { "jsonld", "application/ld+json" },
+        { "jsonml", "application/jsonml+json" },
+        { "jsx", "text/jscript" },
+        { "jsxbin", "text/plain" },
+        { "jt", "model/jt" },
+        { "jut", "image/jutvision" },
+        { "jxl", "image/jxl" },
+        { "jxr", "image/jxr" },
+        { "jxra", "image/jxra" },
+        { "jxrs", "image/jxrs" },
+        { "jxs", "image/jxs" },
+        { "jxsc", "image/jxsc" },
+        { "jxsi", "image/jxsi" },
+        { "jxss", "image/jxss" },
+        { "k25", "image/x-kodak-k25" },
+        { "kar", "audio/midi" },
+        { "karbon", "application/vnd.kde.karbon" },
+        { "kdbx", "application/x-keepass2" },
+        { "kdc", "image/x-kodak-kdc" },
+        { "key", "application/vnd.apple.keynote" },
+        { "kfo", "application/vnd.kde.kformula" },
+        { "kia", "application/vnd.kidspiration" },
+        { "kil", "application/x-killustrator" },
+        { "kml", "application/vnd.google-earth.kml+xml" },
+        { "kmz", "application/vnd.google-earth.kmz" },
+        { "kne", "application/vnd.kinar" },
+        { "knp", "application/vnd.kinar" },
+        { "kon", "application/vnd.kde.kontour" },
+        { "kpr", "application/vnd.kde.kpresenter" },
+        { "kpt", "application/vnd.kde.kpresenter" },
+        { "kpxx", "application/vnd.ds-keypoint" },
+        { "ksh", "text/x-scriptksh" },
+        { "ksp", "application/vnd.kde.kspread" },
+        { "kth", "application/x-iwork-keynote-sffkth" },
+        { "ktr", "application/vnd.kahootz" },
+        { "ktx", "image/ktx" },
+        { "ktx2", "image/ktx2" },
+        { "ktz", "application/vnd.kahootz" },
+        { "kwd", "application/vnd.kde.kword" },
+        { "kwt", "application/vnd.kde.kword" },
+        { "la", "audio/nspaudio" },
+        { "lam", "audio/x-liveaudio" },
+        { "lasxml", "application/vnd.las.las+xml" },
+        { "latex", "application/x-latex" },
+        { "lbd", "application/vnd.llamagraphics.life-balance.desktop" },
+        { "lbe", "application/vnd.llamagraphics.life-balance.exchange+xml" },
+        { "les", "application/vnd.hhe.lesson-player" },
+        { "less", "text/less" },
+        { "lgr", "application/lgr+xml" },
+        { "lha", "application/x-lzh-compressed" },
+        { "lhs", "text/x-literate-haskell" },
+        { "lhx", "application/octet-stream" },
+        { "library-ms", "application/windows-library+xml" },
+        { "link66", "application/vnd.route66.link66+xml" },
+        { "list", "text/plain" },
+        { "list3820", "application/vnd.ibm.modcap" },
+        { "listafp", "application/vnd.ibm.modcap" },
+        { "lit", "application/x-ms-reader" },
+        { "litcoffee", "text/coffeescript" },
+        { "lma", "audio/nspaudio" },
+        { "lnk", "application/x-ms-shortcut" },
+        { "loadtest", "application/xml" },
+        { "log", "text/plain" },
+        { "lostxml", "application/lost+xml" },
+        { "lpk", "application/octet-stream" },
+        { "lrf", "application/octet-stream" },
+        { "lrm", "application/vnd.ms-lrm" },
+        { "lsf", "video/x-la-asf" },
+        { "lsp", "text/x-scriptlisp" },
+        { "lst", "text/plain" },
+        { "lsx", "video/x-la-asf" },
+        { "ltf", "application/vnd.frogans.ltf" },
+        { "ltx", "text/x-tex" },
+        { "lua", "text/x-lua" },
+        { "luac", "application/x-lua-bytecode" },
+        { "lvp", "audio/vnd.lucent.voice" },
+        { "lwp", "application/vnd.lotus-wordpro" },
+        { "lzh", "application/octet-stream" },
+        { "lzx", "application/x-lzx" },
+        { "m", "text/x-m" },
+        { "m13", "application/x-msmediaview" },
+        { "m14", "application/x-msmediaview" },
+        { "m1v", "video/mpeg" },
+        { "m21", "application/mp21" },
+        { "m2a", "audio/mpeg" },
+        { "m2t", "video/vnd.dlna.mpeg-tts" },
+        { "m2ts", "video/vnd.dlna.mpeg-tts" },
+        { "m2v", "video/mpeg" },
+        { "m3a", "audio/mpeg" },
+        { "m3u", "audio/x-mpegurl" },
+        { "m3u8", "audio/x-mpegurl" },
+        { "m4a", "audio/m4a" },
+        { "m4b", "audio/m4b" },
+        { "m4p", "audio/m4p" },
+        { "m4r", "audio/x-m4r" },
+        { "m4s", "video/iso.segment" },
+        { "m4u", "video/vnd.mpegurl" },
+        { "m4v", "video/x-m4v" },
+        { "ma", "application/mathematica" },
+        { "mac", "image/x-macpaint" },
+        { "mads", "application/mads+xml" },
+        { "maei", "application/mmt-aei+xml" },
+        { "mag", "application/vnd.ecowin.chart" },
+        { "mak", "text/plain" },
+        { "maker", "application/vnd.framemaker" },
+        { "man", "application/x-troff-man" },
+        { "manifest", "application/x-ms-manifest" },
+        { "map", "text/plain" },
+        { "mar", "application/octet-stream" },
+        { "markdown", "text/markdown" },
+        { "master", "application/xml" },
+        { "mathml", "application/mathml+xml" },
+        { "mb", "application/mathematica" },
+        { "mbd", "application/mbedlet" },
+        { "mbk", "application/vnd.mobius.mbk" },
+        { "mbox", "application/mbox" },
+        { "mc$", "application/x-magic-cap-package-10" },
+        { "mc1", "application/vnd.medcalcdata" },
+        { "mcd", "application/vnd.mcd" },
+        { "mcf", "text/mcf" },
+        { "mcp", "application/netmc" },
+        { "mcurl", "text/vnd.curl.mcurl" },
+        { "md", "text/markdown" },
+        { "mda", "application/msaccess" },
+        { "mdb", "application/x-msaccess" },
+        { "mde", "application/msaccess" },
+        { "mdi", "image/vnd.ms-modi" },
+        { "mdp", "application/octet-stream" },
+        { "mdx", "text/mdx" },
+        { "me", "application/x-troff-me" },
+        { "mesh", "model/mesh" },
+        { "meta4", "application/metalink4+xml" },
+        { "metalink", "application/metalink+xml" },
+        { "mets", "application/mets+xml" },
+        { "mfm", "application/vnd.mfmp" },
+        { "mfp", "application/x-shockwave-flash" },
+        { "mft", "application/rpki-manifest" },
+        { "mgp", "application/vnd.osgeo.mapguide.package" },
+        { "mgz", "application/vnd.proteus.magazine" },
+        { "mht", "message/rfc822" },
+        { "mhtml", "message/rfc822" },
+        { "mid", "audio/mid" },
+        { "midi", "audio/mid" },
+        { "mie", "application/x-mie" },
+        { "mif", "application/vnd.mif" },
+        { "mime", "message/rfc822" },
+        { "mix", "application/octet-stream" },
+        { "mj2", "video/mj2" },
+        { "mjf", "audio/x-vndaudioexplosionmjuicemediafile" },
+        { "mjp2", "video/mj2" },
+        { "mjpg", "video/x-motion-jpeg" },
+        { "mjs", "text/javascript" },
+        { "mk", "text/plain" },
+        { "mk3d", "video/x-matroska-3d" },
+        { "mka", "audio/x-matroska" },
+        { "mkd", "text/x-markdown" },
+        { "mks", "video/x-matroska" },
+        { "mkv", "video/x-matroska" },
+        { "mlp", "application/vnd.dolby.mlp" },
+        { "mm", "application/x-freemind" },
+        { "mmd", "application/vnd.chipnuts.karaoke-mmd" },
+        { "mme", "application/base64" },
+        { "mmf", "application/x-smaf" },
+        { "mml", "text/mathml" },
+        { "mmr", "image/vnd.fujixerox.edmics-mmr" },
+        { "mng", "video/x-mng" },
+        { "mno", "text/xml" },
+        { "mny", "application/x-msmoney" },
+        { "mobi", "application/x-mobipocket-ebook" },
+        { "moc", "text/x-moc" },
+        { "mod", "video/mpeg" },
+        { "mods", "application/mods+xml" },
+        { "moov", "video/quicktime" },
+        { "mov", "video/quicktime" },
+        { "movie", "video/x-sgi-movie" },
+        { "mp2", "video/mpeg" },
+        { "mp21", "application/mp21" },
+        { "mp2a", "audio/mpeg" },
+        { "mp2v", "video/mpeg" },
+        { "mp3", "audio/mpeg" },
+        { "mp4", "video/mp4" },
+        { "mp4a", "audio/mp4" },
+        { "mp4s", "application/mp4" },
+        { "mp4v", "video/mp4" },
+        { "mpa", "video/mpeg" },
+        { "mpc", "application/vnd.mophun.certificate" },
+        { "mpd", "application/dash+xml" },
+        { "mpe", "video/mpeg" },
+        { "mpeg", "video/mpeg" },
+        { "mpega", "audio/mpeg" },
+        { "mpf", "application/vnd.ms-mediapackage" },
+        { "mpg", "video/mpeg" },
+        { "mpg4", "video/mp4" },
+        { "mpga", "audio/mpeg" },
+        { "mpkg", "application/vnd.apple.installer+xml" },
+        { "mpm", "application/vnd.blueice.multipass" },
+        { "mpn", "application/vnd.mophun.application" },
+        { "mpp", "application/vnd.ms-project" },
+        { "mpt", "application/vnd.ms-project" },
+        { "mpv", "application/x-project" },
+        { "mpv2", "video/mpeg" },
+        { "mpx", "application/x-project" },
+        { "mpy", "application/vnd.ibm.minipay" },
+        { "mqv", "video/quicktime" },
+        { "mqy", "application/vnd.mobius.mqy" },
+        { "mrc", "application/marc" },
+        { "mrcx", "application/marcxml+xml" },
+        { "mrw", "image/x-minolta-mrw" },
+        { "ms", "application/x-troff-ms" },
+        { "mscml", "application/mediaservercontrol+xml" },
+        { "mseed", "application/vnd.fdsn.mseed" },
+        { "mseq", "application/vnd.mseq" },
+        { "msf", "application/vnd.epson.msf" },
+        { "msg", "application/vnd.ms-outlook" },
+        { "msh", "model/mesh" },
+        { "msi", "application/octet-stream" },
+        { "msix", "application/msix" },
+        { "msixbundle", "application/msixbundle" },
+        { "msl", "application/vnd.mobius.msl" },
+        { "msm", "application/octet-stream" },
+        { "mso", "application/octet-stream" },
+        { "msp", "application/octet-stream" },
+        { "msty", "application/vnd.muvee.style" },
+        { "mtl", "model/mtl" },
+        { "mts", "video/vnd.dlna.mpeg-tts" },
+        { "mtx", "application/xml" },
+        { "mus", "application/vnd.musician" },
+        { "musd", "application/mmt-usd+xml" },
+        { "musicxml", "application/vnd.recordare.musicxml+xml" },
+        { "mustache", "text/html" },
+        { "mv", "video/x-sgi-movie" },
+        { "mvb", "application/x-msmediaview" },
+        { "mvc", "application/x-miva-compiled" },
+        { "mvt", "application/vnd.mapbox-vector-tile" },
+        { "mwf", "application/vnd.mfer" },
+        { "mxf", "application/mxf" },
+        { "mxl", "application/vnd.recordare.musicxml" },
+        { "mxmf", "audio/mobile-xmf" },
+        { "mxml", "application/xv+xml" },
+        { "mxp", "application/x-mmxp" },
+        { "mxs", "application/vnd.triscape.mxs" },
+        { "mxu", "video/vnd.mpegurl" },
+        { "my", "audio/make" },
+        { "mzz", "application/x-vndaudioexplosionmzz" },
+        { "n-gage", "application/vnd.nokia.n-gage.symbian.install" },
+        { "n3", "text/n3" },
+        { "nap", "image/naplps" },
+        { "naplps", "image/naplps" },
+        { "nb", "application/mathematica" },
+        { "nbp", "application/vnd.wolfram.player" },
+        { "nc", "application/x-netcdf" },
+        { "ncm", "application/vndnokiaconfiguration-message" },
+        { "ncx", "application/x-dtbncx+xml" },
+        { "nef", "image/x-nikon-nef" },
+        { "nfo", "text/x-nfo" },
+        { "ngdat", "application/vnd.nokia.n-gage.data" },
+        { "nif", "image/x-niff" },
+        { "niff", "image/x-niff" },
+        { "nitf", "application/vnd.nitf" },
+        { "nix", "application/x-mix-transfer" },
+        { "nlu", "application/vnd.neurolanguage.nlu" },
+        { "nmbtemplate", "application/x-iwork-numbers-sfftemplate" },
+        { "nml", "application/vnd.enliven" },
+        { "nnd", "application/vnd.noblenet-directory" },
+        { "nns", "application/vnd.noblenet-sealer" },
+        { "nnw", "application/vnd.noblenet-web" },
+        { "npx", "image/vnd.net-fpx" },
+        { "nq", "application/n-quads" },
+        { "nrw", "image/x-nikon-nrw" },
+        { "nsc", "video/x-ms-asf" },
+        { "nsf", "application/vnd.lotus-notes" },
+        { "nt", "application/n-triples" },
+        { "ntf", "application/vnd.nitf" },
+        { "numbers", "application/vnd.apple.numbers" },
+        { "nvd", "application/x-navidoc" },
+        { "nwc", "application/x-nwc" },
+        { "nws", "message/rfc822" },
+        { "nzb", "application/x-nzb" },
+        { "o", "application/x-object" },
+        { "oa2", "application/vnd.fujitsu.oasys2" },
+        { "oa3", "application/vnd.fujitsu.oasys3" },
+        { "oas", "application/vnd.fujitsu.oasys" },
+        { "obd", "application/x-msbinder" },
+        { "obgx", "application/vnd.openblox.game+xml" },
+        { "obj", "application/x-tgif" },
+        { "ocx", "application/octet-stream" },
+        { "oda", "application/oda" },
+        { "odb", "application/vnd.oasis.opendocument.database" },
+        { "odc", "application/vnd.oasis.opendocument.chart" },
+        { "odf", "application/vnd.oasis.opendocument.formula" },
+        { "odft", "application/vnd.oasis.opendocument.formula-template" },
+        { "odg", "application/vnd.oasis.opendocument.graphics" },
+        { "odh", "text/plain" },
+        { "odi", "application/vnd.oasis.opendocument.image" },
+        { "odl", "text/plain" },
+        { "odm", "application/vnd.oasis.opendocument.text-master" },
+        { "odp", "application/vnd.oasis.opendocument.presentation" },
+        { "ods", "application/vnd.oasis.opendocument.spreadsheet" },
+        { "odt", "application/vnd.oasis.opendocument.text" },
+        { "oex", "application/x-opera-extension" },
+        { "oga", "audio/ogg" },
+        { "ogex", "model/vnd.opengex" },
+        { "ogg", "audio/ogg" },
+        { "ogv", "video/ogg" },
+        { "ogx", "application/ogg" },
+        { "omc", "application/x-omc" },
+        { "omcd", "application/x-omcdatamaker" },
+        { "omcr", "application/x-omcregerator" },
+        { "omdoc", "application/omdoc+xml" },
+        { "one", "application/onenote" },
+        { "onea", "application/onenote" },
+        { "onepkg", "application/onenote" },
+        { "onetmp", "application/onenote" },
+        { "onetoc", "application/onenote" },
+        { "onetoc2", "application/onenote" },
+        { "opf", "application/oebps-package+xml" },
+        { "opml", "text/x-opml" },
+        { "oprc", "application/vnd.palm" },
+        { "opus", "audio/ogg" },
+        { "orderedtest", "application/xml" },
+        { "orf", "image/x-olympus-orf" },
+        { "org", "application/vnd.lotus-organizer" },
+        { "osdx", "application/opensearchdescription+xml" },
+        { "osf", "application/vnd.yamaha.openscoreformat" },
+        { "osfpvg", "application/vnd.yamaha.openscoreformat.osfpvg+xml" },
+        { "osm", "application/vnd.openstreetmap.data+xml" },
+        { "otc", "application/vnd.oasis.opendocument.chart-template" },
+        { "otf", "application/font-sfnt" },
+        { "otg", "application/vnd.oasis.opendocument.graphics-template" },
+        { "oth", "application/vnd.oasis.opendocument.text-web" },
+        { "oti", "application/vnd.oasis.opendocument.image-template" },
+        { "otm", "application/vnd.oasis.opendocument.text-master" },
+        { "otp", "application/vnd.oasis.opendocument.presentation-template" },
+        { "ots", "application/vnd.oasis.opendocument.spreadsheet-template" },
+        { "ott", "application/vnd.oasis.opendocument.text-template" },
+        { "ova", "application/x-virtualbox-ova" },
+        { "ovf", "application/x-virtualbox-ovf" },
+        { "owl", "application/rdf+xml" },
+        { "oxps", "application/oxps" },
+        { "oxt", "application/vnd.openofficeorg.extension" },
+        { "oza", "application/x-oz-application" },
+        { "p", "text/x-pascal" },
+        { "p10", "application/pkcs10" },
+        { "p12", "application/x-pkcs12" },
+        { "p7a", "application/x-pkcs7-signature" },
+        { "p7b", "application/x-pkcs7-certificates" },
+        { "p7c", "application/pkcs7-mime" },
+        { "p7m", "application/pkcs7-mime" },
+        { "p7r", "application/x-pkcs7-certreqresp" },
+        { "p7s", "application/pkcs7-signature" },
+        { "p8", "application/pkcs8" },
+        { "pac", "application/x-ns-proxy-autoconfig" },
+        { "pages", "application/vnd.apple.pages" },
+        { "parquet", "application/vnd.apache.parquet" },
+        { "part", "application/pro_eng" },
+        { "pas", "text/x-pascal" },
+        { "pat", "image/x-coreldrawpattern" },
+        { "paw", "application/vnd.pawaafile" },
+        { "pbd", "application/vnd.powerbuilder6" },
+        { "pbm", "image/x-portable-bitmap" },
+        { "pcap", "application/vnd.tcpdump.pcap" },
+        { "pcast", "application/x-podcast" },
+        { "pcf", "application/x-font-pcf" },
+        { "pcf.z", "application/x-font" },
+        { "pcl", "application/vnd.hp-pcl" },
+        { "pclxl", "application/vnd.hp-pclxl" },
+        { "pct", "image/pict" },
+        { "pcurl", "application/vnd.curl.pcurl" },
+        { "pcx", "application/octet-stream" },
+        { "pcz", "application/octet-stream" },
+        { "pdb", "application/vnd.palm" },
+        { "pde", "text/x-processing" },
+        { "pdf", "application/pdf" },
+        { "pef", "image/x-pentax-pef" },
+        { "pem", "application/x-x509-ca-cert" },
+        { "pfa", "application/x-font-type1" },
+        { "pfb", "application/octet-stream" },
+        { "pfm", "application/octet-stream" },
+        { "pfr", "application/font-tdpfr" },
+        { "pfunk", "audio/make" },
+        { "pfx", "application/x-pkcs12" },
+        { "pgm", "image/x-portable-graymap" },
+        { "pgn", "application/x-chess-pgn" },
+        { "pgp", "application/pgp-encrypted" },
+        { "php", "application/x-httpd-php" },
+        { "phps", "text/text" },
+        { "pic", "image/pict" },
+        { "pict", "image/pict" },
+        { "pkg", "application/octet-stream" },
+        { "pkgdef", "text/plain" },
+        { "pkgundef", "text/plain" },
+        { "pki", "application/pkixcmp" },
+        { "pkipath", "application/pkix-pkipath" },
+        { "pko", "application/vnd.ms-pki.pko" },
+        { "pkpass", "application/vnd.apple.pkpass" },
+        { "pl", "application/x-perl" },
+        { "plb", "application/vnd.3gpp.pic-bw-large" },
+        { "plc", "application/vnd.mobius.plc" },
+        { "plf", "application/vnd.pocketlearn" },
+        { "pls", "audio/scpls" },
+        { "plx", "application/x-pixclscript" },
+        { "pm", "application/x-perl" },
+        { "pm4", "application/x-pagemaker" },
+        { "pm5", "application/x-pagemaker" },
+        { "pma", "application/x-perfmon" },
+        { "pmc", "application/x-perfmon" },
+        { "pml", "application/x-perfmon" },
+        { "pmr", "application/x-perfmon" },
+        { "pmw", "application/x-perfmon" },
+        { "png", "image/png" },
+        { "pnm", "image/x-portable-anymap" },
+        { "pnt", "image/x-macpaint" },
+        { "pntg", "image/x-macpaint" },
+        { "pnz", "image/png" },
+        { "po", "text/plain" },
+        { "portpkg", "application/vnd.macports.portpkg" },
+        { "pot", "application/vnd.ms-powerpoint" },
+        { "potm", "application/vnd.ms-powerpoint.template.macroEnabled.12" },
+        { "potx", "application/vnd.openxmlformats-officedocument.presentationml.template" },
+        { "pov", "model/x-pov" },
+        { "ppa", "application/vnd.ms-powerpoint" },
+        { "ppam", "application/vnd.ms-powerpoint.addin.macroEnabled.12" },
+        { "ppd", "application/vnd.cups-ppd" },
+        { "ppm", "image/x-portable-pixmap" },
+        { "pps", "application/vnd.ms-powerpoint" },
+        { "ppsm", "application/vnd.ms-powerpoint.slideshow.macroEnabled.12" },
+        { "ppsx", "application/vnd.openxmlformats-officedocument.presentationml.slideshow" },
+        { "ppt", "application/vnd.ms-powerpoint" },
+        { "pptm", "application/vnd.ms-powerpoint.presentation.macroEnabled.12" },
+        { "pptx", "application/vnd.openxmlformats-officedocument.presentationml.presentation" },
+        { "ppz", "application/mspowerpoint" },
+        { "pqa", "application/vnd.palm" },
+        { "prc", "application/x-mobipocket-ebook" },
+        { "pre", "application/vnd.lotus-freelance" },
+        { "prf", "application/pics-rules" },
+        { "prm", "application/octet-stream" },
+        { "provx", "application/provenance+xml" },
+        { "prt", "application/pro_eng" },
+        { "prx", "application/octet-stream" },
+        { "ps", "application/postscript" },
+        { "psb", "application/vnd.3gpp.pic-bw-small" },
+        { "psc1", "application/PowerShell" },
+        { "psd", "application/octet-stream" },
+        { "psess", "application/xml" },
+        { "psf", "application/x-font-linux-psf" },
+        { "pskcxml", "application/pskc+xml" },
+        { "psm", "application/octet-stream" },
+        { "psp", "application/octet-stream" },
+        { "pst", "application/vnd.ms-outlook" },
+        { "pti", "image/prs.pti" },
+        { "ptid", "application/vnd.pvi.ptid1" },
+        { "pub", "application/x-mspublisher" },
+        { "pvb", "application/vnd.3gpp.pic-bw-var" },
+        { "pvu", "paleovu/x-pv" },
+        { "pwn", "application/vnd.3m.post-it-notes" },
+        { "pwz", "application/vnd.ms-powerpoint" },
+        { "py", "text/plain" },
+        { "pya", "audio/vnd.ms-playready.media.pya" },
+        { "pyc", "applicaiton/x-bytecodepython" },
+        { "pyo", "model/vnd.pytha.pyox" },
+        { "pyox", "model/vnd.pytha.pyox" },
+        { "pyv", "video/vnd.ms-playready.media.pyv" },
+        { "qam", "application/vnd.epson.quickanime" },
+        { "qbo", "application/vnd.intu.qbo" },
+        { "qcp", "audio/vndqcelp" },
+        { "qd3", "x-world/x-3dmf" },
+        { "qd3d", "x-world/x-3dmf" },
+        { "qfx", "application/vnd.intu.qfx" },
+        { "qht", "text/x-html-insertion" },
+        { "qhtm", "text/x-html-insertion" },
+        { "qif", "image/x-quicktime" },
+        { "qps", "application/vnd.publishare-delta-tree" },
+        { "qt", "video/quicktime" },
+        { "qtc", "video/x-qtc" },
+        { "qti", "image/x-quicktime" },
+        { "qtif", "image/x-quicktime" },
+        { "qtl", "application/x-quicktimeplayer" },
+        { "qwd", "application/vnd.quark.quarkxpress" },
+        { "qwt", "application/vnd.quark.quarkxpress" },
+        { "qxb", "application/vnd.quark.quarkxpress" },
+        { "qxd", "application/octet-stream" },
+        { "qxl", "application/vnd.quark.quarkxpress" },
+        { "qxt", "application/vnd.quark.quarkxpress" },
+        { "ra", "audio/x-pn-realaudio" },
+        { "raf", "image/x-fuji-raf" },
+        { "ram", "audio/x-pn-realaudio" },
+        { "raml", "application/raml+yaml" },
+        { "rapd", "application/route-apd+xml" },
+        { "rar", "application/x-rar-compressed" },
+        { "ras", "image/x-cmu-raster" },
+        { "rast", "image/cmu-raster" },
+        { "rat", "application/rat-file" },
+        { "raw", "image/x-panasonic-rw" },
+        { "rc", "text/plain" },
+        { "rc2", "text/plain" },
+        { "rcprofile", "application/vnd.ipunplugged.rcprofile" },
+        { "rct", "text/plain" },
+        { "rdf", "application/rdf+xml" },
+        { "rdlc", "application/xml" },
+        { "rdp", "application/rdp" },
+        { "rdz", "application/vnd.data-vision.rdz" },
+        { "reg", "text/plain" },
+        { "relo", "application/p2p-overlay+xml" },
+        { "rep", "application/vnd.businessobjects" },
+        { "res", "application/x-dtbresource+xml" },
+        { "resx", "application/xml" },
+        { "rexx", "text/x-scriptrexx" },
+        { "rf", "image/vnd.rn-realflash" },
+        { "rgb", "image/x-rgb" },
+        { "rgs", "text/plain" },
+        { "rif", "application/reginfo+xml" },
+        { "rip", "audio/vnd.rip" },
+        { "ris", "application/x-research-info-systems" },
+        { "rl", "application/resource-lists+xml" },
+        { "rlc", "image/vnd.fujixerox.edmics-rlc" },
+        { "rld", "application/resource-lists-diff+xml" },
+        { "rm", "application/vnd.rn-realmedia" },
+        { "rmi", "audio/mid" },
+        { "rmm", "audio/x-pn-realaudio" },
+        { "rmp", "application/vnd.rn-rn_music_package" },
+        { "rms", "application/vnd.jcp.javame.midlet-rms" },
+        { "rmvb", "application/vnd.rn-realmedia-vbr" },
+        { "rnc", "application/relax-ng-compact-syntax" },
+        { "rng", "application/xml" },
+        { "rnx", "application/vndrn-realplayer" },
+        { "roa", "application/rpki-roa" },
+        { "roff", "application/x-troff" },
+        { "rp", "image/vndrn-realpix" },
+        { "rp9", "application/vnd.cloanto.rp9" },
+        { "rpm", "audio/x-pn-realaudio-plugin" },
+        { "rpss", "application/vnd.nokia.radio-presets" },
+        { "rpst", "application/vnd.nokia.radio-preset" },
+        { "rq", "application/sparql-query" },
+        { "rqy", "text/x-ms-rqy" },
+        { "rs", "application/rls-services+xml" },
+        { "rsat", "application/atsc-rsat+xml" },
+        { "rsd", "application/rsd+xml" },
+        { "rsheet", "application/urc-ressheet+xml" },
+        { "rss", "application/rss+xml" },
+        { "rt", "text/vndrn-realtext" },
+        { "rtf", "application/rtf" },
+        { "rtx", "text/richtext" },
+        { "ruleset", "application/xml" },
+        { "run", "application/x-makeself" },
+        { "rusd", "application/route-usd+xml" },
+        { "rv", "video/vndrn-realvideo" },
+        { "rvt", "application/octet-stream" },
+        { "rw2", "image/x-panasonic-rw2" },
+        { "rwl", "image/x-panasonic-rw2" },
+        { "s", "text/plain" },
+        { "s3m", "audio/s3m" },
+        { "s7z", "application/x-7z-compressed" },
+        { "saf", "application/vnd.yamaha.smaf-audio" },
+        { "safariextz", "application/x-safari-safariextz" },
+        { "sass", "text/x-sass" },
+        { "saveme", "application/octet-stream" },
+        { "sbk", "application/x-tbook" },
+        { "sbml", "application/sbml+xml" },
+        { "sc", "application/vnd.ibm.secure-container" },
+        { "scd", "application/x-msschedule" },
+        { "scm", "application/vnd.lotus-screencam" },
+        { "scq", "application/scvp-cv-request" },
+        { "scr", "text/plain" },
+        { "scs", "application/scvp-cv-response" },
+        { "scss", "text/x-scss" },
+        { "sct", "text/scriptlet" },
+        { "scurl", "text/vnd.curl.scurl" },
+        { "sd2", "audio/x-sd2" },
+        { "sda", "application/vnd.stardivision.draw" },
+        { "sdc", "application/vnd.stardivision.calc" },
+        { "sdd", "application/vnd.stardivision.impress" },
+        { "sdkd", "application/vnd.solent.sdkm+xml" },
+        { "sdkm", "application/vnd.solent.sdkm+xml" },
+        { "sdml", "text/plain" },
+        { "sdoc", "application/sdoc" },
+        { "sdp", "application/sdp" },
+        { "sdr", "application/sounder" },
+        { "sdw", "application/vnd.stardivision.writer" },
+        { "sea", "application/octet-stream" },
+        { "searchconnector-ms", "application/windows-search-connector+xml" },
+        { "see", "application/vnd.seemail" },
+        { "seed", "application/vnd.fdsn.seed" },
+        { "sema", "application/vnd.sema" },
+        { "semd", "application/vnd.semd" },
+        { "semf", "application/vnd.semf" },
+        { "senmlx", "application/senml+xml" },
+        { "sensmlx", "application/sensml+xml" },
+        { "ser", "application/java-serialized-object" },
+        { "set", "application/set" },
+        { "setpay", "application/set-payment-initiation" },
+        { "setreg", "application/set-registration-initiation" },
+        { "settings", "application/xml" },
+        { "sfd-hdstx", "application/vnd.hydrostatix.sof-data" },
+        { "sfs", "application/vnd.spotfire.sfs" },
+        { "sfv", "text/x-sfv" },
+        { "sgf", "application/x-go-sgf" },
+        { "sgi", "image/sgi" },
+        { "sgimb", "application/x-sgimb" },
+        { "sgl", "application/vnd.stardivision.writer-global" },
+        { "sgm", "text/sgml" },
+        { "sgml", "text/sgml" },
+        { "sh", "application/x-sh" },
+        { "shar", "application/x-shar" },
+        { "shex", "text/shex" },
+        { "shf", "application/shf+xml" },
+        { "shtml", "text/html" },
+        { "sid", "image/x-mrsid-image" },
+        { "sieve", "application/sieve" },
+        { "sig", "application/pgp-signature" },
+        { "sil", "audio/silk" },
+        { "silo", "model/mesh" },
+        { "sis", "application/vnd.symbian.install" },
+        { "sisx", "application/vnd.symbian.install" },
+        { "sit", "application/x-stuffit" },
+        { "sitemap", "application/xml" },
+        { "sitx", "application/x-stuffitx" },
+        { "siv", "application/sieve" },
+        { "skd", "application/vnd.koan" },
+        { "skin", "application/xml" },
+        { "skm", "application/vnd.koan" },
+        { "skp", "application/x-koan" },
+        { "skt", "application/vnd.koan" },
+        { "sl", "application/x-seelogo" },
+        { "sldm", "application/vnd.ms-powerpoint.slide.macroEnabled.12" },
+        { "sldx", "application/vnd.openxmlformats-officedocument.presentationml.slide" },
+        { "slim", "text/slim" },
+        { "slk", "application/vnd.ms-excel" },
+        { "slm", "text/slim" },
+        { "sln", "text/plain" },
+        { "sls", "application/route-s-tsid+xml" },
+        { "slt", "application/vnd.epson.salt" },
+        { "slupkg-ms", "application/x-ms-license" },
+        { "sm", "application/vnd.stepmania.stepchart" },
+        { "smd", "audio/x-smd" },
+        { "smf", "application/vnd.stardivision.math" },
+        { "smi", "application/octet-stream" },
+        { "smil", "application/smil+xml" },
+        { "smv", "video/x-smv" },
+        { "smx", "audio/x-smd" },
+        { "smz", "audio/x-smd" },
+        { "smzip", "application/vnd.stepmania.package" },
+        { "snd", "audio/basic" },
+        { "snf", "application/x-font-snf" },
+        { "snippet", "application/xml" },
+        { "snp", "application/octet-stream" },
+        { "so", "application/octet-stream" },
+        { "sol", "text/plain" },
+        { "sor", "text/plain" },
+        { "spc", "application/x-pkcs7-certificates" },
+        { "spdx", "text/spdx" },
+        { "spf", "application/vnd.yamaha.smaf-phrase" },
+        { "spl", "application/futuresplash" },
+        { "spot", "text/vnd.in3d.spot" },
+        { "spp", "application/scvp-vp-response" },
+        { "spq", "application/scvp-vp-request" },
+        { "spr", "application/x-sprite" },
+        { "sprite", "application/x-sprite" },
+        { "spx", "audio/ogg" },
+        { "sql", "application/sql" },
+        { "sr2", "image/x-sony-sr2" },
+        { "src", "application/x-wais-source" },
+        { "srf", "text/plain" },
+        { "srt", "application/x-subrip" },
+        { "sru", "application/sru+xml" },
+        { "srx", "application/sparql-results+xml" },
+        { "ssdl", "application/ssdl+xml" },
+        { "sse", "application/vnd.kodak-descriptor" },
+        { "ssf", "application/vnd.epson.ssf" },
+        { "ssi", "text/x-server-parsed-html" },
+        { "ssisdeploymentmanifest", "text/xml" },
+        { "ssm", "application/streamingmedia" },
+        { "ssml", "application/ssml+xml" },
+        { "sst", "application/vnd.ms-pki.certstore" },
+        { "st", "application/vnd.sailingtracker.track" },
+        { "stc", "application/vnd.sun.xml.calc.template" },
+        { "std", "application/vnd.sun.xml.draw.template" },
+        { "step", "application/step" },
+        { "stf", "application/vnd.wt.stf" },
+        { "sti", "application/vnd.sun.xml.impress.template" },
+        { "stk", "application/hyperstudio" },
+        { "stl", "application/vnd.ms-pki.stl" },
+        { "stp", "application/step" },
+        { "stpx", "model/step+xml" },
+        { "stpxz", "model/step-xml+zip" },
+        { "stpz", "model/step+zip" },
+        { "str", "application/vnd.pg.format" },
+        { "stw", "application/vnd.sun.xml.writer.template" },
+        { "sty", "text/x-tex" },
+        { "styl", "text/stylus" },
+        { "stylus", "text/stylus" },
+        { "sub", "text/vnd.dvb.subtitle" },
+        { "sus", "application/vnd.sus-calendar" },
+        { "susp", "application/vnd.sus-calendar" },
+        { "sv4cpio", "application/x-sv4cpio" },
+        { "sv4crc", "application/x-sv4crc" },
+        { "svc", "application/xml" },
+        { "svd", "application/vnd.svd" },
+        { "svf", "image/vnddwg" },
+        { "svg", "image/svg+xml" },
+        { "svgz", "image/svg+xml" },
+        { "svr", "application/x-world" },
+        { "swa", "application/x-director" },
+        { "swf", "application/x-shockwave-flash" },
+        { "swi", "application/vnd.arastra.swi" },
+        { "swidtag", "application/swid+xml" },
+        { "sxc", "application/vnd.sun.xml.calc" },
+        { "sxd", "application/vnd.sun.xml.draw" },
+        { "sxg", "application/vnd.sun.xml.writer.global" },
+        { "sxi", "application/vnd.sun.xml.impress" },
+        { "sxm", "application/vnd.sun.xml.math" },
+        { "sxw", "application/vnd.sun.xml.writer" },
+        { "t", "application/x-troff" },
+        { "t3", "application/x-t3vm-image" },
+        { "t38", "image/t38" },
+        { "taglet", "application/vnd.mynfc" },
+        { "talk", "text/x-speech" },
+        { "tao", "application/vnd.tao.intent-module-archive" },
+        { "tap", "image/vnd.tencent.tap" },
+        { "tar", "application/x-tar" },
+        { "tar.gz", "application/gzip" },
+        { "taz", "application/x-gtar" },
+        { "tbk", "application/toolbook" },
+        { "tcap", "application/vnd.3gpp2.tcap" },
+        { "tcl", "application/x-tcl" },
+        { "tcsh", "text/x-scripttcsh" },
+        { "td", "application/urc-targetdesc+xml" },
+        { "teacher", "application/vnd.smart.teacher" },
+        { "tei", "application/tei+xml" },
+        { "teicorpus", "application/tei+xml" },
+        { "template", "application/x-iwork-pages-sfftemplate" },
+        { "testrunconfig", "application/xml" },
+        { "testsettings", "application/xml" },
+        { "tex", "application/x-tex" },
+        { "texi", "application/x-texinfo" },
+        { "texinfo", "application/x-texinfo" },
+        { "text", "text/plain" },
+        { "tfi", "application/thraud+xml" },
+        { "tfm", "application/x-tex-tfm" },
+        { "tfx", "image/tiff-fx" },
+        { "tga", "image/x-tga" },
+        { "tgz", "application/x-compressed" },
+        { "thmx", "application/vnd.ms-officetheme" },
+        { "thn", "application/octet-stream" },
+        { "tif", "image/tiff" },
+        { "tiff", "image/tiff" },
+        { "tk", "application/x-tcl" },
+        { "tlh", "text/plain" },
+        { "tli", "text/plain" },
+        { "tmo", "application/vnd.tmobile-livetv" },
+        { "toc", "application/octet-stream" },
+        { "toml", "application/toml" },
+        { "torrent", "application/x-bittorrent" },
+        { "tpl", "application/vnd.groove-tool-template" },
+        { "tpt", "application/vnd.trid.tpt" },
+        { "tr", "application/x-troff" },
+        { "tra", "application/vnd.trueapp" },
+        { "trig", "application/trig" },
+        { "trm", "application/x-msterminal" },
+        { "trx", "application/xml" },
+        { "ts", "text/typescript" },
+        { "tsd", "application/timestamped-data" },
+        { "tsi", "audio/tsp-audio" },
+        { "tsp", "application/dsptype" },
+        { "tsv", "text/tab-separated-values" },
+        { "tsx", "application/typescript" },
+        { "ttc", "application/x-font-ttf" },
+        { "ttf", "application/font-sfnt" },
+        { "ttl", "text/turtle" },
+        { "ttml", "application/ttml+xml" },
+        { "tts", "video/vnd.dlna.mpeg-tts" },
+        { "turbot", "image/florian" },
+        { "twd", "application/vnd.simtech-mindmapper" },
+        { "twds", "application/vnd.simtech-mindmapper" },
+        { "txd", "application/vnd.genomatix.tuxedo" },
+        { "txf", "application/vnd.mobius.txf" },
+        { "txt", "text/plain" },
+        { "u32", "application/octet-stream" },
+        { "u3d", "model/u3d" },
+        { "u8dsn", "message/global-delivery-status" },
+        { "u8hdr", "message/global-headers" },
+        { "u8mdn", "message/global-disposition-notification" },
+        { "u8msg", "message/global" },
+        { "ubj", "application/ubjson" },
+        { "udeb", "application/x-debian-package" },
+        { "ufd", "application/vnd.ufdl" },
+        { "ufdl", "application/vnd.ufdl" },
+        { "uil", "text/x-uil" },
+        { "uls", "text/iuls" },
+        { "ulx", "application/x-glulx" },
+        { "umj", "application/vnd.umajin" },
+        { "uni", "text/uri-list" },
+        { "unis", "text/uri-list" },
+        { "unityweb", "application/vnd.unity" },
+        { "unv", "application/i-deas" },
+        { "uo", "application/vnd.uoml+xml" },
+        { "uoml", "application/vnd.uoml+xml" },
+        { "uri", "text/uri-list" },
+        { "uris", "text/uri-list" },
+        { "urls", "text/uri-list" },
+        { "usda", "model/vnd.usda" },
+        { "usdz", "model/vnd.usdz+zip" },
+        { "user", "text/plain" },
+        { "ustar", "application/x-ustar" },
+        { "utz", "application/vnd.uiq.theme" },
+        { "uu", "text/x-uuencode" },
+        { "uue", "text/x-uuencode" },
+        { "uva", "audio/vnd.dece.audio" },
+        { "uvd", "application/vnd.dece.data" },
+        { "uvf", "application/vnd.dece.data" },
+        { "uvg", "image/vnd.dece.graphic" },
+        { "uvh", "video/vnd.dece.hd" },
+        { "uvi", "image/vnd.dece.graphic" },
+        { "uvm", "video/vnd.dece.mobile" },
+        { "uvp", "video/vnd.dece.pd" },
+        { "uvs", "video/vnd.dece.sd" },
+        { "uvt", "application/vnd.dece.ttml+xml" },
+        { "uvu", "video/vnd.uvvu.mp4" },
+        { "uvv", "video/vnd.dece.video" },
+        { "uvva", "audio/vnd.dece.audio" },
+        { "uvvd", "application/vnd.dece.data" },
+        { "uvvf", "application/vnd.dece.data" },
+        { "uvvg", "image/vnd.dece.graphic" },
+        { "uvvh", "video/vnd.dece.hd" },
+        { "uvvi", "image/vnd.dece.graphic" },
+        { "uvvm", "video/vnd.dece.mobile" },
+        { "uvvp", "video/vnd.dece.pd" },
+        { "uvvs", "video/vnd.dece.sd" },
+        { "uvvt", "application/vnd.dece.ttml+xml" },
+        { "uvvu", "video/vnd.uvvu.mp4" },
+        { "uvvv", "video/vnd.dece.video" },
+        { "uvvx", "application/vnd.dece.unspecified" },
+        { "uvvz", "application/vnd.dece.zip" },
+        { "uvx", "application/vnd.dece.unspecified" },
+        { "uvz", "application/vnd.dece.zip" },
+        { "vb", "text/plain" },
+        { "vbdproj", "text/plain" },
+        { "vbk", "video/mpeg" },
+        { "vbox", "application/x-virtualbox-vbox" },
+        { "vbox-extpack", "application/x-virtualbox-vbox-extpack" },
+        { "vbproj", "text/plain" },
+        { "vbs", "text/vbscript" },
+        { "vcard", "text/vcard" },
+        { "vcd", "application/x-cdlink" },
+        { "vcf", "text/x-vcard" },
+        { "vcg", "application/vnd.groove-vcard" },
+        { "vcproj", "application/xml" },
+        { "vcs", "text/plain" },
+        { "vcx", "application/vnd.vcx" },
+        { "vcxproj", "application/xml" },
+        { "vda", "application/vda" },
+        { "vddproj", "text/plain" },
+        { "vdi", "application/x-virtualbox-vdi" },
+        { "vdo", "video/vdo" },
+        { "vdp", "text/plain" },
+        { "vdproj", "text/plain" },
+        { "vds", "model/vnd.sap.vds" },
+        { "vdx", "application/vnd.ms-visio.viewer" },
+        { "vew", "application/groupwise" },
+        { "vhd", "application/x-virtualbox-vhd" },
+        { "vis", "application/vnd.visionary" },
+        { "viv", "video/vnd.vivo" },
+        { "vivo", "video/vivo" },
+        { "vmd", "application/vocaltec-media-desc" },
+        { "vmdk", "application/x-virtualbox-vmdk" },
+        { "vmf", "application/vocaltec-media-file" },
+        { "vml", "text/xml" },
+        { "vob", "video/x-ms-vob" },
+        { "voc", "audio/voc" },
+        { "vor", "application/vnd.stardivision.writer" },
+        { "vos", "video/vosaic" },
+        { "vox", "application/x-authorware-bin" },
+        { "vqe", "audio/x-twinvq-plugin" },
+        { "vqf", "audio/x-twinvq" },
+        { "vql", "audio/x-twinvq-plugin" },
+        { "vrml", "model/vrml" },
+        { "vrt", "x-world/x-vrt" },
+        { "vscontent", "application/xml" },
+        { "vsct", "text/xml" },
+        { "vsd", "application/vnd.visio" },
+        { "vsdx", "application/vnd.ms-visio.viewer" },
+        { "vsf", "application/vnd.vsf" },
+        { "vsi", "application/ms-vsi" },
+        { "vsix", "application/vsix" },
+        { "vsixlangpack", "text/xml" },
+        { "vsixmanifest", "text/xml" },
+        { "vsmdi", "application/xml" },
+        { "vspscc", "text/plain" },
+        { "vss", "application/vnd.visio" },
+        { "vsscc", "text/plain" },
+        { "vssettings", "text/xml" },
+        { "vssscc", "text/plain" },
+        { "vst", "application/vnd.visio" },
+        { "vstemplate", "text/xml" },
+        { "vsto", "application/x-ms-vsto" },
+        { "vsw", "application/vnd.visio" },
+        { "vsx", "application/vnd.visio" },
+        { "vtf", "image/vnd.valve.source.texture" },
+        { "vtt", "text/vtt" },
+        { "vtu", "model/vnd.vtu" },
+        { "vtx", "application/vnd.visio" },
+        { "vxml", "application/voicexml+xml" },
+        { "w3d", "application/x-director" },
+        { "w60", "application/wordperfect60" },
+        { "w61", "application/wordperfect61" },
+        { "w6w", "application/msword" },
+        { "wad", "application/x-doom" },
+        { "wadl", "application/vnd.sun.wadl+xml" },
+        { "war", "application/java-archive" },
+        { "wasm", "application/wasm" },
+        { "wav", "audio/wav" },
+        { "wave", "audio/wav" },
+        { "wax", "audio/x-ms-wax" },
+        { "wb1", "application/x-qpro" },
+        { "wbk", "application/msword" },
+        { "wbmp", "image/vnd.wap.wbmp" },
+        { "wbs", "application/vnd.criticaltools.wbs+xml" },
+        { "wbxml", "application/vnd.wap.wbxml" },
+        { "wcm", "application/vnd.ms-works" },
+        { "wdb", "application/vnd.ms-works" },
+        { "wdp", "image/vnd.ms-photo" },
+        { "web", "application/vndxara" },
+        { "weba", "audio/webm" },
+        { "webapp", "application/x-web-app-manifest+json" },
+        { "webarchive", "application/x-safari-webarchive" },
+        { "webm", "video/webm" },
+        { "webmanifest", "application/manifest+json" },
+        { "webp", "image/webp" }, /* https://en.wikipedia.org/wiki/WebP */
+        { "webtest", "application/xml" },
+        { "wg", "application/vnd.pmi.widget" },
+        { "wgsl", "text/wgsl" },
+        { "wgt", "application/widget" },
+        { "wif", "application/watcherinfo+xml" },
+        { "wiq", "application/xml" },
+        { "wiz", "application/msword" },
+        { "wk1", "application/x-123" },
+        { "wks", "application/vnd.ms-works" },
+        { "wlmp", "application/wlmoviemaker" },
+        { "wlpginstall", "application/x-wlpg-detect" },
+        { "wlpginstall3", "application/x-wlpg3-detect" },
+        { "wm", "video/x-ms-wm" },
+        { "wma", "audio/x-ms-wma" },
+        { "wmd", "application/x-ms-wmd" },
+        { "wmf", "application/x-msmetafile" },
+        { "wml", "text/vnd.wap.wml" },
+        { "wmlc", "application/vnd.wap.wmlc" },
+        { "wmls", "text/vnd.wap.wmlscript" },
+        { "wmlsc", "application/vnd.wap.wmlscriptc" },
+        { "wmp", "video/x-ms-wmp" },
+        { "wmv", "video/x-ms-wmv" },
+        { "wmx", "video/x-ms-wmx" },
+        { "wmz", "application/x-ms-wmz" },
+        { "woff", "application/font-woff" },
+        { "woff2", "application/font-woff2" },
+        { "word", "application/msword" },
+        { "wp", "application/wordperfect" },
+        { "wp5", "application/wordperfect" },
+        { "wp6", "application/wordperfect" },
+        { "wpd", "application/vnd.wordperfect" },
+        { "wpl", "application/vnd.ms-wpl" },
+        { "wps", "application/vnd.ms-works" },
+        { "wq1", "application/x-lotus" },
+        { "wqd", "application/vnd.wqd" },
+        { "wri", "application/x-mswrite" },
+        { "wrl", "x-world/x-vrml" },
+        { "wrz", "x-world/x-vrml" },
+        { "wsc", "text/scriptlet" },
+        { "wsdl", "text/xml" },
+        { "wspolicy", "application/wspolicy+xml" },
+        { "wsrc", "application/x-wais-source" },
+        { "wtb", "application/vnd.webturbo" },
+        { "wtk", "application/x-wintalk" },
+        { "wvx", "video/x-ms-wvx" },
+        { "wz", "application/x-wingz" },
+        { "x", "application/directx" },
+        { "x-png", "image/png" },
+        { "x32", "application/x-authorware-bin" },
+        { "x3d", "application/vnd.hzn-3d-crossword" },
+        { "x3db", "model/x3d+binary" },
+        { "x3dbz", "model/x3d+binary" },
+        { "x3dv", "model/x3d+vrml" },
+        { "x3dvz", "model/x3d+vrml" },
+        { "x3dz", "model/x3d+xml" },
+        { "x3f", "image/x-sigma-x3f" },
+        { "x_b", "model/vnd.parasolid.transmit.binary" },
+        { "x_t", "model/vnd.parasolid.transmit.text" },
+        { "xaf", "x-world/x-vrml" },
+        { "xaml", "application/xaml+xml" },
+        { "xap", "application/x-silverlight-app" },
+        { "xar", "application/vnd.xara" },
+        { "xav", "application/xcap-att+xml" },
+        { "xbap", "application/x-ms-xbap" },
+        { "xbd", "application/vnd.fujixerox.docuworks.binder" },
+        { "xbm", "image/x-xbitmap" },
+        { "xca", "application/xcap-caps+xml" },
+        { "xcf", "image/x-xcf" },
+        { "xcs", "application/calendar+xml" },
+        { "xdf", "application/xcap-diff+xml" },
+        { "xdm", "application/vnd.syncml.dm+xml" },
+        { "xdp", "application/vnd.adobe.xdp+xml" },
+        { "xdr", "text/plain" },
+        { "xdssc", "application/dssc+xml" },
+        { "xdw", "application/vnd.fujixerox.docuworks" },
+        { "xel", "application/xcap-el+xml" },
+        { "xenc", "application/xenc+xml" },
+        { "xer", "application/patch-ops-error+xml" },
+        { "xfdf", "application/vnd.adobe.xfdf" },
+        { "xfdl", "application/vnd.xfdl" },
+        { "xgz", "xgl/drawing" },
+        { "xht", "application/xhtml+xml" },
+        { "xhtm", "application/vnd.pwg-xhtml-print+xml" },
+        { "xhtml", "application/xhtml+xml" },
+        { "xhvml", "application/xv+xml" },
+        { "xif", "image/vnd.xiff" },
+        { "xl", "application/excel" },
+        { "xla", "application/vnd.ms-excel" },
+        { "xlam", "application/vnd.ms-excel.addin.macroEnabled.12" },
+        { "xlb", "application/excel" },
+        { "xlc", "application/vnd.ms-excel" },
+        { "xld", "application/vnd.ms-excel" },
+        { "xlf", "application/x-xliff+xml" },
+        { "xlk", "application/vnd.ms-excel" },
+        { "xll", "application/vnd.ms-excel" },
+        { "xlm", "application/vnd.ms-excel" },
+        { "xls", "application/vnd.ms-excel" },
+        { "xlsb", "application/vnd.ms-excel.sheet.binary.macroEnabled.12" },
+        { "xlsm", "application/vnd.ms-excel.sheet.macroEnabled.12" },
+        { "xlsx", "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet" },
+        { "xlt", "application/vnd.ms-excel" },
+        { "xltm", "application/vnd.ms-excel.template.macroEnabled.12" },
+        { "xltx", "application/vnd.openxmlformats-officedocument.spreadsheetml.template" },
+        { "xlv", "application/excel" },
+        { "xlw", "application/vnd.ms-excel" },
+        { "xm", "audio/xm" },
+        { "xml", "text/xml" },
+        { "xmp", "application/octet-stream" },
+        { "xmta", "application/xml" },
+        { "xmz", "xgl/movie" },
+        { "xns", "application/xcap-ns+xml" },
+        { "xo", "application/vnd.olpc-sugar" },
+        { "xof", "x-world/x-vrml" },
+        { "xoml", "text/plain" },
+        { "xop", "application/xop+xml" },
+        { "xpi", "application/x-xpinstall" },
+        { "xpix", "application/x-vndls-xpix" },
+        { "xpl", "application/xproc+xml" },
+        { "xpm", "image/x-xpixmap" },
+        { "xpr", "application/vnd.is-xpr" },
+        { "xps", "application/vnd.ms-xpsdocument" },
+        { "xpw", "application/vnd.intercon.formnet" },
+        { "xpx", "application/vnd.intercon.formnet" },
+        { "xrm-ms", "text/xml" },
+        { "xsc", "application/xml" },
+        { "xsd", "text/xml" },
+        { "xsf", "text/xml" },
+        { "xsl", "text/xml" },
+        { "xslt", "text/xml" },
+        { "xsm", "application/vnd.syncml+xml" },
+        { "xsn", "application/octet-stream" },
+        { "xspf", "application/xspf+xml" },
+        { "xsr", "video/x-amt-showrun" },
+        { "xss", "application/xml" },
+        { "xtp", "application/octet-stream" },
+        { "xul", "application/vnd.mozilla.xul+xml" },
+        { "xvm", "application/xv+xml" },
+        { "xvml", "application/xv+xml" },
+        { "xwd", "image/x-xwindowdump" },
+        { "xyz", "chemical/x-xyz" },
+        { "xz", "application/x-xz" },
+        { "yaml", "application/yaml" },
+        { "yang", "application/yang" },
+        { "yin", "application/yin+xml" },
+        { "yml", "application/yaml" },
+        { "ymp", "text/x-suse-ymp" },
+        { "z", "application/x-compress" },
+        { "z1", "application/x-zmachine" },
+        { "z2", "application/x-zmachine" },
+        { "z3", "application/x-zmachine" },
+        { "z4", "application/x-zmachine" },
+        { "z5", "application/x-zmachine" },
+        { "z6", "application/x-zmachine" },
+        { "z7", "application/x-zmachine" },
+        { "z8", "application/x-zmachine" },
+        { "zaz", "application/vnd.zzazz.deck+xml" },
+        { "zip", "application/zip" },
+        { "zir", "application/vnd.zul" },
+        { "zirz", "application/vnd.zul" },
+        { "zmm", "application/vnd.handheld-entertainment+xml" },
+        { "zoo", "application/octet-stream" },
+        { "zsh", "text/x-scriptzsh" }
+    };
+    constexpr size_t MIME_COUNT = std::size(MIME_ENTRIES);
+
+    constexpr size_t maxSuffixLength() {
+        size_t longest = 0;
+        for (const auto& entry : MIME_ENTRIES) {
+            longest = std::max(longest, entry.suffix.size());
+        }
+        return longest;
+    }
+    constexpr size_t MAX_SUFFIX_LENGTH = maxSuffixLength();
+
+    constexpr uint64_t fnv1a(std::string_view s) {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (const char c : s) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    // Murmur3 finalizer; FNV's high bits are too weak on short keys to pick buckets from directly
+    constexpr uint64_t mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    constexpr uint32_t mixSeed(uint64_t h, uint32_t seed) {
+        return static_cast<uint32_t>(mix(h ^ (seed * 0x9e3779b97f4a7c15ULL)));
+    }
+
+    // Hash-and-displace perfect hash built at compile time: each key's bucket picks the
+    // first seed that lands all of its keys on free slots, so a lookup is one hash,
+    // one mix and a single string compare.
+    template <size_t SLOTS, size_t BUCKETS>
+    struct PerfectHash {
+        static_assert((SLOTS & (SLOTS - 1)) == 0, "slot count must be a power of two");
+        std::array<uint16_t, BUCKETS> seeds{};
+        std::array<uint16_t, SLOTS> slots{}; // entry index + 1, 0 when empty
+        bool ok = false;
+
+        static constexpr size_t bucketOf(uint64_t h) {
+            return static_cast<size_t>((mix(h) >> 32) % BUCKETS);
+        }
+
+        constexpr const MimeEntry* find(std::string_view suffix) const {
+            const uint64_t h = fnv1a(suffix);
+            const uint16_t slot = this->slots[mixSeed(h, this->seeds[bucketOf(h)]) & (SLOTS - 1)];
+            if (slot == 0 || MIME_ENTRIES[slot - 1].suffix != suffix) return nullptr;
+            return &MIME_ENTRIES[slot - 1];
+        }
+    };
+
+    template <size_t SLOTS, size_t BUCKETS>
+    constexpr PerfectHash<SLOTS, BUCKETS> buildPerfectHash() {
+        PerfectHash<SLOTS, BUCKETS> table{};
+        std::array<uint64_t, MIME_COUNT> hashes{};
+        std::array<size_t, BUCKETS + 1> starts{};
+        std::array<size_t, MIME_COUNT> members{};
+        for (size_t i = 0; i < MIME_COUNT; i++) {
+            hashes[i] = fnv1a(MIME_ENTRIES[i].suffix);
+            starts[table.bucketOf(hashes[i]) + 1]++;
+        }
+        size_t largest = 0;
+        for (size_t b = 0; b < BUCKETS; b++) {
+            largest = std::max(largest, starts[b + 1]);
+            starts[b + 1] += starts[b];
+        }
+        std::array<size_t, BUCKETS> fill{};
+        for (size_t i = 0; i < MIME_COUNT; i++) {
+            const size_t b = table.bucketOf(hashes[i]);
+            members[starts[b] + fill[b]++] = i;
+        }
+        // Place the fullest buckets first while the table is still sparse
+        for (size_t size = largest; size > 0; size--) {
+            for (size_t b = 0; b < BUCKETS; b++) {
+                if (starts[b + 1] - starts[b] != size) continue;
+                bool placed = false;
+                for (uint32_t seed = 0; seed < 0xffff && !placed; seed++) {
+                    std::array<size_t, 32> taken{};
+                    size_t count = 0;
+                    placed = size <= taken.size();
+                    for (size_t m = starts[b]; m < starts[b + 1] && placed; m++) {
+                        const size_t slot = mixSeed(hashes[members[m]], seed) & (SLOTS - 1);
+                        for (size_t t = 0; t < count; t++) {
+                            if (taken[t] == slot) placed = false;
+                        }
+                        if (table.slots[slot] != 0) placed = false;
+                        taken[count++] = slot;
+                    }
+                    if (!placed) continue;
+                    table.seeds[b] = static_cast<uint16_t>(seed);
+                    for (size_t m = starts[b]; m < starts[b + 1]; m++) {
+                        table.slots[mixSeed(hashes[members[m]], seed) & (SLOTS - 1)] = static_cast<uint16_t>(members[m] + 1);
+                    }
+                }
+                if (!placed) return table;
+            }
+        }
+        table.ok = true;
+        return table;
+    }
+
+    constexpr auto MIME_TABLE = buildPerfectHash<4096, 1024>();
+    static_assert(MIME_TABLE.ok, "could not build the MIME perfect hash, grow the table");
+    static_assert(MIME_COUNT < 0xffff, "MIME table indices are 16-bit");
+
+    std::string toLowerSuffix(std::string_view suffix) {
+        std::string lower(suffix);
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return lower;
     }
 }
 
-/*static*/ std::map<std::string, std::string> WebServer::mime_types{
-    { ".123", "application/vnd.lotus-1-2-3" },
-    { ".1km", "application/vnd.1000minds.decision-model+xml" },
-    { ".323", "text/h323" },
-    { ".3dm", "x-world/x-3dmf" },
-    { ".3dmf", "x-world/x-3dmf" },
-    { ".3dml", "text/vnd.in3d.3dml" },
-    { ".3ds", "image/x-3ds" },
-    { ".3g2", "video/3gpp2" },
-    { ".3ga", "audio/mp4" },
-    { ".3gp", "video/3gpp" },
-    { ".3gp2", "video/3gpp2" },
-    { ".3gpa", "audio/mp4" },
-    { ".3gpp", "video/3gpp" },
-    { ".3mf", "model/3mf" },
-    { ".7z", "application/x-7z-compressed" },
-    { ".7zip", "application/x-7z-compressed" },
-    { ".a", "application/octet-stream" },
-    { ".aa", "audio/audible" },
-    { ".aab", "application/x-authorware-bin" },
-    { ".aac", "audio/aac" },
-    { ".aaf", "application/octet-stream" },
-    { ".aam", "application/x-authorware-map" },
-    { ".aas", "application/x-authorware-seg" },
-    { ".aax", "audio/vnd.audible.aax" },
-    { ".abc", "text/vndabc" },
-    { ".abw", "application/x-abiword" },
-    { ".ac", "application/pkix-attr-cert" },
-    { ".ac3", "audio/ac3" },
-    { ".aca", "application/octet-stream" },
-    { ".acc", "application/vnd.americandynamics.acc" },
-    { ".accda", "application/msaccess.addin" },
-    { ".accdb", "application/msaccess" },
-    { ".accdc", "application/msaccess.cab" },
-    { ".accde", "application/msaccess" },
-    { ".accdr", "application/msaccess.runtime" },
-    { ".accdt", "application/msaccess" },
-    { ".accdw", "application/msaccess.webapplication" },
-    { ".accft", "application/msaccess.ftemplate" },
-    { ".ace", "application/x-ace-compressed" },
-    { ".acgi", "text/html" },
-    { ".acu", "application/vnd.acucobol" },
-    { ".acutc", "application/vnd.acucorp" },
-    { ".acx", "application/internet-property-stream" },
-    { ".AddIn", "text/xml" },
-    { ".ade", "application/msaccess" },
-    { ".adobebridge", "application/x-bridge-url" },
-    { ".adp", "application/msaccess" },
-    { ".ADT", "audio/vnd.dlna.adts" },
-    { ".ADTS", "audio/aac" },
-    { ".aep", "application/vnd.audiograph" },
-    { ".aff", "audio/aiff" },
-    { ".afl", "video/animaflex" },
-    { ".afm", "application/octet-stream" },
-    { ".afp", "application/vnd.ibm.modcap" },
-    { ".age", "application/vnd.age" },
-    { ".ahead", "application/vnd.ahead.space" },
-    { ".ai", "application/postscript" },
-    { ".aif", "audio/aiff" },
-    { ".aifc", "audio/aiff" },
-    { ".aiff", "audio/aiff" },
-    { ".aim", "application/x-aim" },
-    { ".aip", "text/x-audiosoft-intra" },
-    { ".air", "application/vnd.adobe.air-application-installer-package+zip" },
-    { ".ait", "application/vnd.dvb.ait" },
-    { ".alz", "application/x-alz-compressed" },
-    { ".amc", "application/mpeg" },
-    { ".ami", "application/vnd.amiga.ami" },
-    { ".aml", "application/automationml-aml+xml" },
-    { ".amlx", "application/automationml-amlx+zip" },
-    { ".amr", "audio/amr" },
-    { ".ani", "application/x-navi-animation" },
-    { ".anx", "application/annodex" },
-    { ".aos", "application/x-nokia-9000-communicator-add-on-software" },
-    { ".apk", "application/vnd.android.package-archive" },
-    { ".apng", "image/apng" },
-    { ".appcache", "text/cache-manifest" },
-    { ".appinstaller", "application/appinstaller" },
-    { ".application", "application/x-ms-application" },
-    { ".appx", "application/appx" },
-    { ".appxbundle", "application/appxbundle" },
-    { ".apr", "application/vnd.lotus-approach" },
-    { ".aps", "application/mime" },
-    { ".arc", "application/x-freearc" },
-    { ".arj", "application/x-arj" },
-    { ".art", "image/x-jg" },
-    { ".arw", "image/x-sony-arw" },
-    { ".asa", "application/xml" },
-    { ".asax", "application/xml" },
-    { ".asc", "application/pgp-signature" },
-    { ".ascx", "application/xml" },
-    { ".asd", "application/octet-stream" },
-    { ".asf", "video/x-ms-asf" },
-    { ".ashx", "application/xml" },
-    { ".asi", "application/octet-stream" },
-    { ".asm", "text/plain" },
-    { ".asmx", "application/xml" },
-    { ".aso", "application/vnd.accpac.simply.aso" },
-    { ".asp", "text/asp" },
-    { ".aspx", "application/xml" },
-    { ".asr", "video/x-ms-asf" },
-    { ".asx", "video/x-ms-asf" },
-    { ".atc", "application/vnd.acucorp" },
-    { ".atom", "application/atom+xml" },
-    { ".atomcat", "application/atomcat+xml" },
-    { ".atomdeleted", "application/atomdeleted+xml" },
-    { ".atomsvc", "application/atomsvc+xml" },
-    { ".atx", "application/vnd.antix.game-component" },
-    { ".au", "audio/basic" },
-    { ".avci", "image/avci" },
-    { ".avcs", "image/avcs" },
-    { ".avi", "video/x-msvideo" },
-    { ".avif", "image/avif" },
-    { ".avifs", "image/avif-sequence" },
-    { ".avs", "video/avs-video" },
-    { ".aw", "application/applixware" },
-    { ".axa", "audio/annodex" },
-    { ".axs", "application/olescript" },
-    { ".axv", "video/annodex" },
-    { ".azf", "application/vnd.airzip.filesecure.azf" },
-    { ".azs", "application/vnd.airzip.filesecure.azs" },
-    { ".azv", "image/vnd.airzip.accelerator.azv" },
-    { ".azw", "application/vnd.amazon.ebook" },
-    { ".b16", "image/vnd.pco.b16" },
-    { ".bas", "text/plain" },
-    { ".bat", "application/x-msdownload" },
-    { ".bcpio", "application/x-bcpio" },
-    { ".bdf", "application/x-font-bdf" },
-    { ".bdm", "application/vnd.syncml.dm+wbxml" },
-    { ".bdoc", "application/x-bdoc" },
-    { ".bed", "application/vnd.realvnc.bed" },
-    { ".bh2", "application/vnd.fujitsu.oasysprs" },
-    { ".bib", "text/x-bibtex" },
-    { ".bin", "application/octet-stream" },
-    { ".blb", "application/x-blorb" },
-    { ".blorb", "application/x-blorb" },
-    { ".bmi", "application/vnd.bmi" },
-    { ".bmml", "application/vnd.balsamiq.bmml+xml" },
-    { ".bmp", "image/bmp" },
-    { ".boo", "text/x-boo" },
-    { ".book", "application/vnd.framemaker" },
-    { ".box", "application/vnd.previewsystems.box" },
-    { ".boz", "application/x-bzip2" },
-    { ".bpk", "application/octet-stream" },
-    { ".bsh", "application/x-bsh" },
-    { ".bsp", "model/vnd.valve.source.compiled-map" },
-    { ".btf", "image/prs.btif" },
-    { ".btif", "image/prs.btif" },
-    { ".buffer", "application/octet-stream" },
-    { ".bz", "application/x-bzip" },
-    { ".bz2", "application/x-bzip2" },
-    { ".c", "text/plain" },
-    { ".c++", "text/x-c++src" },
-    { ".c11amc", "application/vnd.cluetrust.cartomobile-config" },
-    { ".c11amz", "application/vnd.cluetrust.cartomobile-config-pkg" },
-    { ".c4d", "application/vnd.clonk.c4group" },
-    { ".c4f", "application/vnd.clonk.c4group" },
-    { ".c4g", "application/vnd.clonk.c4group" },
-    { ".c4p", "application/vnd.clonk.c4group" },
-    { ".c4u", "application/vnd.clonk.c4group" },
-    { ".cab", "application/octet-stream" },
-    { ".caf", "audio/x-caf" },
-    { ".calx", "application/vnd.ms-office.calx" },
-    { ".cap", "application/vnd.tcpdump.pcap" },
-    { ".car", "application/vnd.curl.car" },
-    { ".cat", "application/vnd.ms-pki.seccat" },
-    { ".cb7", "application/x-cb7" },
-    { ".cba", "application/x-cbr" },
-    { ".cbr", "application/x-cbr" },
-    { ".cbt", "application/x-cbt" },
-    { ".cbz", "application/x-cbz" },
-    { ".cc", "text/plain" },
-    { ".ccad", "application/clariscad" },
-    { ".cco", "application/x-cocoa" },
-    { ".cct", "application/x-director" },
-    { ".ccxml", "application/ccxml+xml" },
-    { ".cd", "text/plain" },
-    { ".cdbcmsg", "application/vnd.contact.cmsg" },
-    { ".cdda", "audio/aiff" },
-    { ".cdf", "application/x-cdf" },
-    { ".cdfx", "application/cdfx+xml" },
-    { ".cdkey", "application/vnd.mediastation.cdkey" },
-    { ".cdmia", "application/cdmi-capability" },
-    { ".cdmic", "application/cdmi-container" },
-    { ".cdmid", "application/cdmi-domain" },
-    { ".cdmio", "application/cdmi-object" },
-    { ".cdmiq", "application/cdmi-queue" },
-    { ".cdr", "image/x-coreldraw" },
-    { ".cdt", "image/x-coreldrawtemplate" },
-    { ".cdx", "chemical/x-cdx" },
-    { ".cdxml", "application/vnd.chemdraw+xml" },
-    { ".cdy", "application/vnd.cinderella" },
-    { ".cer", "application/x-x509-ca-cert" },
-    { ".cfg", "text/plain" },
-    { ".cfs", "application/x-cfs-compressed" },
-    { ".cgm", "image/cgm" },
-    { ".cha", "application/x-chat" },
-    { ".chat", "application/x-chat" },
-    { ".chm", "application/octet-stream" },
-    { ".chrt", "application/vnd.kde.kchart" },
-    { ".cif", "chemical/x-cif" },
-    { ".cii", "application/vnd.anser-web-certificate-issue-initiation" },
-    { ".cil", "application/vnd.ms-artgalry" },
-    { ".cjs", "application/node" },
-    { ".cla", "application/vnd.claymore" },
-    { ".class", "application/x-java-applet" },
-    { ".cld", "model/vnd.cld" },
-    { ".clkk", "application/vnd.crick.clicker.keyboard" },
-    { ".clkp", "application/vnd.crick.clicker.palette" },
-    { ".clkt", "application/vnd.crick.clicker.template" },
-    { ".clkw", "application/vnd.crick.clicker.wordbank" },
-    { ".clkx", "application/vnd.crick.clicker" },
-    { ".clp", "application/x-msclip" },
-    { ".cls", "text/x-tex" },
-    { ".cmc", "application/vnd.cosmocaller" },
-    { ".cmd", "text/plain" },
-    { ".cmdf", "chemical/x-cmdf" },
-    { ".cml", "chemical/x-cml" },
-    { ".cmp", "application/vnd.yellowriver-custom-menu" },
-    { ".cmx", "image/x-cmx" },
-    { ".cnf", "text/plain" },
-    { ".cod", "image/cis-cod" },
-    { ".coffee", "text/coffeescript" },
-    { ".com", "application/x-msdownload" },
-    { ".conf", "text/plain" },
-    { ".config", "application/xml" },
-    { ".contact", "text/x-ms-contact" },
-    { ".coverage", "application/xml" },
-    { ".cpio", "application/x-cpio" },
-    { ".cpl", "application/cpl+xml" },
-    { ".cpp", "text/plain" },
-    { ".cpt", "application/mac-compactpro" },
-    { ".cr2", "image/x-canon-cr2" },
-    { ".cr3", "image/x-canon-cr3" },
-    { ".crd", "application/x-mscardfile" },
-    { ".crl", "application/pkix-crl" },
-    { ".crt", "application/x-x509-ca-cert" },
-    { ".crw", "image/x-canon-crw" },
-    { ".crx", "application/x-chrome-extension" },
-    { ".cryptonote", "application/vnd.rig.cryptonote" },
-    { ".cs", "text/plain" },
-    { ".csdproj", "text/plain" },
-    { ".csh", "application/x-csh" },
-    { ".csl", "application/vnd.citationstyles.style+xml" },
-    { ".csml", "chemical/x-csml" },
-    { ".csp", "application/vnd.commonspace" },
-    { ".csproj", "text/plain" },
-    { ".css", "text/css" },
-    { ".cst", "application/x-director" },
-    { ".csv", "text/csv" },
-    { ".cu", "application/cu-seeme" },
-    { ".cur", "application/octet-stream" },
-    { ".curl", "text/vnd.curl" },
-    { ".cwl", "application/cwl" },
-    { ".cww", "application/prs.cww" },
-    { ".cxt", "application/x-director" },
-    { ".cxx", "text/plain" },
-    { ".czx", "application/x-czx" },
-    { ".d", "text/x-dsrc" },
-    { ".dae", "model/vnd.collada+xml" },
-    { ".daf", "application/vnd.mobius.daf" },
-    { ".dar", "application/x-dar" },
-    { ".dart", "application/vnd.dart" },
-    { ".dat", "application/octet-stream" },
-    { ".dataless", "application/vnd.fdsn.seed" },
-    { ".datasource", "application/xml" },
-    { ".davmount", "application/davmount+xml" },
-    { ".db", "application/vnd.sqlite3" },
-    { ".db-shm", "application/vnd.sqlite3" },
-    { ".db-wal", "application/vnd.sqlite3" },
-    { ".dbf", "application/vnd.dbf" },
-    { ".dbk", "application/docbook+xml" },
-    { ".dbproj", "text/plain" },
-    { ".dcr", "application/x-director" },
-    { ".dcurl", "text/vnd.curl.dcurl" },
-    { ".dd2", "application/vnd.oma.dd2+xml" },
-    { ".ddd", "application/vnd.fujixerox.ddd" },
-    { ".ddf", "application/vnd.syncml.dmddf+xml" },
-    { ".dds", "image/vnd.ms-dds" },
-    { ".deb", "application/x-debian-package" },
-    { ".deepv", "application/x-deepv" },
-    { ".def", "text/plain" },
-    { ".deploy", "application/octet-stream" },
-    { ".der", "application/x-x509-ca-cert" },
-    { ".dfac", "application/vnd.dreamfactory" },
-    { ".dgc", "application/x-dgc-compressed" },
-    { ".dgml", "application/xml" },
-    { ".dib", "image/bmp" },
-    { ".dic", "text/x-c" },
-    { ".dif", "video/x-dv" },
-    { ".diff", "text/plain" },
-    { ".dir", "application/x-director" },
-    { ".dis", "application/vnd.mobius.dis" },
-    { ".disco", "text/xml" },
-    { ".disposition-notification", "message/disposition-notification" },
-    { ".dist", "application/octet-stream" },
-    { ".distz", "application/octet-stream" },
-    { ".divx", "video/divx" },
-    { ".djv", "image/vnd.djvu" },
-    { ".djvu", "image/vnd.djvu" },
-    { ".dl", "video/dl" },
-    { ".dll", "application/x-msdownload" },
-    { ".dll.config", "text/xml" },
-    { ".dlm", "text/dlm" },
-    { ".dmg", "application/octet-stream" },
-    { ".dmp", "application/vnd.tcpdump.pcap" },
-    { ".dms", "application/octet-stream" },
-    { ".dna", "application/vnd.dna" },
-    { ".dng", "image/x-adobe-dng" },
-    { ".doc", "application/msword" },
-    { ".docm", "application/vnd.ms-word.document.macroEnabled.12" },
-    { ".docx", "application/vnd.openxmlformats-officedocument.wordprocessingml.document" },
-    { ".dot", "application/msword" },
-    { ".dotm", "application/vnd.ms-word.template.macroEnabled.12" },
-    { ".dotx", "application/vnd.openxmlformats-officedocument.wordprocessingml.template" },
-    { ".dp", "application/vnd.osgi.dp" },
-    { ".dpg", "application/vnd.dpgraph" },
-    { ".dpx", "image/dpx" },
-    { ".dra", "audio/vnd.dra" },
-    { ".drle", "image/dicom-rle" },
-    { ".drw", "application/drafting" },
-    { ".dsc", "text/prs.lines.tag" },
-    { ".dsp", "application/octet-stream" },
-    { ".dssc", "application/dssc+der" },
-    { ".dsw", "text/plain" },
-    { ".dtb", "application/x-dtbook+xml" },
-    { ".dtd", "text/xml" },
-    { ".dts", "audio/vnd.dts" },
-    { ".dtsConfig", "text/xml" },
-    { ".dtshd", "audio/vnd.dts.hd" },
-    { ".dump", "application/octet-stream" },
-    { ".dv", "video/x-dv" },
-    { ".dvb", "video/vnd.dvb.file" },
-    { ".dvi", "application/x-dvi" },
-    { ".dwd", "application/atsc-dwd+xml" },
-    { ".dwf", "drawing/x-dwf" },
-    { ".dwg", "application/acad" },
-    { ".dwp", "application/octet-stream" },
-    { ".dxf", "application/x-dxf" },
-    { ".dxp", "application/vnd.spotfire.dxp" },
-    { ".dxr", "application/x-director" },
-    { ".ear", "application/java-archive" },
-    { ".ecelp4800", "audio/vnd.nuera.ecelp4800" },
-    { ".ecelp7470", "audio/vnd.nuera.ecelp7470" },
-    { ".ecelp9600", "audio/vnd.nuera.ecelp9600" },
-    { ".ecma", "application/ecmascript" },
-    { ".edm", "application/vnd.novadigm.edm" },
-    { ".edx", "application/vnd.novadigm.edx" },
-    { ".efif", "application/vnd.picsel" },
-    { ".ei6", "application/vnd.pg.osasli" },
-    { ".el", "text/x-scriptelisp" },
-    { ".elc", "application/octet-stream" },
-    { ".emf", "image/emf" },
-    { ".eml", "message/rfc822" },
-    { ".emma", "application/emma+xml" },
-    { ".emotionml", "application/emotionml+xml" },
-    { ".emz", "application/octet-stream" },
-    { ".env", "application/x-envoy" },
-    { ".eol", "audio/vnd.digital-winds" },
-    { ".eot", "application/vnd.ms-fontobject" },
-    { ".eps", "application/postscript" },
-    { ".epub", "application/epub+zip" },
-    { ".erf", "application/x-endace-erf" },
-    { ".es", "application/ecmascript" },
-    { ".es3", "application/vnd.eszigno3+xml" },
-    { ".esa", "application/vnd.osgi.subsystem" },
-    { ".esf", "application/vnd.epson.esf" },
-    { ".et3", "application/vnd.eszigno3+xml" },
-    { ".etl", "application/etl" },
-    { ".etx", "text/x-setext" },
-    { ".eva", "application/x-eva" },
-    { ".evy", "application/envoy" },
-    { ".exe", "application/vnd.microsoft.portable-executable" },
-    { ".exe.config", "text/xml" },
-    { ".exi", "application/exi" },
-    { ".exp", "application/express" },
-    { ".exr", "image/aces" },
-    { ".ext", "application/vnd.novadigm.ext" },
-    { ".ez", "application/andrew-inset" },
-    { ".ez2", "application/vnd.ezpix-album" },
-    { ".ez3", "application/vnd.ezpix-package" },
-    { ".f", "text/x-fortran" },
-    { ".f4v", "video/mp4" },
-    { ".f77", "text/x-fortran" },
-    { ".f90", "text/x-fortran" },
-    { ".fb", "application/x-maker" },
-    { ".fbdoc", "application/x-maker" },
-    { ".fbs", "image/vnd.fastbidsheet" },
-    { ".fcdt", "application/vnd.adobe.formscentral.fcdt" },
-    { ".fcs", "application/vnd.isac.fcs" },
-    { ".fdf", "application/vnd.fdf" },
-    { ".fdt", "application/fdt+xml" },
-    { ".feature", "text/x-gherkin" },
-    { ".fe_launch", "application/vnd.denovo.fcselayout-link" },
-    { ".fg5", "application/vnd.fujitsu.oasysgp" },
-    { ".fgd", "application/x-director" },
-    { ".fh", "image/x-freehand" },
-    { ".fh4", "image/x-freehand" },
-    { ".fh5", "image/x-freehand" },
-    { ".fh7", "image/x-freehand" },
-    { ".fhc", "image/x-freehand" },
-    { ".fif", "application/fractals" },
-    { ".fig", "application/x-xfig" },
-    { ".filters", "application/xml" },
-    { ".fits", "image/fits" },
-    { ".fla", "application/octet-stream" },
-    { ".flac", "audio/flac" },
-    { ".fli", "video/x-fli" },
-    { ".flo", "application/vnd.micrografx.flo" },
-    { ".flr", "x-world/x-vrml" },
-    { ".flv", "video/x-flv" },
-    { ".flw", "application/vnd.kde.kivio" },
-    { ".flx", "text/vnd.fmi.flexstor" },
-    { ".fly", "text/vnd.fly" },
-    { ".fm", "application/vnd.framemaker" },
-    { ".fmf", "video/x-atomic3d-feature" },
-    { ".fnc", "application/vnd.frogans.fnc" },
-    { ".fo", "application/vnd.software602.filler.form+xml" },
-    { ".for", "text/x-fortran" },
-    { ".fpx", "image/vnd.fpx" },
-    { ".frame", "application/vnd.framemaker" },
-    { ".frl", "application/freeloader" },
-    { ".frm", "application/x-maker" },
-    { ".fsc", "application/vnd.fsc.weblaunch" },
-    { ".fsscript", "application/fsharp-script" },
-    { ".fst", "image/vnd.fst" },
-    { ".fsx", "application/fsharp-script" },
-    { ".ftc", "application/vnd.fluxtime.clip" },
-    { ".fti", "application/vnd.anser-web-funds-transfer-initiation" },
-    { ".funk", "audio/make" },
-    { ".fvt", "video/vnd.fvt" },
-    { ".fxp", "application/vnd.adobe.fxp" },
-    { ".fxpl", "application/vnd.adobe.fxp" },
-    { ".fzs", "application/vnd.fuzzysheet" },
-    { ".g", "text/plain" },
-    { ".g2w", "application/vnd.geoplan" },
-    { ".g3", "image/g3fax" },
-    { ".g3w", "application/vnd.geospace" },
-    { ".gac", "application/vnd.groove-account" },
-    { ".gam", "application/x-tads" },
-    { ".gbr", "application/vnd.gerber" },
-    { ".gca", "application/x-gca-compressed" },
-    { ".gcd", "text/x-pcs-gcd" },
-    { ".gcf", "application/x-graphing-calculator" },
-    { ".gdl", "model/vnd.gdl" },
-    { ".gdoc", "application/vnd.google-apps.document" },
-    { ".ged", "text/vnd.familysearch.gedcom" },
-    { ".gemini", "text/gemini" },
-    { ".generictest", "application/xml" },
-    { ".geo", "application/vnd.dynageo" },
-    { ".geojson", "application/geo+json" },
-    { ".gex", "application/vnd.geometry-explorer" },
-    { ".ggb", "application/vnd.geogebra.file" },
-    { ".ggt", "application/vnd.geogebra.tool" },
-    { ".ghf", "application/vnd.groove-help" },
-    { ".gif", "image/gif" },
-    { ".gim", "application/vnd.groove-identity-message" },
-    { ".gitattributes", "text/plain" },
-    { ".gitignore", "text/plain" },
-    { ".gl", "video/gl" },
-    { ".glb", "model/gltf-binary" },
-    { ".gltf", "model/gltf+json" },
-    { ".gmi", "text/gemini" },
-    { ".gml", "application/gml+xml" },
-    { ".gmx", "application/vnd.gmx" },
-    { ".gnumeric", "application/x-gnumeric" },
-    { ".gph", "application/vnd.flographit" },
-    { ".gpx", "application/gpx+xml" },
-    { ".gqf", "application/vnd.grafeq" },
-    { ".gqs", "application/vnd.grafeq" },
-    { ".gram", "application/srgs" },
-    { ".gramps", "application/x-gramps-xml" },
-    { ".gre", "application/vnd.geometry-explorer" },
-    { ".group", "text/x-ms-group" },
-    { ".grv", "application/vnd.groove-injector" },
-    { ".grxml", "application/srgs+xml" },
-    { ".gsd", "audio/x-gsm" },
-    { ".gsf", "application/x-font-ghostscript" },
-    { ".gsheet", "application/vnd.google-apps.spreadsheet" },
-    { ".gslides", "application/vnd.google-apps.presentation" },
-    { ".gsm", "audio/x-gsm" },
-    { ".gsp", "application/x-gsp" },
-    { ".gss", "application/x-gss" },
-    { ".gtar", "application/x-gtar" },
-    { ".gtm", "application/vnd.groove-tool-message" },
-    { ".gtw", "model/vnd.gtw" },
-    { ".gv", "text/vnd.graphviz" },
-    { ".gxf", "application/gxf" },
-    { ".gxt", "application/vnd.geonext" },
-    { ".gz", "application/x-gzip" },
-    { ".gzip", "application/x-gzip" },
-    { ".h", "text/plain" },
-    { ".h++", "text/x-c++hdr" },
-    { ".h261", "video/h261" },
-    { ".h263", "video/h263" },
-    { ".h264", "video/h264" },
-    { ".hal", "application/vnd.hal+xml" },
-    { ".hbci", "application/vnd.hbci" },
-    { ".hbs", "text/x-handlebars-template" },
-    { ".hdd", "application/x-virtualbox-hdd" },
-    { ".hdf", "application/x-hdf" },
-    { ".hdml", "text/x-hdml" },
-    { ".hdr", "image/vnd.radiance" },
-    { ".heic", "image/heic" },
-    { ".heics", "image/heic-sequence" },
-    { ".heif", "image/heif" },
-    { ".heifs", "image/heif-sequence" },
-    { ".hej2", "image/hej2k" },
-    { ".held", "application/atsc-held+xml" },
-    { ".help", "application/x-helpfile" },
-    { ".hgl", "application/vndhp-hpgl" },
-    { ".hh", "text/x-c" },
-    { ".hhc", "application/x-oleobject" },
-    { ".hhk", "application/octet-stream" },
-    { ".hhp", "application/octet-stream" },
-    { ".hjson", "application/hjson" },
-    { ".hlb", "text/x-script" },
-    { ".hlp", "application/winhlp" },
-    { ".hpg", "application/vndhp-hpgl" },
-    { ".hpgl", "application/vnd.hp-hpgl" },
-    { ".hpid", "application/vnd.hp-hpid" },
-    { ".hpp", "text/plain" },
-    { ".hps", "application/vnd.hp-hps" },
-    { ".hqx", "application/mac-binhex40" },
-    { ".hs", "text/x-haskell" },
-    { ".hsj2", "image/hsj2" },
-    { ".hta", "application/hta" },
-    { ".htc", "text/x-component" },
-    { ".htke", "application/vnd.kenameaapp" },
-    { ".htm", "text/html" },
-    { ".html", "text/html" },
-    { ".htmls", "text/html" },
-    { ".htt", "text/webviewhtml" },
-    { ".htx", "text/html" },
-    { ".hvd", "application/vnd.yamaha.hv-dic" },
-    { ".hvp", "application/vnd.yamaha.hv-voice" },
-    { ".hvs", "application/vnd.yamaha.hv-script" },
-    { ".hxa", "application/xml" },
-    { ".hxc", "application/xml" },
-    { ".hxd", "application/octet-stream" },
-    { ".hxe", "application/xml" },
-    { ".hxf", "application/xml" },
-    { ".hxh", "application/octet-stream" },
-    { ".hxi", "application/octet-stream" },
-    { ".hxk", "application/xml" },
-    { ".hxq", "application/octet-stream" },
-    { ".hxr", "application/octet-stream" },
-    { ".hxs", "application/octet-stream" },
-    { ".hxt", "text/html" },
-    { ".hxv", "application/xml" },
-    { ".hxw", "application/octet-stream" },
-    { ".hxx", "text/plain" },
-    { ".i", "text/plain" },
-    { ".i2g", "application/vnd.intergeo" },
-    { ".ica", "application/x-ica" },
-    { ".ical", "text/calendar" },
-    { ".icalendar", "text/calendar" },
-    { ".icc", "application/vnd.iccprofile" },
-    { ".ice", "x-conference/x-cooltalk" },
-    { ".icm", "application/vnd.iccprofile" },
-    { ".ico", "image/x-icon" },
-    { ".ics", "text/calendar" },
-    { ".icz", "text/calendar" },
-    { ".idc", "text/plain" },
-    { ".idl", "text/plain" },
-    { ".ief", "image/ief" },
-    { ".iefs", "image/ief" },
-    { ".ifb", "text/calendar" },
-    { ".ifm", "application/vnd.shana.informed.formdata" },
-    { ".iges", "model/iges" },
-    { ".igl", "application/vnd.igloader" },
-    { ".igm", "application/vnd.insors.igm" },
-    { ".igs", "model/iges" },
-    { ".igx", "application/vnd.micrografx.igx" },
-    { ".iif", "application/vnd.shana.informed.interchange" },
-    { ".iii", "application/x-iphone" },
-    { ".ima", "application/x-ima" },
-    { ".imap", "application/x-httpd-imap" },
-    { ".img", "application/octet-stream" },
-    { ".imp", "application/vnd.accpac.simply.imp" },
-    { ".ims", "application/vnd.ms-ims" },
-    { ".in", "text/plain" },
-    { ".inc", "text/plain" },
-    { ".indd", "application/x-indesign" },
-    { ".inf", "application/octet-stream" },
-    { ".ini", "text/plain" },
-    { ".ink", "application/inkml+xml" },
-    { ".inkml", "application/inkml+xml" },
-    { ".inl", "text/plain" },
-    { ".ins", "application/x-internet-signup" },
-    { ".install", "application/x-install-instructions" },
-    { ".iota", "application/vnd.astraea-software.iota" },
-    { ".ip", "application/x-ip2" },
-    { ".ipa", "application/x-itunes-ipa" },
-    { ".ipfix", "application/ipfix" },
-    { ".ipg", "application/x-itunes-ipg" },
-    { ".ipk", "application/vnd.shana.informed.package" },
-    { ".ipproj", "text/plain" },
-    { ".ipsw", "application/x-itunes-ipsw" },
-    { ".iqy", "text/x-ms-iqy" },
-    { ".irm", "application/vnd.ibm.rights-management" },
-    { ".irp", "application/vnd.irepository.package+xml" },
-    { ".isma", "application/octet-stream" },
-    { ".ismv", "application/octet-stream" },
-    { ".iso", "application/x-iso9660-image" },
-    { ".isoimg", "application/x-iso9660-image" },
-    { ".isp", "application/x-internet-signup" },
-    { ".isu", "video/x-isvideo" },
-    { ".it", "audio/it" },
-    { ".ite", "application/x-itunes-ite" },
-    { ".itlp", "application/x-itunes-itlp" },
-    { ".itms", "application/x-itunes-itms" },
-    { ".itp", "application/vnd.shana.informed.formtemplate" },
-    { ".itpc", "application/x-itunes-itpc" },
-    { ".its", "application/its+xml" },
-    { ".iv", "application/x-inventor" },
-    { ".IVF", "video/x-ivf" },
-    { ".ivp", "application/vnd.immervision-ivp" },
-    { ".ivr", "i-world/i-vrml" },
-    { ".ivu", "application/vnd.immervision-ivu" },
-    { ".ivy", "application/x-livescreen" },
-    { ".jad", "text/vnd.sun.j2me.app-descriptor" },
-    { ".jade", "text/jade" },
-    { ".jam", "application/vnd.jam" },
-    { ".jar", "application/java-archive" },
-    { ".jardiff", "application/x-java-archive-diff" },
-    { ".jav", "text/x-java-source" },
-    { ".java", "application/octet-stream" },
-    { ".jck", "application/liquidmotion" },
-    { ".jcm", "application/x-java-commerce" },
-    { ".jcz", "application/liquidmotion" },
-    { ".jfif", "image/pjpeg" },
-    { ".jfif-tbnl", "image/jpeg" },
-    { ".jhc", "image/jphc" },
-    { ".jisp", "application/vnd.jisp" },
-    { ".jls", "image/jls" },
-    { ".jlt", "application/vnd.hp-jlyt" },
-    { ".jmz", "application/x-jmol" },
-    { ".jng", "image/x-jng" },
-    { ".jnlp", "application/x-java-jnlp-file" },
-    { ".joda", "application/vnd.joost.joda-archive" },
-    { ".jp2", "image/jp2" },
-    { ".jpb", "application/octet-stream" },
-    { ".jpe", "image/jpeg" },
-    { ".jpeg", "image/jpeg" },
-    { ".jpf", "image/jpx" },
-    { ".jpg", "image/jpeg" },
-    { ".jpg2", "image/jp2" },
-    { ".jpgm", "video/jpm" },
-    { ".jpgv", "video/jpeg" },
-    { ".jph", "image/jph" },
-    { ".jpm", "video/jpm" },
-    { ".jps", "image/x-jps" },
-    { ".jpx", "image/jpx" },
-    { ".js", "application/javascript" },
-    { ".jsm", "text/javascript" },
-    { ".json", "application/json" },
-    { ".json5", "application/json5" },
-    { ".jsonld", "application/ld+json" },
-    { ".jsonml", "application/jsonml+json" },
-    { ".jsx", "text/jscript" },
-    { ".jsxbin", "text/plain" },
-    { ".jt", "model/jt" },
-    { ".jut", "image/jutvision" },
-    { ".jxl", "image/jxl" },
-    { ".jxr", "image/jxr" },
-    { ".jxra", "image/jxra" },
-    { ".jxrs", "image/jxrs" },
-    { ".jxs", "image/jxs" },
-    { ".jxsc", "image/jxsc" },
-    { ".jxsi", "image/jxsi" },
-    { ".jxss", "image/jxss" },
-    { ".k25", "image/x-kodak-k25" },
-    { ".kar", "audio/midi" },
-    { ".karbon", "application/vnd.kde.karbon" },
-    { ".kdbx", "application/x-keepass2" },
-    { ".kdc", "image/x-kodak-kdc" },
-    { ".key", "application/vnd.apple.keynote" },
-    { ".kfo", "application/vnd.kde.kformula" },
-    { ".kia", "application/vnd.kidspiration" },
-    { ".kil", "application/x-killustrator" },
-    { ".kml", "application/vnd.google-earth.kml+xml" },
-    { ".kmz", "application/vnd.google-earth.kmz" },
-    { ".kne", "application/vnd.kinar" },
-    { ".knp", "application/vnd.kinar" },
-    { ".kon", "application/vnd.kde.kontour" },
-    { ".kpr", "application/vnd.kde.kpresenter" },
-    { ".kpt", "application/vnd.kde.kpresenter" },
-    { ".kpxx", "application/vnd.ds-keypoint" },
-    { ".ksh", "text/x-scriptksh" },
-    { ".ksp", "application/vnd.kde.kspread" },
-    { ".kth", "application/x-iwork-keynote-sffkth" },
-    { ".ktr", "application/vnd.kahootz" },
-    { ".ktx", "image/ktx" },
-    { ".ktx2", "image/ktx2" },
-    { ".ktz", "application/vnd.kahootz" },
-    { ".kwd", "application/vnd.kde.kword" },
-    { ".kwt", "application/vnd.kde.kword" },
-    { ".la", "audio/nspaudio" },
-    { ".lam", "audio/x-liveaudio" },
-    { ".lasxml", "application/vnd.las.las+xml" },
-    { ".latex", "application/x-latex" },
-    { ".lbd", "application/vnd.llamagraphics.life-balance.desktop" },
-    { ".lbe", "application/vnd.llamagraphics.life-balance.exchange+xml" },
-    { ".les", "application/vnd.hhe.lesson-player" },
-    { ".less", "text/less" },
-    { ".lgr", "application/lgr+xml" },
-    { ".lha", "application/x-lzh-compressed" },
-    { ".lhs", "text/x-literate-haskell" },
-    { ".lhx", "application/octet-stream" },
-    { ".library-ms", "application/windows-library+xml" },
-    { ".link66", "application/vnd.route66.link66+xml" },
-    { ".list", "text/plain" },
-    { ".list3820", "application/vnd.ibm.modcap" },
-    { ".listafp", "application/vnd.ibm.modcap" },
-    { ".lit", "application/x-ms-reader" },
-    { ".litcoffee", "text/coffeescript" },
-    { ".lma", "audio/nspaudio" },
-    { ".lnk", "application/x-ms-shortcut" },
-    { ".loadtest", "application/xml" },
-    { ".log", "text/plain" },
-    { ".lostxml", "application/lost+xml" },
-    { ".lpk", "application/octet-stream" },
-    { ".lrf", "application/octet-stream" },
-    { ".lrm", "application/vnd.ms-lrm" },
-    { ".lsf", "video/x-la-asf" },
-    { ".lsp", "text/x-scriptlisp" },
-    { ".lst", "text/plain" },
-    { ".lsx", "video/x-la-asf" },
-    { ".ltf", "application/vnd.frogans.ltf" },
-    { ".ltx", "text/x-tex" },
-    { ".lua", "text/x-lua" },
-    { ".luac", "application/x-lua-bytecode" },
-    { ".lvp", "audio/vnd.lucent.voice" },
-    { ".lwp", "application/vnd.lotus-wordpro" },
-    { ".lzh", "application/octet-stream" },
-    { ".lzx", "application/x-lzx" },
-    { ".m", "text/x-m" },
-    { ".m13", "application/x-msmediaview" },
-    { ".m14", "application/x-msmediaview" },
-    { ".m1v", "video/mpeg" },
-    { ".m21", "application/mp21" },
-    { ".m2a", "audio/mpeg" },
-    { ".m2t", "video/vnd.dlna.mpeg-tts" },
-    { ".m2ts", "video/vnd.dlna.mpeg-tts" },
-    { ".m2v", "video/mpeg" },
-    { ".m3a", "audio/mpeg" },
-    { ".m3u", "audio/x-mpegurl" },
-    { ".m3u8", "audio/x-mpegurl" },
-    { ".m4a", "audio/m4a" },
-    { ".m4b", "audio/m4b" },
-    { ".m4p", "audio/m4p" },
-    { ".m4r", "audio/x-m4r" },
-    { ".m4s", "video/iso.segment" },
-    { ".m4u", "video/vnd.mpegurl" },
-    { ".m4v", "video/x-m4v" },
-    { ".ma", "application/mathematica" },
-    { ".mac", "image/x-macpaint" },
-    { ".mads", "application/mads+xml" },
-    { ".maei", "application/mmt-aei+xml" },
-    { ".mag", "application/vnd.ecowin.chart" },
-    { ".mak", "text/plain" },
-    { ".maker", "application/vnd.framemaker" },
-    { ".man", "application/x-troff-man" },
-    { ".manifest", "application/x-ms-manifest" },
-    { ".map", "text/plain" },
-    { ".mar", "application/octet-stream" },
-    { ".markdown", "text/markdown" },
-    { ".master", "application/xml" },
-    { ".mathml", "application/mathml+xml" },
-    { ".mb", "application/mathematica" },
-    { ".mbd", "application/mbedlet" },
-    { ".mbk", "application/vnd.mobius.mbk" },
-    { ".mbox", "application/mbox" },
-    { ".mc$", "application/x-magic-cap-package-10" },
-    { ".mc1", "application/vnd.medcalcdata" },
-    { ".mcd", "application/vnd.mcd" },
-    { ".mcf", "text/mcf" },
-    { ".mcp", "application/netmc" },
-    { ".mcurl", "text/vnd.curl.mcurl" },
-    { ".md", "text/markdown" },
-    { ".mda", "application/msaccess" },
-    { ".mdb", "application/x-msaccess" },
-    { ".mde", "application/msaccess" },
-    { ".mdi", "image/vnd.ms-modi" },
-    { ".mdp", "application/octet-stream" },
-    { ".mdx", "text/mdx" },
-    { ".me", "application/x-troff-me" },
-    { ".mesh", "model/mesh" },
-    { ".meta4", "application/metalink4+xml" },
-    { ".metalink", "application/metalink+xml" },
-    { ".mets", "application/mets+xml" },
-    { ".mfm", "application/vnd.mfmp" },
-    { ".mfp", "application/x-shockwave-flash" },
-    { ".mft", "application/rpki-manifest" },
-    { ".mgp", "application/vnd.osgeo.mapguide.package" },
-    { ".mgz", "application/vnd.proteus.magazine" },
-    { ".mht", "message/rfc822" },
-    { ".mhtml", "message/rfc822" },
-    { ".mid", "audio/mid" },
-    { ".midi", "audio/mid" },
-    { ".mie", "application/x-mie" },
-    { ".mif", "application/vnd.mif" },
-    { ".mime", "message/rfc822" },
-    { ".mix", "application/octet-stream" },
-    { ".mj2", "video/mj2" },
-    { ".mjf", "audio/x-vndaudioexplosionmjuicemediafile" },
-    { ".mjp2", "video/mj2" },
-    { ".mjpg", "video/x-motion-jpeg" },
-    { ".mjs", "text/javascript" },
-    { ".mk", "text/plain" },
-    { ".mk3d", "video/x-matroska-3d" },
-    { ".mka", "audio/x-matroska" },
-    { ".mkd", "text/x-markdown" },
-    { ".mks", "video/x-matroska" },
-    { ".mkv", "video/x-matroska" },
-    { ".mlp", "application/vnd.dolby.mlp" },
-    { ".mm", "application/x-freemind" },
-    { ".mmd", "application/vnd.chipnuts.karaoke-mmd" },
-    { ".mme", "application/base64" },
-    { ".mmf", "application/x-smaf" },
-    { ".mml", "text/mathml" },
-    { ".mmr", "image/vnd.fujixerox.edmics-mmr" },
-    { ".mng", "video/x-mng" },
-    { ".mno", "text/xml" },
-    { ".mny", "application/x-msmoney" },
-    { ".mobi", "application/x-mobipocket-ebook" },
-    { ".moc", "text/x-moc" },
-    { ".mod", "video/mpeg" },
-    { ".mods", "application/mods+xml" },
-    { ".moov", "video/quicktime" },
-    { ".mov", "video/quicktime" },
-    { ".movie", "video/x-sgi-movie" },
-    { ".mp2", "video/mpeg" },
-    { ".mp21", "application/mp21" },
-    { ".mp2a", "audio/mpeg" },
-    { ".mp2v", "video/mpeg" },
-    { ".mp3", "audio/mpeg" },
-    { ".mp4", "video/mp4" },
-    { ".mp4a", "audio/mp4" },
-    { ".mp4s", "application/mp4" },
-    { ".mp4v", "video/mp4" },
-    { ".mpa", "video/mpeg" },
-    { ".mpc", "application/vnd.mophun.certificate" },
-    { ".mpd", "application/dash+xml" },
-    { ".mpe", "video/mpeg" },
-    { ".mpeg", "video/mpeg" },
-    { ".mpega", "audio/mpeg" },
-    { ".mpf", "application/vnd.ms-mediapackage" },
-    { ".mpg", "video/mpeg" },
-    { ".mpg4", "video/mp4" },
-    { ".mpga", "audio/mpeg" },
-    { ".mpkg", "application/vnd.apple.installer+xml" },
-    { ".mpm", "application/vnd.blueice.multipass" },
-    { ".mpn", "application/vnd.mophun.application" },
-    { ".mpp", "application/vnd.ms-project" },
-    { ".mpt", "application/vnd.ms-project" },
-    { ".mpv", "application/x-project" },
-    { ".mpv2", "video/mpeg" },
-    { ".mpx", "application/x-project" },
-    { ".mpy", "application/vnd.ibm.minipay" },
-    { ".mqv", "video/quicktime" },
-    { ".mqy", "application/vnd.mobius.mqy" },
-    { ".mrc", "application/marc" },
-    { ".mrcx", "application/marcxml+xml" },
-    { ".mrw", "image/x-minolta-mrw" },
-    { ".ms", "application/x-troff-ms" },
-    { ".mscml", "application/mediaservercontrol+xml" },
-    { ".mseed", "application/vnd.fdsn.mseed" },
-    { ".mseq", "application/vnd.mseq" },
-    { ".msf", "application/vnd.epson.msf" },
-    { ".msg", "application/vnd.ms-outlook" },
-    { ".msh", "model/mesh" },
-    { ".msi", "application/octet-stream" },
-    { ".msix", "application/msix" },
-    { ".msixbundle", "application/msixbundle" },
-    { ".msl", "application/vnd.mobius.msl" },
-    { ".msm", "application/octet-stream" },
-    { ".mso", "application/octet-stream" },
-    { ".msp", "application/octet-stream" },
-    { ".msty", "application/vnd.muvee.style" },
-    { ".mtl", "model/mtl" },
-    { ".mts", "video/vnd.dlna.mpeg-tts" },
-    { ".mtx", "application/xml" },
-    { ".mus", "application/vnd.musician" },
-    { ".musd", "application/mmt-usd+xml" },
-    { ".musicxml", "application/vnd.recordare.musicxml+xml" },
-    { ".mustache", "text/html" },
-    { ".mv", "video/x-sgi-movie" },
-    { ".mvb", "application/x-msmediaview" },
-    { ".mvc", "application/x-miva-compiled" },
-    { ".mvt", "application/vnd.mapbox-vector-tile" },
-    { ".mwf", "application/vnd.mfer" },
-    { ".mxf", "application/mxf" },
-    { ".mxl", "application/vnd.recordare.musicxml" },
-    { ".mxmf", "audio/mobile-xmf" },
-    { ".mxml", "application/xv+xml" },
-    { ".mxp", "application/x-mmxp" },
-    { ".mxs", "application/vnd.triscape.mxs" },
-    { ".mxu", "video/vnd.mpegurl" },
-    { ".my", "audio/make" },
-    { ".mzz", "application/x-vndaudioexplosionmzz" },
-    { ".n-gage", "application/vnd.nokia.n-gage.symbian.install" },
-    { ".n3", "text/n3" },
-    { ".nap", "image/naplps" },
-    { ".naplps", "image/naplps" },
-    { ".nb", "application/mathematica" },
-    { ".nbp", "application/vnd.wolfram.player" },
-    { ".nc", "application/x-netcdf" },
-    { ".ncm", "application/vndnokiaconfiguration-message" },
-    { ".ncx", "application/x-dtbncx+xml" },
-    { ".nef", "image/x-nikon-nef" },
-    { ".nfo", "text/x-nfo" },
-    { ".ngdat", "application/vnd.nokia.n-gage.data" },
-    { ".nif", "image/x-niff" },
-    { ".niff", "image/x-niff" },
-    { ".nitf", "application/vnd.nitf" },
-    { ".nix", "application/x-mix-transfer" },
-    { ".nlu", "application/vnd.neurolanguage.nlu" },
-    { ".nmbtemplate", "application/x-iwork-numbers-sfftemplate" },
-    { ".nml", "application/vnd.enliven" },
-    { ".nnd", "application/vnd.noblenet-directory" },
-    { ".nns", "application/vnd.noblenet-sealer" },
-    { ".nnw", "application/vnd.noblenet-web" },
-    { ".npx", "image/vnd.net-fpx" },
-    { ".nq", "application/n-quads" },
-    { ".nrw", "image/x-nikon-nrw" },
-    { ".nsc", "video/x-ms-asf" },
-    { ".nsf", "application/vnd.lotus-notes" },
-    { ".nt", "application/n-triples" },
-    { ".ntf", "application/vnd.nitf" },
-    { ".numbers", "application/vnd.apple.numbers" },
-    { ".nvd", "application/x-navidoc" },
-    { ".nwc", "application/x-nwc" },
-    { ".nws", "message/rfc822" },
-    { ".nzb", "application/x-nzb" },
-    { ".o", "application/x-object" },
-    { ".oa2", "application/vnd.fujitsu.oasys2" },
-    { ".oa3", "application/vnd.fujitsu.oasys3" },
-    { ".oas", "application/vnd.fujitsu.oasys" },
-    { ".obd", "application/x-msbinder" },
-    { ".obgx", "application/vnd.openblox.game+xml" },
-    { ".obj", "application/x-tgif" },
-    { ".ocx", "application/octet-stream" },
-    { ".oda", "application/oda" },
-    { ".odb", "application/vnd.oasis.opendocument.database" },
-    { ".odc", "application/vnd.oasis.opendocument.chart" },
-    { ".odf", "application/vnd.oasis.opendocument.formula" },
-    { ".odft", "application/vnd.oasis.opendocument.formula-template" },
-    { ".odg", "application/vnd.oasis.opendocument.graphics" },
-    { ".odh", "text/plain" },
-    { ".odi", "application/vnd.oasis.opendocument.image" },
-    { ".odl", "text/plain" },
-    { ".odm", "application/vnd.oasis.opendocument.text-master" },
-    { ".odp", "application/vnd.oasis.opendocument.presentation" },
-    { ".ods", "application/vnd.oasis.opendocument.spreadsheet" },
-    { ".odt", "application/vnd.oasis.opendocument.text" },
-    { ".oex", "application/x-opera-extension" },
-    { ".oga", "audio/ogg" },
-    { ".ogex", "model/vnd.opengex" },
-    { ".ogg", "audio/ogg" },
-    { ".ogv", "video/ogg" },
-    { ".ogx", "application/ogg" },
-    { ".omc", "application/x-omc" },
-    { ".omcd", "application/x-omcdatamaker" },
-    { ".omcr", "application/x-omcregerator" },
-    { ".omdoc", "application/omdoc+xml" },
-    { ".one", "application/onenote" },
-    { ".onea", "application/onenote" },
-    { ".onepkg", "application/onenote" },
-    { ".onetmp", "application/onenote" },
-    { ".onetoc", "application/onenote" },
-    { ".onetoc2", "application/onenote" },
-    { ".opf", "application/oebps-package+xml" },
-    { ".opml", "text/x-opml" },
-    { ".oprc", "application/vnd.palm" },
-    { ".opus", "audio/ogg" },
-    { ".orderedtest", "application/xml" },
-    { ".orf", "image/x-olympus-orf" },
-    { ".org", "application/vnd.lotus-organizer" },
-    { ".osdx", "application/opensearchdescription+xml" },
-    { ".osf", "application/vnd.yamaha.openscoreformat" },
-    { ".osfpvg", "application/vnd.yamaha.openscoreformat.osfpvg+xml" },
-    { ".osm", "application/vnd.openstreetmap.data+xml" },
-    { ".otc", "application/vnd.oasis.opendocument.chart-template" },
-    { ".otf", "application/font-sfnt" },
-    { ".otg", "application/vnd.oasis.opendocument.graphics-template" },
-    { ".oth", "application/vnd.oasis.opendocument.text-web" },
-    { ".oti", "application/vnd.oasis.opendocument.image-template" },
-    { ".otm", "application/vnd.oasis.opendocument.text-master" },
-    { ".otp", "application/vnd.oasis.opendocument.presentation-template" },
-    { ".ots", "application/vnd.oasis.opendocument.spreadsheet-template" },
-    { ".ott", "application/vnd.oasis.opendocument.text-template" },
-    { ".ova", "application/x-virtualbox-ova" },
-    { ".ovf", "application/x-virtualbox-ovf" },
-    { ".owl", "application/rdf+xml" },
-    { ".oxps", "application/oxps" },
-    { ".oxt", "application/vnd.openofficeorg.extension" },
-    { ".oza", "application/x-oz-application" },
-    { ".p", "text/x-pascal" },
-    { ".p10", "application/pkcs10" },
-    { ".p12", "application/x-pkcs12" },
-    { ".p7a", "application/x-pkcs7-signature" },
-    { ".p7b", "application/x-pkcs7-certificates" },
-    { ".p7c", "application/pkcs7-mime" },
-    { ".p7m", "application/pkcs7-mime" },
-    { ".p7r", "application/x-pkcs7-certreqresp" },
-    { ".p7s", "application/pkcs7-signature" },
-    { ".p8", "application/pkcs8" },
-    { ".pac", "application/x-ns-proxy-autoconfig" },
-    { ".pages", "application/vnd.apple.pages" },
-    { ".parquet", "application/vnd.apache.parquet" },
-    { ".part", "application/pro_eng" },
-    { ".pas", "text/x-pascal" },
-    { ".pat", "image/x-coreldrawpattern" },
-    { ".paw", "application/vnd.pawaafile" },
-    { ".pbd", "application/vnd.powerbuilder6" },
-    { ".pbm", "image/x-portable-bitmap" },
-    { ".pcap", "application/vnd.tcpdump.pcap" },
-    { ".pcast", "application/x-podcast" },
-    { ".pcf", "application/x-font-pcf" },
-    { ".pcf.Z", "application/x-font" },
-    { ".pcl", "application/vnd.hp-pcl" },
-    { ".pclxl", "application/vnd.hp-pclxl" },
-    { ".pct", "image/pict" },
-    { ".pcurl", "application/vnd.curl.pcurl" },
-    { ".pcx", "application/octet-stream" },
-    { ".pcz", "application/octet-stream" },
-    { ".pdb", "application/vnd.palm" },
-    { ".pde", "text/x-processing" },
-    { ".pdf", "application/pdf" },
-    { ".pef", "image/x-pentax-pef" },
-    { ".pem", "application/x-x509-ca-cert" },
-    { ".pfa", "application/x-font-type1" },
-    { ".pfb", "application/octet-stream" },
-    { ".pfm", "application/octet-stream" },
-    { ".pfr", "application/font-tdpfr" },
-    { ".pfunk", "audio/make" },
-    { ".pfx", "application/x-pkcs12" },
-    { ".pgm", "image/x-portable-graymap" },
-    { ".pgn", "application/x-chess-pgn" },
-    { ".pgp", "application/pgp-encrypted" },
-    { ".php", "application/x-httpd-php" },
-    { ".phps", "text/text" },
-    { ".pic", "image/pict" },
-    { ".pict", "image/pict" },
-    { ".pkg", "application/octet-stream" },
-    { ".pkgdef", "text/plain" },
-    { ".pkgundef", "text/plain" },
-    { ".pki", "application/pkixcmp" },
-    { ".pkipath", "application/pkix-pkipath" },
-    { ".pko", "application/vnd.ms-pki.pko" },
-    { ".pkpass", "application/vnd.apple.pkpass" },
-    { ".pl", "application/x-perl" },
-    { ".plb", "application/vnd.3gpp.pic-bw-large" },
-    { ".plc", "application/vnd.mobius.plc" },
-    { ".plf", "application/vnd.pocketlearn" },
-    { ".pls", "audio/scpls" },
-    { ".plx", "application/x-pixclscript" },
-    { ".pm", "application/x-perl" },
-    { ".pm4", "application/x-pagemaker" },
-    { ".pm5", "application/x-pagemaker" },
-    { ".pma", "application/x-perfmon" },
-    { ".pmc", "application/x-perfmon" },
-    { ".pml", "application/x-perfmon" },
-    { ".pmr", "application/x-perfmon" },
-    { ".pmw", "application/x-perfmon" },
-    { ".png", "image/png" },
-    { ".pnm", "image/x-portable-anymap" },
-    { ".pnt", "image/x-macpaint" },
-    { ".pntg", "image/x-macpaint" },
-    { ".pnz", "image/png" },
-    { ".po", "text/plain" },
-    { ".portpkg", "application/vnd.macports.portpkg" },
-    { ".pot", "application/vnd.ms-powerpoint" },
-    { ".potm", "application/vnd.ms-powerpoint.template.macroEnabled.12" },
-    { ".potx", "application/vnd.openxmlformats-officedocument.presentationml.template" },
-    { ".pov", "model/x-pov" },
-    { ".ppa", "application/vnd.ms-powerpoint" },
-    { ".ppam", "application/vnd.ms-powerpoint.addin.macroEnabled.12" },
-    { ".ppd", "application/vnd.cups-ppd" },
-    { ".ppm", "image/x-portable-pixmap" },
-    { ".pps", "application/vnd.ms-powerpoint" },
-    { ".ppsm", "application/vnd.ms-powerpoint.slideshow.macroEnabled.12" },
-    { ".ppsx", "application/vnd.openxmlformats-officedocument.presentationml.slideshow" },
-    { ".ppt", "application/vnd.ms-powerpoint" },
-    { ".pptm", "application/vnd.ms-powerpoint.presentation.macroEnabled.12" },
-    { ".pptx", "application/vnd.openxmlformats-officedocument.presentationml.presentation" },
-    { ".ppz", "application/mspowerpoint" },
-    { ".pqa", "application/vnd.palm" },
-    { ".prc", "application/x-mobipocket-ebook" },
-    { ".pre", "application/vnd.lotus-freelance" },
-    { ".prf", "application/pics-rules" },
-    { ".prm", "application/octet-stream" },
-    { ".provx", "application/provenance+xml" },
-    { ".prt", "application/pro_eng" },
-    { ".prx", "application/octet-stream" },
-    { ".ps", "application/postscript" },
-    { ".psb", "application/vnd.3gpp.pic-bw-small" },
-    { ".psc1", "application/PowerShell" },
-    { ".psd", "application/octet-stream" },
-    { ".psess", "application/xml" },
-    { ".psf", "application/x-font-linux-psf" },
-    { ".pskcxml", "application/pskc+xml" },
-    { ".psm", "application/octet-stream" },
-    { ".psp", "application/octet-stream" },
-    { ".pst", "application/vnd.ms-outlook" },
-    { ".pti", "image/prs.pti" },
-    { ".ptid", "application/vnd.pvi.ptid1" },
-    { ".pub", "application/x-mspublisher" },
-    { ".pvb", "application/vnd.3gpp.pic-bw-var" },
-    { ".pvu", "paleovu/x-pv" },
-    { ".pwn", "application/vnd.3m.post-it-notes" },
-    { ".pwz", "application/vnd.ms-powerpoint" },
-    { ".py", "text/plain" },
-    { ".pya", "audio/vnd.ms-playready.media.pya" },
-    { ".pyc", "applicaiton/x-bytecodepython" },
-    { ".pyo", "model/vnd.pytha.pyox" },
-    { ".pyox", "model/vnd.pytha.pyox" },
-    { ".pyv", "video/vnd.ms-playready.media.pyv" },
-    { ".qam", "application/vnd.epson.quickanime" },
-    { ".qbo", "application/vnd.intu.qbo" },
-    { ".qcp", "audio/vndqcelp" },
-    { ".qd3", "x-world/x-3dmf" },
-    { ".qd3d", "x-world/x-3dmf" },
-    { ".qfx", "application/vnd.intu.qfx" },
-    { ".qht", "text/x-html-insertion" },
-    { ".qhtm", "text/x-html-insertion" },
-    { ".qif", "image/x-quicktime" },
-    { ".qps", "application/vnd.publishare-delta-tree" },
-    { ".qt", "video/quicktime" },
-    { ".qtc", "video/x-qtc" },
-    { ".qti", "image/x-quicktime" },
-    { ".qtif", "image/x-quicktime" },
-    { ".qtl", "application/x-quicktimeplayer" },
-    { ".qwd", "application/vnd.quark.quarkxpress" },
-    { ".qwt", "application/vnd.quark.quarkxpress" },
-    { ".qxb", "application/vnd.quark.quarkxpress" },
-    { ".qxd", "application/octet-stream" },
-    { ".qxl", "application/vnd.quark.quarkxpress" },
-    { ".qxt", "application/vnd.quark.quarkxpress" },
-    { ".ra", "audio/x-pn-realaudio" },
-    { ".raf", "image/x-fuji-raf" },
-    { ".ram", "audio/x-pn-realaudio" },
-    { ".raml", "application/raml+yaml" },
-    { ".rapd", "application/route-apd+xml" },
-    { ".rar", "application/x-rar-compressed" },
-    { ".ras", "image/x-cmu-raster" },
-    { ".rast", "image/cmu-raster" },
-    { ".rat", "application/rat-file" },
-    { ".raw", "image/x-panasonic-rw" },
-    { ".rc", "text/plain" },
-    { ".rc2", "text/plain" },
-    { ".rcprofile", "application/vnd.ipunplugged.rcprofile" },
-    { ".rct", "text/plain" },
-    { ".rdf", "application/rdf+xml" },
-    { ".rdlc", "application/xml" },
-    { ".rdp", "application/rdp" },
-    { ".rdz", "application/vnd.data-vision.rdz" },
-    { ".reg", "text/plain" },
-    { ".relo", "application/p2p-overlay+xml" },
-    { ".rep", "application/vnd.businessobjects" },
-    { ".res", "application/x-dtbresource+xml" },
-    { ".resx", "application/xml" },
-    { ".rexx", "text/x-scriptrexx" },
-    { ".rf", "image/vnd.rn-realflash" },
-    { ".rgb", "image/x-rgb" },
-    { ".rgs", "text/plain" },
-    { ".rif", "application/reginfo+xml" },
-    { ".rip", "audio/vnd.rip" },
-    { ".ris", "application/x-research-info-systems" },
-    { ".rl", "application/resource-lists+xml" },
-    { ".rlc", "image/vnd.fujixerox.edmics-rlc" },
-    { ".rld", "application/resource-lists-diff+xml" },
-    { ".rm", "application/vnd.rn-realmedia" },
-    { ".rmi", "audio/mid" },
-    { ".rmm", "audio/x-pn-realaudio" },
-    { ".rmp", "application/vnd.rn-rn_music_package" },
-    { ".rms", "application/vnd.jcp.javame.midlet-rms" },
-    { ".rmvb", "application/vnd.rn-realmedia-vbr" },
-    { ".rnc", "application/relax-ng-compact-syntax" },
-    { ".rng", "application/xml" },
-    { ".rnx", "application/vndrn-realplayer" },
-    { ".roa", "application/rpki-roa" },
-    { ".roff", "application/x-troff" },
-    { ".rp", "image/vndrn-realpix" },
-    { ".rp9", "application/vnd.cloanto.rp9" },
-    { ".rpm", "audio/x-pn-realaudio-plugin" },
-    { ".rpss", "application/vnd.nokia.radio-presets" },
-    { ".rpst", "application/vnd.nokia.radio-preset" },
-    { ".rq", "application/sparql-query" },
-    { ".rqy", "text/x-ms-rqy" },
-    { ".rs", "application/rls-services+xml" },
-    { ".rsat", "application/atsc-rsat+xml" },
-    { ".rsd", "application/rsd+xml" },
-    { ".rsheet", "application/urc-ressheet+xml" },
-    { ".rss", "application/rss+xml" },
-    { ".rt", "text/vndrn-realtext" },
-    { ".rtf", "application/rtf" },
-    { ".rtx", "text/richtext" },
-    { ".ruleset", "application/xml" },
-    { ".run", "application/x-makeself" },
-    { ".rusd", "application/route-usd+xml" },
-    { ".rv", "video/vndrn-realvideo" },
-    { ".rvt", "application/octet-stream" },
-    { ".rw2", "image/x-panasonic-rw2" },
-    { ".rwl", "image/x-panasonic-rw2" },
-    { ".s", "text/plain" },
-    { ".s3m", "audio/s3m" },
-    { ".s7z", "application/x-7z-compressed" },
-    { ".saf", "application/vnd.yamaha.smaf-audio" },
-    { ".safariextz", "application/x-safari-safariextz" },
-    { ".sass", "text/x-sass" },
-    { ".saveme", "application/octet-stream" },
-    { ".sbk", "application/x-tbook" },
-    { ".sbml", "application/sbml+xml" },
-    { ".sc", "application/vnd.ibm.secure-container" },
-    { ".scd", "application/x-msschedule" },
-    { ".scm", "application/vnd.lotus-screencam" },
-    { ".scq", "application/scvp-cv-request" },
-    { ".scr", "text/plain" },
-    { ".scs", "application/scvp-cv-response" },
-    { ".scss", "text/x-scss" },
-    { ".sct", "text/scriptlet" },
-    { ".scurl", "text/vnd.curl.scurl" },
-    { ".sd2", "audio/x-sd2" },
-    { ".sda", "application/vnd.stardivision.draw" },
-    { ".sdc", "application/vnd.stardivision.calc" },
-    { ".sdd", "application/vnd.stardivision.impress" },
-    { ".sdkd", "application/vnd.solent.sdkm+xml" },
-    { ".sdkm", "application/vnd.solent.sdkm+xml" },
-    { ".sdml", "text/plain" },
-    { ".sdoc", "application/sdoc" },
-    { ".sdp", "application/sdp" },
-    { ".sdr", "application/sounder" },
-    { ".sdw", "application/vnd.stardivision.writer" },
-    { ".sea", "application/octet-stream" },
-    { ".searchConnector-ms", "application/windows-search-connector+xml" },
-    { ".see", "application/vnd.seemail" },
-    { ".seed", "application/vnd.fdsn.seed" },
-    { ".sema", "application/vnd.sema" },
-    { ".semd", "application/vnd.semd" },
-    { ".semf", "application/vnd.semf" },
-    { ".senmlx", "application/senml+xml" },
-    { ".sensmlx", "application/sensml+xml" },
-    { ".ser", "application/java-serialized-object" },
-    { ".set", "application/set" },
-    { ".setpay", "application/set-payment-initiation" },
-    { ".setreg", "application/set-registration-initiation" },
-    { ".settings", "application/xml" },
-    { ".sfd-hdstx", "application/vnd.hydrostatix.sof-data" },
-    { ".sfs", "application/vnd.spotfire.sfs" },
-    { ".sfv", "text/x-sfv" },
-    { ".sgf", "application/x-go-sgf" },
-    { ".sgi", "image/sgi" },
-    { ".sgimb", "application/x-sgimb" },
-    { ".sgl", "application/vnd.stardivision.writer-global" },
-    { ".sgm", "text/sgml" },
-    { ".sgml", "text/sgml" },
-    { ".sh", "application/x-sh" },
-    { ".shar", "application/x-shar" },
-    { ".shex", "text/shex" },
-    { ".shf", "application/shf+xml" },
-    { ".shtml", "text/html" },
-    { ".sid", "image/x-mrsid-image" },
-    { ".sieve", "application/sieve" },
-    { ".sig", "application/pgp-signature" },
-    { ".sil", "audio/silk" },
-    { ".silo", "model/mesh" },
-    { ".sis", "application/vnd.symbian.install" },
-    { ".sisx", "application/vnd.symbian.install" },
-    { ".sit", "application/x-stuffit" },
-    { ".sitemap", "application/xml" },
-    { ".sitx", "application/x-stuffitx" },
-    { ".siv", "application/sieve" },
-    { ".skd", "application/vnd.koan" },
-    { ".skin", "application/xml" },
-    { ".skm", "application/vnd.koan" },
-    { ".skp", "application/x-koan" },
-    { ".skt", "application/vnd.koan" },
-    { ".sl", "application/x-seelogo" },
-    { ".sldm", "application/vnd.ms-powerpoint.slide.macroEnabled.12" },
-    { ".sldx", "application/vnd.openxmlformats-officedocument.presentationml.slide" },
-    { ".slim", "text/slim" },
-    { ".slk", "application/vnd.ms-excel" },
-    { ".slm", "text/slim" },
-    { ".sln", "text/plain" },
-    { ".sls", "application/route-s-tsid+xml" },
-    { ".slt", "application/vnd.epson.salt" },
-    { ".slupkg-ms", "application/x-ms-license" },
-    { ".sm", "application/vnd.stepmania.stepchart" },
-    { ".smd", "audio/x-smd" },
-    { ".smf", "application/vnd.stardivision.math" },
-    { ".smi", "application/octet-stream" },
-    { ".smil", "application/smil+xml" },
-    { ".smv", "video/x-smv" },
-    { ".smx", "audio/x-smd" },
-    { ".smz", "audio/x-smd" },
-    { ".smzip", "application/vnd.stepmania.package" },
-    { ".snd", "audio/basic" },
-    { ".snf", "application/x-font-snf" },
-    { ".snippet", "application/xml" },
-    { ".snp", "application/octet-stream" },
-    { ".so", "application/octet-stream" },
-    { ".sol", "text/plain" },
-    { ".sor", "text/plain" },
-    { ".spc", "application/x-pkcs7-certificates" },
-    { ".spdx", "text/spdx" },
-    { ".spf", "application/vnd.yamaha.smaf-phrase" },
-    { ".spl", "application/futuresplash" },
-    { ".spot", "text/vnd.in3d.spot" },
-    { ".spp", "application/scvp-vp-response" },
-    { ".spq", "application/scvp-vp-request" },
-    { ".spr", "application/x-sprite" },
-    { ".sprite", "application/x-sprite" },
-    { ".spx", "audio/ogg" },
-    { ".sql", "application/sql" },
-    { ".sr2", "image/x-sony-sr2" },
-    { ".src", "application/x-wais-source" },
-    { ".srf", "text/plain" },
-    { ".srt", "application/x-subrip" },
-    { ".sru", "application/sru+xml" },
-    { ".srx", "application/sparql-results+xml" },
-    { ".ssdl", "application/ssdl+xml" },
-    { ".sse", "application/vnd.kodak-descriptor" },
-    { ".ssf", "application/vnd.epson.ssf" },
-    { ".ssi", "text/x-server-parsed-html" },
-    { ".SSISDeploymentManifest", "text/xml" },
-    { ".ssm", "application/streamingmedia" },
-    { ".ssml", "application/ssml+xml" },
-    { ".sst", "application/vnd.ms-pki.certstore" },
-    { ".st", "application/vnd.sailingtracker.track" },
-    { ".stc", "application/vnd.sun.xml.calc.template" },
-    { ".std", "application/vnd.sun.xml.draw.template" },
-    { ".step", "application/step" },
-    { ".stf", "application/vnd.wt.stf" },
-    { ".sti", "application/vnd.sun.xml.impress.template" },
-    { ".stk", "application/hyperstudio" },
-    { ".stl", "application/vnd.ms-pki.stl" },
-    { ".stp", "application/step" },
-    { ".stpx", "model/step+xml" },
-    { ".stpxz", "model/step-xml+zip" },
-    { ".stpz", "model/step+zip" },
-    { ".str", "application/vnd.pg.format" },
-    { ".stw", "application/vnd.sun.xml.writer.template" },
-    { ".sty", "text/x-tex" },
-    { ".styl", "text/stylus" },
-    { ".stylus", "text/stylus" },
-    { ".sub", "text/vnd.dvb.subtitle" },
-    { ".sus", "application/vnd.sus-calendar" },
-    { ".susp", "application/vnd.sus-calendar" },
-    { ".sv4cpio", "application/x-sv4cpio" },
-    { ".sv4crc", "application/x-sv4crc" },
-    { ".svc", "application/xml" },
-    { ".svd", "application/vnd.svd" },
-    { ".svf", "image/vnddwg" },
-    { ".svg", "image/svg+xml" },
-    { ".svgz", "image/svg+xml" },
-    { ".svr", "application/x-world" },
-    { ".swa", "application/x-director" },
-    { ".swf", "application/x-shockwave-flash" },
-    { ".swi", "application/vnd.arastra.swi" },
-    { ".swidtag", "application/swid+xml" },
-    { ".sxc", "application/vnd.sun.xml.calc" },
-    { ".sxd", "application/vnd.sun.xml.draw" },
-    { ".sxg", "application/vnd.sun.xml.writer.global" },
-    { ".sxi", "application/vnd.sun.xml.impress" },
-    { ".sxm", "application/vnd.sun.xml.math" },
-    { ".sxw", "application/vnd.sun.xml.writer" },
-    { ".t", "application/x-troff" },
-    { ".t3", "application/x-t3vm-image" },
-    { ".t38", "image/t38" },
-    { ".taglet", "application/vnd.mynfc" },
-    { ".talk", "text/x-speech" },
-    { ".tao", "application/vnd.tao.intent-module-archive" },
-    { ".tap", "image/vnd.tencent.tap" },
-    { ".tar", "application/x-tar" },
-    { ".tar.gz", "application/gzip" },
-    { ".taz", "application/x-gtar" },
-    { ".tbk", "application/toolbook" },
-    { ".tcap", "application/vnd.3gpp2.tcap" },
-    { ".tcl", "application/x-tcl" },
-    { ".tcsh", "text/x-scripttcsh" },
-    { ".td", "application/urc-targetdesc+xml" },
-    { ".teacher", "application/vnd.smart.teacher" },
-    { ".tei", "application/tei+xml" },
-    { ".teicorpus", "application/tei+xml" },
-    { ".template", "application/x-iwork-pages-sfftemplate" },
-    { ".testrunconfig", "application/xml" },
-    { ".testsettings", "application/xml" },
-    { ".tex", "application/x-tex" },
-    { ".texi", "application/x-texinfo" },
-    { ".texinfo", "application/x-texinfo" },
-    { ".text", "text/plain" },
-    { ".tfi", "application/thraud+xml" },
-    { ".tfm", "application/x-tex-tfm" },
-    { ".tfx", "image/tiff-fx" },
-    { ".tga", "image/x-tga" },
-    { ".tgz", "application/x-compressed" },
-    { ".thmx", "application/vnd.ms-officetheme" },
-    { ".thn", "application/octet-stream" },
-    { ".tif", "image/tiff" },
-    { ".tiff", "image/tiff" },
-    { ".tk", "application/x-tcl" },
-    { ".tlh", "text/plain" },
-    { ".tli", "text/plain" },
-    { ".tmo", "application/vnd.tmobile-livetv" },
-    { ".toc", "application/octet-stream" },
-    { ".toml", "application/toml" },
-    { ".torrent", "application/x-bittorrent" },
-    { ".tpl", "application/vnd.groove-tool-template" },
-    { ".tpt", "application/vnd.trid.tpt" },
-    { ".tr", "application/x-troff" },
-    { ".tra", "application/vnd.trueapp" },
-    { ".trig", "application/trig" },
-    { ".trm", "application/x-msterminal" },
-    { ".trx", "application/xml" },
-    { ".ts", "text/typescript" },
-    { ".tsd", "application/timestamped-data" },
-    { ".tsi", "audio/tsp-audio" },
-    { ".tsp", "application/dsptype" },
-    { ".tsv", "text/tab-separated-values" },
-    { ".tsx", "application/typescript" },
-    { ".ttc", "application/x-font-ttf" },
-    { ".ttf", "application/font-sfnt" },
-    { ".ttl", "text/turtle" },
-    { ".ttml", "application/ttml+xml" },
-    { ".tts", "video/vnd.dlna.mpeg-tts" },
-    { ".turbot", "image/florian" },
-    { ".twd", "application/vnd.simtech-mindmapper" },
-    { ".twds", "application/vnd.simtech-mindmapper" },
-    { ".txd", "application/vnd.genomatix.tuxedo" },
-    { ".txf", "application/vnd.mobius.txf" },
-    { ".txt", "text/plain" },
-    { ".u32", "application/octet-stream" },
-    { ".u3d", "model/u3d" },
-    { ".u8dsn", "message/global-delivery-status" },
-    { ".u8hdr", "message/global-headers" },
-    { ".u8mdn", "message/global-disposition-notification" },
-    { ".u8msg", "message/global" },
-    { ".ubj", "application/ubjson" },
-    { ".udeb", "application/x-debian-package" },
-    { ".ufd", "application/vnd.ufdl" },
-    { ".ufdl", "application/vnd.ufdl" },
-    { ".uil", "text/x-uil" },
-    { ".uls", "text/iuls" },
-    { ".ulx", "application/x-glulx" },
-    { ".umj", "application/vnd.umajin" },
-    { ".uni", "text/uri-list" },
-    { ".unis", "text/uri-list" },
-    { ".unityweb", "application/vnd.unity" },
-    { ".unv", "application/i-deas" },
-    { ".uo", "application/vnd.uoml+xml" },
-    { ".uoml", "application/vnd.uoml+xml" },
-    { ".uri", "text/uri-list" },
-    { ".uris", "text/uri-list" },
-    { ".urls", "text/uri-list" },
-    { ".usda", "model/vnd.usda" },
-    { ".usdz", "model/vnd.usdz+zip" },
-    { ".user", "text/plain" },
-    { ".ustar", "application/x-ustar" },
-    { ".utz", "application/vnd.uiq.theme" },
-    { ".uu", "text/x-uuencode" },
-    { ".uue", "text/x-uuencode" },
-    { ".uva", "audio/vnd.dece.audio" },
-    { ".uvd", "application/vnd.dece.data" },
-    { ".uvf", "application/vnd.dece.data" },
-    { ".uvg", "image/vnd.dece.graphic" },
-    { ".uvh", "video/vnd.dece.hd" },
-    { ".uvi", "image/vnd.dece.graphic" },
-    { ".uvm", "video/vnd.dece.mobile" },
-    { ".uvp", "video/vnd.dece.pd" },
-    { ".uvs", "video/vnd.dece.sd" },
-    { ".uvt", "application/vnd.dece.ttml+xml" },
-    { ".uvu", "video/vnd.uvvu.mp4" },
-    { ".uvv", "video/vnd.dece.video" },
-    { ".uvva", "audio/vnd.dece.audio" },
-    { ".uvvd", "application/vnd.dece.data" },
-    { ".uvvf", "application/vnd.dece.data" },
-    { ".uvvg", "image/vnd.dece.graphic" },
-    { ".uvvh", "video/vnd.dece.hd" },
-    { ".uvvi", "image/vnd.dece.graphic" },
-    { ".uvvm", "video/vnd.dece.mobile" },
-    { ".uvvp", "video/vnd.dece.pd" },
-    { ".uvvs", "video/vnd.dece.sd" },
-    { ".uvvt", "application/vnd.dece.ttml+xml" },
-    { ".uvvu", "video/vnd.uvvu.mp4" },
-    { ".uvvv", "video/vnd.dece.video" },
-    { ".uvvx", "application/vnd.dece.unspecified" },
-    { ".uvvz", "application/vnd.dece.zip" },
-    { ".uvx", "application/vnd.dece.unspecified" },
-    { ".uvz", "application/vnd.dece.zip" },
-    { ".vb", "text/plain" },
-    { ".vbdproj", "text/plain" },
-    { ".vbk", "video/mpeg" },
-    { ".vbox", "application/x-virtualbox-vbox" },
-    { ".vbox-extpack", "application/x-virtualbox-vbox-extpack" },
-    { ".vbproj", "text/plain" },
-    { ".vbs", "text/vbscript" },
-    { ".vcard", "text/vcard" },
-    { ".vcd", "application/x-cdlink" },
-    { ".vcf", "text/x-vcard" },
-    { ".vcg", "application/vnd.groove-vcard" },
-    { ".vcproj", "application/xml" },
-    { ".vcs", "text/plain" },
-    { ".vcx", "application/vnd.vcx" },
-    { ".vcxproj", "application/xml" },
-    { ".vda", "application/vda" },
-    { ".vddproj", "text/plain" },
-    { ".vdi", "application/x-virtualbox-vdi" },
-    { ".vdo", "video/vdo" },
-    { ".vdp", "text/plain" },
-    { ".vdproj", "text/plain" },
-    { ".vds", "model/vnd.sap.vds" },
-    { ".vdx", "application/vnd.ms-visio.viewer" },
-    { ".vew", "application/groupwise" },
-    { ".vhd", "application/x-virtualbox-vhd" },
-    { ".vis", "application/vnd.visionary" },
-    { ".viv", "video/vnd.vivo" },
-    { ".vivo", "video/vivo" },
-    { ".vmd", "application/vocaltec-media-desc" },
-    { ".vmdk", "application/x-virtualbox-vmdk" },
-    { ".vmf", "application/vocaltec-media-file" },
-    { ".vml", "text/xml" },
-    { ".vob", "video/x-ms-vob" },
-    { ".voc", "audio/voc" },
-    { ".vor", "application/vnd.stardivision.writer" },
-    { ".vos", "video/vosaic" },
-    { ".vox", "application/x-authorware-bin" },
-    { ".vqe", "audio/x-twinvq-plugin" },
-    { ".vqf", "audio/x-twinvq" },
-    { ".vql", "audio/x-twinvq-plugin" },
-    { ".vrml", "model/vrml" },
-    { ".vrt", "x-world/x-vrt" },
-    { ".vscontent", "application/xml" },
-    { ".vsct", "text/xml" },
-    { ".vsd", "application/vnd.visio" },
-    { ".vsdx", "application/vnd.ms-visio.viewer" },
-    { ".vsf", "application/vnd.vsf" },
-    { ".vsi", "application/ms-vsi" },
-    { ".vsix", "application/vsix" },
-    { ".vsixlangpack", "text/xml" },
-    { ".vsixmanifest", "text/xml" },
-    { ".vsmdi", "application/xml" },
-    { ".vspscc", "text/plain" },
-    { ".vss", "application/vnd.visio" },
-    { ".vsscc", "text/plain" },
-    { ".vssettings", "text/xml" },
-    { ".vssscc", "text/plain" },
-    { ".vst", "application/vnd.visio" },
-    { ".vstemplate", "text/xml" },
-    { ".vsto", "application/x-ms-vsto" },
-    { ".vsw", "application/vnd.visio" },
-    { ".vsx", "application/vnd.visio" },
-    { ".vtf", "image/vnd.valve.source.texture" },
-    { ".vtt", "text/vtt" },
-    { ".vtu", "model/vnd.vtu" },
-    { ".vtx", "application/vnd.visio" },
-    { ".vxml", "application/voicexml+xml" },
-    { ".w3d", "application/x-director" },
-    { ".w60", "application/wordperfect60" },
-    { ".w61", "application/wordperfect61" },
-    { ".w6w", "application/msword" },
-    { ".wad", "application/x-doom" },
-    { ".wadl", "application/vnd.sun.wadl+xml" },
-    { ".war", "application/java-archive" },
-    { ".wasm", "application/wasm" },
-    { ".wav", "audio/wav" },
-    { ".wave", "audio/wav" },
-    { ".wax", "audio/x-ms-wax" },
-    { ".wb1", "application/x-qpro" },
-    { ".wbk", "application/msword" },
-    { ".wbmp", "image/vnd.wap.wbmp" },
-    { ".wbs", "application/vnd.criticaltools.wbs+xml" },
-    { ".wbxml", "application/vnd.wap.wbxml" },
-    { ".wcm", "application/vnd.ms-works" },
-    { ".wdb", "application/vnd.ms-works" },
-    { ".wdp", "image/vnd.ms-photo" },
-    { ".web", "application/vndxara" },
-    { ".weba", "audio/webm" },
-    { ".webapp", "application/x-web-app-manifest+json" },
-    { ".webarchive", "application/x-safari-webarchive" },
-    { ".webm", "video/webm" },
-    { ".webmanifest", "application/manifest+json" },
-    { ".webp", "image/webp" }, /* https://en.wikipedia.org/wiki/WebP */
-    { ".webtest", "application/xml" },
-    { ".wg", "application/vnd.pmi.widget" },
-    { ".wgsl", "text/wgsl" },
-    { ".wgt", "application/widget" },
-    { ".wif", "application/watcherinfo+xml" },
-    { ".wiq", "application/xml" },
-    { ".wiz", "application/msword" },
-    { ".wk1", "application/x-123" },
-    { ".wks", "application/vnd.ms-works" },
-    { ".WLMP", "application/wlmoviemaker" },
-    { ".wlpginstall", "application/x-wlpg-detect" },
-    { ".wlpginstall3", "application/x-wlpg3-detect" },
-    { ".wm", "video/x-ms-wm" },
-    { ".wma", "audio/x-ms-wma" },
-    { ".wmd", "application/x-ms-wmd" },
-    { ".wmf", "application/x-msmetafile" },
-    { ".wml", "text/vnd.wap.wml" },
-    { ".wmlc", "application/vnd.wap.wmlc" },
-    { ".wmls", "text/vnd.wap.wmlscript" },
-    { ".wmlsc", "application/vnd.wap.wmlscriptc" },
-    { ".wmp", "video/x-ms-wmp" },
-    { ".wmv", "video/x-ms-wmv" },
-    { ".wmx", "video/x-ms-wmx" },
-    { ".wmz", "application/x-ms-wmz" },
-    { ".woff", "application/font-woff" },
-    { ".woff2", "application/font-woff2" },
-    { ".word", "application/msword" },
-    { ".wp", "application/wordperfect" },
-    { ".wp5", "application/wordperfect" },
-    { ".wp6", "application/wordperfect" },
-    { ".wpd", "application/vnd.wordperfect" },
-    { ".wpl", "application/vnd.ms-wpl" },
-    { ".wps", "application/vnd.ms-works" },
-    { ".wq1", "application/x-lotus" },
-    { ".wqd", "application/vnd.wqd" },
-    { ".wri", "application/x-mswrite" },
-    { ".wrl", "x-world/x-vrml" },
-    { ".wrz", "x-world/x-vrml" },
-    { ".wsc", "text/scriptlet" },
-    { ".wsdl", "text/xml" },
-    { ".wspolicy", "application/wspolicy+xml" },
-    { ".wsrc", "application/x-wais-source" },
-    { ".wtb", "application/vnd.webturbo" },
-    { ".wtk", "application/x-wintalk" },
-    { ".wvx", "video/x-ms-wvx" },
-    { ".wz", "application/x-wingz" },
-    { ".x", "application/directx" },
-    { ".x-png", "image/png" },
-    { ".x32", "application/x-authorware-bin" },
-    { ".x3d", "application/vnd.hzn-3d-crossword" },
-    { ".x3db", "model/x3d+binary" },
-    { ".x3dbz", "model/x3d+binary" },
-    { ".x3dv", "model/x3d+vrml" },
-    { ".x3dvz", "model/x3d+vrml" },
-    { ".x3dz", "model/x3d+xml" },
-    { ".x3f", "image/x-sigma-x3f" },
-    { ".xaf", "x-world/x-vrml" },
-    { ".xaml", "application/xaml+xml" },
-    { ".xap", "application/x-silverlight-app" },
-    { ".xar", "application/vnd.xara" },
-    { ".xav", "application/xcap-att+xml" },
-    { ".xbap", "application/x-ms-xbap" },
-    { ".xbd", "application/vnd.fujixerox.docuworks.binder" },
-    { ".xbm", "image/x-xbitmap" },
-    { ".xca", "application/xcap-caps+xml" },
-    { ".xcf", "image/x-xcf" },
-    { ".xcs", "application/calendar+xml" },
-    { ".xdf", "application/xcap-diff+xml" },
-    { ".xdm", "application/vnd.syncml.dm+xml" },
-    { ".xdp", "application/vnd.adobe.xdp+xml" },
-    { ".xdr", "text/plain" },
-    { ".xdssc", "application/dssc+xml" },
-    { ".xdw", "application/vnd.fujixerox.docuworks" },
-    { ".xel", "application/xcap-el+xml" },
-    { ".xenc", "application/xenc+xml" },
-    { ".xer", "application/patch-ops-error+xml" },
-    { ".xfdf", "application/vnd.adobe.xfdf" },
-    { ".xfdl", "application/vnd.xfdl" },
-    { ".xgz", "xgl/drawing" },
-    { ".xht", "application/xhtml+xml" },
-    { ".xhtm", "application/vnd.pwg-xhtml-print+xml" },
-    { ".xhtml", "application/xhtml+xml" },
-    { ".xhvml", "application/xv+xml" },
-    { ".xif", "image/vnd.xiff" },
-    { ".xl", "application/excel" },
-    { ".xla", "application/vnd.ms-excel" },
-    { ".xlam", "application/vnd.ms-excel.addin.macroEnabled.12" },
-    { ".xlb", "application/excel" },
-    { ".xlc", "application/vnd.ms-excel" },
-    { ".xld", "application/vnd.ms-excel" },
-    { ".xlf", "application/x-xliff+xml" },
-    { ".xlk", "application/vnd.ms-excel" },
-    { ".xll", "application/vnd.ms-excel" },
-    { ".xlm", "application/vnd.ms-excel" },
-    { ".xls", "application/vnd.ms-excel" },
-    { ".xlsb", "application/vnd.ms-excel.sheet.binary.macroEnabled.12" },
-    { ".xlsm", "application/vnd.ms-excel.sheet.macroEnabled.12" },
-    { ".xlsx", "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet" },
-    { ".xlt", "application/vnd.ms-excel" },
-    { ".xltm", "application/vnd.ms-excel.template.macroEnabled.12" },
-    { ".xltx", "application/vnd.openxmlformats-officedocument.spreadsheetml.template" },
-    { ".xlv", "application/excel" },
-    { ".xlw", "application/vnd.ms-excel" },
-    { ".xm", "audio/xm" },
-    { ".xml", "text/xml" },
-    { ".xmp", "application/octet-stream" },
-    { ".xmta", "application/xml" },
-    { ".xmz", "xgl/movie" },
-    { ".xns", "application/xcap-ns+xml" },
-    { ".xo", "application/vnd.olpc-sugar" },
-    { ".xof", "x-world/x-vrml" },
-    { ".XOML", "text/plain" },
-    { ".xop", "application/xop+xml" },
-    { ".xpi", "application/x-xpinstall" },
-    { ".xpix", "application/x-vndls-xpix" },
-    { ".xpl", "application/xproc+xml" },
-    { ".xpm", "image/x-xpixmap" },
-    { ".xpr", "application/vnd.is-xpr" },
-    { ".xps", "application/vnd.ms-xpsdocument" },
-    { ".xpw", "application/vnd.intercon.formnet" },
-    { ".xpx", "application/vnd.intercon.formnet" },
-    { ".xrm-ms", "text/xml" },
-    { ".xsc", "application/xml" },
-    { ".xsd", "text/xml" },
-    { ".xsf", "text/xml" },
-    { ".xsl", "text/xml" },
-    { ".xslt", "text/xml" },
-    { ".xsm", "application/vnd.syncml+xml" },
-    { ".xsn", "application/octet-stream" },
-    { ".xspf", "application/xspf+xml" },
-    { ".xsr", "video/x-amt-showrun" },
-    { ".xss", "application/xml" },
-    { ".xtp", "application/octet-stream" },
-    { ".xul", "application/vnd.mozilla.xul+xml" },
-    { ".xvm", "application/xv+xml" },
-    { ".xvml", "application/xv+xml" },
-    { ".xwd", "image/x-xwindowdump" },
-    { ".xyz", "chemical/x-xyz" },
-    { ".xz", "application/x-xz" },
-    { ".x_b", "model/vnd.parasolid.transmit.binary" },
-    { ".x_t", "model/vnd.parasolid.transmit.text" },
-    { ".yaml", "application/yaml" },
-    { ".yang", "application/yang" },
-    { ".yin", "application/yin+xml" },
-    { ".yml", "application/yaml" },
-    { ".ymp", "text/x-suse-ymp" },
-    { ".z", "application/x-compress" },
-    { ".z1", "application/x-zmachine" },
-    { ".z2", "application/x-zmachine" },
-    { ".z3", "application/x-zmachine" },
-    { ".z4", "application/x-zmachine" },
-    { ".z5", "application/x-zmachine" },
-    { ".z6", "application/x-zmachine" },
-    { ".z7", "application/x-zmachine" },
-    { ".z8", "application/x-zmachine" },
-    { ".zaz", "application/vnd.zzazz.deck+xml" },
-    { ".zip", "application/zip" },
-    { ".zir", "application/vnd.zul" },
-    { ".zirz", "application/vnd.zul" },
-    { ".zmm", "application/vnd.handheld-entertainment+xml" },
-    { ".zoo", "application/octet-stream" },
-    { ".zsh", "text/x-scriptzsh" },
-    { "application/epub+zip", ".epub" },
-    { "application/fsharp-script", ".fsx" },
-    { "application/msaccess", ".adp" },
-    { "application/msword", ".doc" },
-    { "application/octet-stream", ".bin" },
-    { "application/onenote", ".one" },
-    { "application/postscript", ".eps" },
-    { "application/step", ".step" },
-    { "application/vnd.apple.keynote", ".key" },
-    { "application/vnd.apple.numbers", ".numbers" },
-    { "application/vnd.apple.pages", ".pages" },
-    { "application/vnd.ms-excel", ".xls" },
-    { "application/vnd.ms-powerpoint", ".ppt" },
-    { "application/vnd.ms-works", ".wks" },
-    { "application/vnd.visio", ".vsd" },
-    { "application/x-director", ".dir" },
-    { "application/x-iwork-keynote-sffkey", ".key" },
-    { "application/x-iwork-numbers-sffnumbers", ".numbers" },
-    { "application/x-iwork-pages-sffpages", ".pages" },
-    { "application/x-msdos-program", ".exe" },
-    { "application/x-shockwave-flash", ".swf" },
-    { "application/x-x509-ca-cert", ".cer" },
-    { "application/x-zip-compressed", ".zip" },
-    { "application/xhtml+xml", ".xhtml" },
-    { "application/xml", ".xml" },
-    { "audio/aac", ".AAC" },
-    { "audio/aiff", ".aiff" },
-    { "audio/basic", ".snd" },
-    { "audio/mid", ".midi" },
-    { "audio/mp4", ".m4a" }, // one way mapping only, mime -> ext
-    { "audio/ogg", ".ogg" },
-    { "audio/ogg; codecs=opus", ".opus" },
-    { "audio/wav", ".wav" },
-    { "audio/x-m4a", ".m4a" },
-    { "audio/x-mpegurl", ".m3u" },
-    { "audio/x-pn-realaudio", ".ra" },
-    { "audio/x-smd", ".smd" },
-    { "image/bmp", ".bmp" },
-    { "image/heic", ".heic" },
-    { "image/heif", ".heif" },
-    { "image/jpeg", ".jpg" },
-    { "image/jpg", ".jpg" },
-    { "image/pict", ".pic" },
-    { "image/png", ".png" }, // Defined in [RFC-2045], [RFC-2048]
-    { "image/tiff", ".tiff" },
-    { "image/x-macpaint", ".mac" },
-    { "image/x-png", ".png" }, // See https://www.w3.org/TR/PNG/#A-Media-type :"It is recommended that implementations also recognize the media type "image/x-png"."
-    { "image/x-quicktime", ".qti" },
-    { "message/rfc822", ".eml" },
-    { "text/calendar", ".ics" },
-    { "text/comma-separated-values", ".csv" },
-    { "text/html", ".html" },
-    { "text/markdown", ".md" }, // https://datatracker.ietf.org/doc/html/rfc7763
-    { "text/plain", ".txt" },
-    { "text/rtf", ".rtf" },
-    { "text/scriptlet", ".wsc" },
-    { "text/xml", ".xml" },
-    { "video/3gpp", ".3gp" },
-    { "video/3gpp2", ".3gp2" },
-    { "video/mp4", ".mp4" },
-    { "video/mpeg", ".mpg" },
-    { "video/quicktime", ".mov" },
-    { "video/vnd.dlna.mpeg-tts", ".m2t" },
-    { "video/x-dv", ".dv" },
-    { "video/x-la-asf", ".lsf" },
-    { "video/x-ms-asf", ".asf" },
-    { "x-world/x-vrml", ".xof" }
-};
\ No newline at end of file
+// The longest known suffix wins ("x.tar.gz" before "x.gz"). Overrides from info.json
+// are checked at every suffix before the built-in table.
+std::string_view WebServer::getMimeType(const std::filesystem::path& file) const {
+    std::string name = file.filename().string();
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    // A leading dot marks a hidden file, not a suffix
+    for (size_t dot = name.find('.', 1); dot != std::string::npos; dot = name.find('.', dot + 1)) {
+        const std::string_view suffix = std::string_view(name).substr(dot + 1);
+        if (suffix.empty()) break;
+        if (!this->mime_overrides.empty()) {
+            auto it = this->mime_overrides.find(std::string(suffix));
+            if (it != this->mime_overrides.end()) return it->second;
+        }
+        if (suffix.size() > MAX_SUFFIX_LENGTH) continue;
+        if (const MimeEntry* entry = MIME_TABLE.find(suffix)) {
+            return entry->type;
+        }
+    }
+    return "application/octet-stream";
+}
+
+void WebServer::setMimeOverrides(const json::object& overrides) {
+    for (const auto& entry : overrides) {
+        if (!entry.value().is_string()) {
+            this->logger->warn("[server] Ignoring MIME override for '" + std::string(entry.key()) + "': value must be a string");
+            continue;
+        }
+        std::string_view suffix = entry.key();
+        if (!suffix.empty() && suffix.front() == '.') suffix.remove_prefix(1);
+        if (suffix.empty()) continue;
+        this->mime_overrides[toLowerSuffix(suffix)] = std::string(entry.value().as_string());
+    }
+}
@@ -0,0 +1,408 @@
+// Copyright (C) 2025 spur27
+// SPDX-License-Identifier: BSL-1.0
+//
+// This file is part of RenWeb Engine.
+//
+// Boost Software License - Version 1.0 - August 17th, 2003
+//
+// Permission is hereby granted, free of charge, to any person or organization
+// obtaining a copy of the software and accompanying documentation covered by
+// this license (the "Software") to use, reproduce, display, distribute,
+// execute, and transmit the Software, and to prepare derivative works of the
+// Software, and to permit third-parties to whom the Software is furnished to
+// do so, all subject to the following:
+//
+// The copyright notices in the Software and this entire statement, including
+// the above license grant, this restriction and the following disclaimer,
+// must be included in all copies of the Software, in whole or in part, and
+// all derivative works of the Software, unless such copies or derivative
+// works are solely in the form of machine-executable object code generated by
+// a source language processor.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+// FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+// ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+#include "../include/web_server.hpp"
+
+#include "../include/app.hpp"
+#include <boost/json/serialize.hpp>
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <optional>
+#include <unordered_set>
+
+#if !defined(_WIN32)
+    #include <sys/socket.h>
+#endif
+
+using WebServer = RenWeb::WebServer;
+
+// Messages queued for one peer are delivered in order by a single flusher at a time,
+// so the peer's keep-alive client is never shared between threads. A process reachable
+// under several addresses ("unix:<socket>", its URL, host:port) gets one queue: before
+// its first flush each new address is asked who it is and merged into the queue of a
+// peer already known by that identity.
+class WebServer::PeerOutbox {
+    public:
+        PeerOutbox(WebServer* server, size_t num_threads, size_t queue_limit, size_t batch_max)
+            : server(server)
+            , queue_limit(queue_limit)
+            , batch_max(batch_max)
+        {
+            for (size_t i = 0; i < num_threads; i++) {
+                this->threads.emplace_back([this]() { this->work(); });
+            }
+        }
+        ~PeerOutbox() {
+            this->shutdown();
+        }
+
+        // False when the peer already has queue_limit messages waiting
+        bool enqueue(const std::string& address, json::value payload, std::chrono::milliseconds timeout) {
+            {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                if (this->stopping) return false;
+                std::shared_ptr<Peer>& peer = this->peers[PeerOutbox::normalize(address)];
+                if (!peer) {
+                    peer = std::make_shared<Peer>();
+                    peer->address = address;
+                }
+                if (this->queue_limit > 0 && peer->queue.size() >= this->queue_limit) {
+                    this->rejected++;
+                    return false;
+                }
+                peer->queue.push_back(Outgoing{std::move(payload), timeout});
+                this->enqueued++;
+                if (peer->scheduled) return true;
+                peer->scheduled = true;
+                this->ready.push_back(peer);
+            }
+            this->cv.notify_one();
+            return true;
+        }
+
+        // Lets the threads flush whatever is queued (one attempt per batch), then joins them
+        void shutdown() {
+            {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                this->stopping = true;
+            }
+            this->cv.notify_all();
+            for (auto& thread : this->threads) {
+                if (thread.joinable()) thread.join();
+            }
+            this->threads.clear();
+        }
+
+        json::object getStats() {
+            size_t peer_count, waiting = 0;
+            {
+                std::lock_guard<std::mutex> lock(this->mtx);
+                // Merged addresses share a queue, so count each queue once
+                std::unordered_set<const Peer*> seen;
+                for (const auto& entry : this->peers) {
+                    if (seen.insert(entry.second.get()).second) {
+                        waiting += entry.second->queue.size();
+                    }
+                }
+                peer_count = seen.size();
+            }
+            return json::object{
+                {"peers", peer_count},
+                {"queued", waiting},
+                {"queue_limit", this->queue_limit},
+                {"enqueued", this->enqueued.load()},
+                {"sent", this->sent.load()},
+                {"batches", this->batches.load()},
+                {"failed", this->failed.load()},
+                {"rejected", this->rejected.load()},
+                {"reconnects", this->reconnects.load()},
+                {"merged", this->merged.load()}
+            };
+        }
+    private:
+        struct Outgoing {
+            json::value payload;
+            std::chrono::milliseconds timeout;
+        };
+        struct Peer {
+            std::string address;
+            // Set once the peer has been asked who it is; "" when it did not answer
+            std::optional<std::string> identity;
+            std::deque<Outgoing> queue;
+            std::unique_ptr<httplib::Client> client;
+            bool scheduled = false;
+        };
+        WebServer* server;
+        const size_t queue_limit;
+        const size_t batch_max;
+        std::mutex mtx;
+        std::condition_variable cv;
+        // Normalized address -> queue; every address of a merged peer points at the same one
+        std::unordered_map<std::string, std::shared_ptr<Peer>> peers;
+        std::unordered_map<std::string, std::shared_ptr<Peer>> identities;
+        std::deque<std::shared_ptr<Peer>> ready;
+        std::vector<std::thread> threads;
+        bool stopping = false;
+        std::atomic<uint64_t> enqueued{0};
+        std::atomic<uint64_t> sent{0};
+        std::atomic<uint64_t> batches{0};
+        std::atomic<uint64_t> failed{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> reconnects{0};
+        std::atomic<uint64_t> merged{0};
+
+        // Spelling-only differences: scheme, case, trailing slash
+        static std::string normalize(const std::string& address) {
+            if (address.rfind("unix:", 0) == 0) return address;
+            std::string url = address;
+            if (url.find("://") == std::string::npos) url = "http://" + url;
+            while (url.size() > 1 && url.back() == '/') url.pop_back();
+            std::transform(url.begin(), url.end(), url.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return url;
+        }
+
+        // Who the process behind an address is: "<pid>@<its own URL>", or "" if it does not answer
+        std::string identify(const Peer& peer, std::chrono::milliseconds timeout) const {
+            try {
+                const json::object info = this->server->whoAreYou(peer.address,
+                    static_cast<time_t>(timeout.count() / 1000), static_cast<time_t>(timeout.count() % 1000));
+                const json::value* pid = info.if_contains("pid");
+                if (pid == nullptr || !pid->is_number()) return "";
+                const json::value* url = info.if_contains("url");
+                return json::serialize(*pid) + "@" + ((url != nullptr && url->is_string()) ? std::string(url->as_string()) : "");
+            } catch (...) {
+                return "";
+            }
+        }
+
+        // Called with mtx held and peer popped off ready. Returns false when peer was folded into
+        // the queue of another address for the same process, which then delivers its messages.
+        bool adopt(const std::shared_ptr<Peer>& peer, const std::string& identity) {
+            peer->identity = identity;
+            if (identity.empty()) return true;
+            std::shared_ptr<Peer>& known = this->identities[identity];
+            if (!known || known == peer) {
+                known = peer;
+                return true;
+            }
+            for (auto& outgoing : peer->queue) {
+                known->queue.push_back(std::move(outgoing));
+            }
+            peer->queue.clear();
+            for (auto& entry : this->peers) {
+                if (entry.second == peer) entry.second = known;
+            }
+            this->merged++;
+            if (!known->scheduled && !known->queue.empty()) {
+                known->scheduled = true;
+                this->ready.push_back(known);
+                this->cv.notify_one();
+            }
+            return false;
+        }
+
+        // Called with mtx held
+        void forget(const std::shared_ptr<Peer>& peer) {
+            for (auto it = this->peers.begin(); it != this->peers.end();) {
+                it = (it->second == peer) ? this->peers.erase(it) : std::next(it);
+            }
+            if (peer->identity && !peer->identity->empty()) {
+                auto it = this->identities.find(*peer->identity);
+                if (it != this->identities.end() && it->second == peer) this->identities.erase(it);
+            }
+        }
+
+        void work() {
+            while (true) {
+                std::shared_ptr<Peer> peer;
+                std::vector<Outgoing> batch;
+                {
+                    std::unique_lock<std::mutex> lock(this->mtx);
+                    this->cv.wait(lock, [this]() { return this->stopping || !this->ready.empty(); });
+                    if (this->ready.empty()) return;
+                    peer = std::move(this->ready.front());
+                    this->ready.pop_front();
+                    if (!peer->identity && !this->stopping) {
+                        const std::chrono::milliseconds timeout = peer->queue.empty()
+                            ? std::chrono::milliseconds(2000) : peer->queue.front().timeout;
+                        lock.unlock();
+                        const std::string identity = this->identify(*peer, timeout);
+                        lock.lock();
+                        if (!this->adopt(peer, identity)) {
+                            peer->scheduled = false;
+                            continue;
+                        }
+                    }
+                    const size_t count = std::min(peer->queue.size(), this->batch_max);
+                    batch.reserve(count);
+                    for (size_t i = 0; i < count; i++) {
+                        batch.push_back(std::move(peer->queue.front()));
+                        peer->queue.pop_front();
+                    }
+                }
+                this->flush(*peer, batch);
+                {
+                    std::lock_guard<std::mutex> lock(this->mtx);
+                    if (peer->queue.empty()) {
+                        peer->scheduled = false;
+                        // Forget peers whose last batch failed, most likely because the process exited
+                        if (!peer->client) {
+                            this->forget(peer);
+                        }
+                    } else {
+                        // Back of the line, so one busy peer cannot starve the others
+                        this->ready.push_back(std::move(peer));
+                    }
+                }
+            }
+        }
+
+        void flush(Peer& peer, std::vector<Outgoing>& batch) {
+            if (batch.empty()) return;
+            std::chrono::milliseconds timeout(0);
+            for (const auto& outgoing : batch) {
+                timeout = std::max(timeout, outgoing.timeout);
+            }
+            const time_t timeout_s = static_cast<time_t>(timeout.count() / 1000);
+            const time_t timeout_ms = static_cast<time_t>(timeout.count() % 1000);
+            if (!peer.client) {
+                peer.client = WebServer::makePeerClient(peer.address, timeout_s, timeout_ms);
+                peer.client->set_keep_alive(true);
+            } else {
+                peer.client->set_connection_timeout(timeout_s, timeout_ms * 1000);
+                peer.client->set_read_timeout(timeout_s, timeout_ms * 1000);
+                peer.client->set_write_timeout(timeout_s, timeout_ms * 1000);
+            }
+            // A lone message goes out as a plain object, which older receivers also understand
+            std::string body;
+            if (batch.size() == 1) {
+                body = json::serialize(batch.front().payload);
+            } else {
+                json::array payloads;
+                payloads.reserve(batch.size());
+                for (auto& outgoing : batch) {
+                    payloads.push_back(std::move(outgoing.payload));
+                }
+                body = json::serialize(payloads);
+                // Keep the payloads around for failure reports
+                for (size_t i = 0; i < batch.size(); i++) {
+                    batch[i].payload = std::move(payloads[i]);
+                }
+            }
+            auto res = peer.client->Post("/??q=", body, "application/json");
+            this->batches++;
+            if (res && res->status >= 200 && res->status < 300) {
+                this->sent += batch.size();
+                return;
+            }
+            const std::string error = res
+                ? "HTTP " + std::to_string(res->status)
+                : httplib::to_string(res.error());
+            // Drop the connection; the next batch reconnects
+            peer.client->stop();
+            peer.client.reset();
+            this->reconnects++;
+            this->failed += batch.size();
+            for (const auto& outgoing : batch) {
+                const json::value* message = outgoing.payload.is_object() ? outgoing.payload.as_object().if_contains("message") : nullptr;
+                this->server->reportDeliveryFailure(peer.address, message ? *message : outgoing.payload, error);
+            }
+        }
+};
+
+// "unix:<path>" selects the peer's IPC socket, anything else is an HTTP URL or host:port
+std::unique_ptr<httplib::Client> WebServer::makePeerClient(const std::string& address, time_t timeout_s, time_t timeout_ms) {
+    std::unique_ptr<httplib::Client> client;
+    if (address.rfind("unix:", 0) == 0) {
+        client = std::make_unique<httplib::Client>(address.substr(5), 80);
+        client->set_address_family(AF_UNIX);
+    } else {
+        std::string url = address;
+        if (url.find("://") == std::string::npos) {
+            url = "http://" + url; // assume http if no protocol specified
+        }
+        client = std::make_unique<httplib::Client>(url);
+    }
+    client->set_connection_timeout(timeout_s, timeout_ms * 1000);
+    client->set_read_timeout(timeout_s, timeout_ms * 1000);
+    client->set_write_timeout(timeout_s, timeout_ms * 1000);
+    return client;
+}
+
+void WebServer::startOutbox() {
+    this->outbox = std::make_shared<PeerOutbox>(this, this->peer_threads, this->peer_queue_limit, this->peer_batch_max);
+}
+
+void WebServer::stopOutbox() /*override*/ {
+    // Failures from the final flush must not reach the webview, which App may be tearing down
+    this->closing = true;
+    // Not reset: sendMessage may still run on another thread, and enqueue refuses once stopped
+    if (this->outbox) this->outbox->shutdown();
+}
+
+json::object WebServer::getPeerStats() {
+    return this->outbox ? this->outbox->getStats() : json::object{};
+}
+
+void WebServer::sendMessage(const std::string& ip, const json::value& message, time_t timeout_s, time_t timeout_ms) const /*override*/ {
+    json::object payload;
+    payload["message"] = message;
+    payload["sender"] = this->app->procm->dumpCurrentProcess();
+    payload["timestamp"] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();    
+    this->logger->trace("[server] Sending message to " + ip + ": " + json::serialize(message));
+    const std::chrono::milliseconds timeout(static_cast<int64_t>(timeout_s) * 1000 + static_cast<int64_t>(timeout_ms));
+    if (!this->outbox || !this->outbox->enqueue(ip, std::move(payload), timeout)) {
+        this->reportDeliveryFailure(ip, message, "Outbound queue for this peer is full");
+    }
+}
+
+json::object WebServer::whoAreYou(const std::string& ip, time_t timeout_s, time_t timeout_ms) const /*override*/ {
+    auto client = WebServer::makePeerClient(ip, timeout_s, timeout_ms);
+    auto res = client->Get("/??q=");
+    client->stop();
+
+    this->logger->trace("[server] whoAreYou queried " + ip);
+    return (res && res->status == 200) ? json::parse(res->body).as_object() : json::object{};
+}
+
+void WebServer::onDeliveryFailure(DeliveryFailureHandler handler) /*override*/ {
+    std::lock_guard<std::mutex> lock(this->delivery_failure_mtx);
+    this->delivery_failure_handlers.push_back(std::move(handler));
+}
+
+void WebServer::reportDeliveryFailure(const std::string& peer, const json::value& message, const std::string& error) const {
+    this->logger->warn("[server] Could not deliver message to " + peer + ": " + error);
+    // During destruction the webview and any handler owners may already be gone
+    if (this->closing) return;
+    std::vector<DeliveryFailureHandler> handlers;
+    {
+        std::lock_guard<std::mutex> lock(this->delivery_failure_mtx);
+        handlers = this->delivery_failure_handlers;
+    }
+    for (const auto& handler : handlers) {
+        try {
+            handler(peer, message, error);
+        } catch (const std::exception& e) {
+            this->logger->error("[server] Delivery failure handler threw: " + std::string(e.what()));
+        }
+    }
+    const std::string event = json::serialize(json::object{
+        {"to", peer},
+        {"message", message},
+        {"error", error}
+    });
+    const std::string script =
+        "(async () => {"
+        "  if (typeof window.renweb?.onMessageFailed === 'function') await window.renweb.onMessageFailed(" + event + ");"
+        "})().catch(function(e) { console.error('[renweb] onMessageFailed error:', e); });";
+    this->app->w->queue_eval(script);
+}
@@ -57,6 +57,8 @@
 #endif
 
 using Webview = RenWeb::Webview;
+using EventCoalescer = RenWeb::EventCoalescer;
+using EvalQueue = RenWeb::EvalQueue;
 
 static std::string escapeJsString(const std::string& input) {
     std::string out;
@@ -84,15 +86,13 @@ static std::string makeCallbackScript(const std::string& callback_name, const st
            "})().catch(function(e) { console.error('[renweb] " + callback_name + " error:', e); });";
 }
 
-static std::string makeOnMoveScript(int x, int y) {
-    return makeCallbackScript(
-        "onMove",
-        "{ x: " + std::to_string(x) + ", y: " + std::to_string(y) + " }"
-    );
+// Payloads for the coalesced events; EventCoalescer wraps them into the callback script
+static std::string makeMovePayload(int x, int y) {
+    return "{ x: " + std::to_string(x) + ", y: " + std::to_string(y) + " }";
 }
 
-static std::string makeOnWindowStateChangedScript(const char* state) {
-    return makeCallbackScript("onWindowStateChanged", std::string("{ state: '") + state + "' }");
+static std::string makeWindowStatePayload(const char* state) {
+    return std::string("{ state: '") + state + "' }";
 }
 
 static std::string makeOnPermissionRequestedScript(const std::string& kind, const std::string& origin) {
@@ -163,7 +163,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
         (IMP)+[](id self, SEL, WKWebView* webView, WKNavigationAction* action, void (^decisionHandler)(WKNavigationActionPolicy)) {
             (void)webView;
             NSValue* wvValue = (NSValue*)objc_getAssociatedObject(self, "renweb_wv_ptr");
-            webview::webview* wv = wvValue ? (webview::webview*)[wvValue pointerValue] : nullptr;
+            Webview* wv = wvValue ? (Webview*)[wvValue pointerValue] : nullptr;
 
             bool isNewWindow = false;
             if (action && [action targetFrame] == nil) isNewWindow = true;
@@ -173,7 +173,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
                 NSString* urlNS = [[[action request] URL] absoluteString];
                 std::string url = urlNS ? std::string([urlNS UTF8String]) : std::string();
                 try {
-                    wv->eval(makeOnNewWindowRequestedScript(url));
+                    wv->queue_eval(makeOnNewWindowRequestedScript(url));
                 } catch (...) { }
             }
 
@@ -186,7 +186,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
         (IMP)+[](id self, SEL, WKWebView* webView) {
             (void)webView;
             NSValue* wvValue = (NSValue*)objc_getAssociatedObject(self, "renweb_wv_ptr");
-            webview::webview* wv = wvValue ? (webview::webview*)[wvValue pointerValue] : nullptr;
+            Webview* wv = wvValue ? (Webview*)[wvValue pointerValue] : nullptr;
             if (!wv) return;
 
             NSWindow* nsWindow = [webView window];
@@ -195,7 +195,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
             }
 
             try {
-                wv->eval(makeOnRenderProcessTerminatedScript("web-content-process-terminated"));
+                wv->queue_eval(makeOnRenderProcessTerminatedScript("web-content-process-terminated"));
             } catch (...) { }
         },
         "v@:@@");
@@ -204,7 +204,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
         sel_registerName("webView:didFailProvisionalNavigation:withError:"),
         (IMP)+[](id self, SEL, WKWebView* webView, WKNavigation*, NSError* error) {
             NSValue* wvValue = (NSValue*)objc_getAssociatedObject(self, "renweb_wv_ptr");
-            webview::webview* wv = wvValue ? (webview::webview*)[wvValue pointerValue] : nullptr;
+            Webview* wv = wvValue ? (Webview*)[wvValue pointerValue] : nullptr;
             if (!wv || !isCertificateNSError(error)) return;
 
             NSString* urlNS = [[webView URL] absoluteString];
@@ -212,7 +212,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
             std::string err = std::string([[error localizedDescription] UTF8String]);
 
             try {
-                wv->eval(makeOnCertificateErrorScript(url, err));
+                wv->queue_eval(makeOnCertificateErrorScript(url, err));
             } catch (...) { }
         },
         "v@:@@@@");
@@ -222,7 +222,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
         (IMP)+[](id self, SEL, WKWebView* webView, NSURLAuthenticationChallenge* challenge,
                  void (^completionHandler)(NSURLSessionAuthChallengeDisposition, NSURLCredential*)) {
             NSValue* wvValue = (NSValue*)objc_getAssociatedObject(self, "renweb_wv_ptr");
-            webview::webview* wv = wvValue ? (webview::webview*)[wvValue pointerValue] : nullptr;
+            Webview* wv = wvValue ? (Webview*)[wvValue pointerValue] : nullptr;
 
             if (wv && challenge) {
                 NSString* hostNS = [[[challenge protectionSpace] host] copy];
@@ -230,7 +230,7 @@ static Class getOrCreateRenWebNavigationDelegateClass() {
                 std::string origin = hostNS ? std::string([hostNS UTF8String]) : std::string();
                 std::string kind = methodNS ? std::string([methodNS UTF8String]) : std::string("authentication-challenge");
                 try {
-                    wv->eval(makeOnPermissionRequestedScript(kind, origin));
+                    wv->queue_eval(makeOnPermissionRequestedScript(kind, origin));
                 } catch (...) { }
                 [hostNS release];
                 [methodNS release];
@@ -271,31 +271,33 @@ static bool isWindowFullscreen(HWND hwnd) {
            wr.right == mi.rcMonitor.right && wr.bottom == mi.rcMonitor.bottom;
 }
 
-static LRESULT CALLBACK onCloseSubclassProc(
+static LRESULT CALLBACK onWindowEventSubclassProc(
     HWND hwnd, UINT msg, WPARAM wp, LPARAM lp, UINT_PTR /*uid*/, DWORD_PTR data)
 {
-    auto* wv = reinterpret_cast<webview::webview*>(data);
-    if (msg == WM_SIZE && wv) {
+    auto* events = reinterpret_cast<EventCoalescer*>(data);
+    if (msg == WM_SIZE && events) {
         const bool fullscreen = isWindowFullscreen(hwnd);
         const bool minimized = (wp == SIZE_MINIMIZED);
-        if (minimized) {
-            try {
-                wv->eval(makeOnWindowStateChangedScript("minimized"));
-            } catch (...) { }
-        } else {
-            const char* state = fullscreen ? "fullscreen" : ((wp == SIZE_MAXIMIZED) ? "maximized" : "normal");
-            try {
-                wv->eval(makeOnWindowStateChangedScript(state));
-            } catch (...) { }
-        }
+        const char* state = minimized ? "minimized"
+            : fullscreen ? "fullscreen" : ((wp == SIZE_MAXIMIZED) ? "maximized" : "normal");
+        try {
+            events->post("onWindowStateChanged", makeWindowStatePayload(state));
+        } catch (...) { }
     }
-    if (msg == WM_MOVE && wv) {
+    if (msg == WM_MOVE && events) {
         const int x = static_cast<int>(static_cast<short>(LOWORD(lp)));
         const int y = static_cast<int>(static_cast<short>(HIWORD(lp)));
         try {
-            wv->eval(makeOnMoveScript(x, y));
+            events->post("onMove", makeMovePayload(x, y));
         } catch (...) { }
     }
+    return DefSubclassProc(hwnd, msg, wp, lp);
+}
+
+static LRESULT CALLBACK onCloseSubclassProc(
+    HWND hwnd, UINT msg, WPARAM wp, LPARAM lp, UINT_PTR /*uid*/, DWORD_PTR data)
+{
+    auto* wv = reinterpret_cast<webview::webview*>(data);
     if (msg == WM_CLOSE) {
         ShowWindow(hwnd, SW_HIDE);
         try {
@@ -389,6 +391,17 @@ Webview::Webview(bool debug, void* window,
 #else
     webview_impl = std::make_unique<webview::webview>(debug, window);
 #endif
+    webview::webview* impl = webview_impl.get();
+    this->eval_queue = std::make_unique<EvalQueue>(
+        [impl](std::function<void()> fn) { impl->dispatch(std::move(fn)); },
+        [impl](const std::string& js) { impl->eval(js); }
+    );
+    // A flush already runs on the UI thread, so it takes whatever is queued along with it
+    EvalQueue* queue = this->eval_queue.get();
+    this->events = std::make_unique<EventCoalescer>(
+        [impl](std::function<void()> fn) { impl->dispatch(std::move(fn)); },
+        [queue](const std::string& js) { queue->drain(js); }
+    );
     this->addWindowCallbacks();
 }
 
@@ -425,7 +438,6 @@ void Webview::addWindowCallbacks() {
         "  if (typeof window.renweb.onNewWindowRequested === 'undefined') window.renweb.onNewWindowRequested = undefined;"
         "  if (typeof window.renweb.onRenderProcessTerminated === 'undefined') window.renweb.onRenderProcessTerminated = undefined;"
         "  if (typeof window.renweb.onCertificateError === 'undefined') window.renweb.onCertificateError = undefined;"
-
         "  function _markReady() {"
         "    if (_ready) return;"
         "    _ready = true;"
@@ -475,19 +487,19 @@ void Webview::addWindowCallbacks() {
 
                 g_signal_connect(wk_webview, "permission-request",
                     G_CALLBACK(+[](WebKitWebView*, WebKitPermissionRequest* request, gpointer ud) -> gboolean {
-                        auto* wv = static_cast<webview::webview*>(ud);
+                        auto* wv = static_cast<Webview*>(ud);
                         std::string kind = request ? G_OBJECT_TYPE_NAME(request) : "unknown";
                         try {
-                            wv->eval(makeOnPermissionRequestedScript(kind, ""));
+                            wv->queue_eval(makeOnPermissionRequestedScript(kind, ""));
                         } catch (...) { }
                         return FALSE;
-                    }), webview_impl.get());
+                    }), this);
 
                 g_signal_connect(wk_webview, "decide-policy",
                     G_CALLBACK(+[](WebKitWebView*, WebKitPolicyDecision* decision,
                                    WebKitPolicyDecisionType type, gpointer ud) -> gboolean {
                         if (type != WEBKIT_POLICY_DECISION_TYPE_NEW_WINDOW_ACTION) return FALSE;
-                        auto* wv = static_cast<webview::webview*>(ud);
+                        auto* wv = static_cast<Webview*>(ud);
                         std::string uri;
 
                         WebKitNavigationPolicyDecision* nav_decision = WEBKIT_NAVIGATION_POLICY_DECISION(decision);
@@ -502,26 +514,26 @@ void Webview::addWindowCallbacks() {
                             }
                         }
                         try {
-                            wv->eval(makeOnNewWindowRequestedScript(uri));
+                            wv->queue_eval(makeOnNewWindowRequestedScript(uri));
                         } catch (...) { }
                         return FALSE;
-                    }), webview_impl.get());
+                    }), this);
 
                 g_signal_connect(wk_webview, "load-failed-with-tls-errors",
                     G_CALLBACK(+[](WebKitWebView*, const gchar* failing_uri,
                                    GTlsCertificate*, GTlsCertificateFlags errors, gpointer ud) -> gboolean {
-                        auto* wv = static_cast<webview::webview*>(ud);
+                        auto* wv = static_cast<Webview*>(ud);
                         std::string uri = failing_uri ? failing_uri : "";
                         std::string err = std::to_string(static_cast<unsigned>(errors));
                         try {
-                            wv->eval(makeOnCertificateErrorScript(uri, err));
+                            wv->queue_eval(makeOnCertificateErrorScript(uri, err));
                         } catch (...) { }
                         return FALSE;
-                    }), webview_impl.get());
+                    }), this);
 
                 g_signal_connect(wk_webview, "web-process-terminated",
                     G_CALLBACK(+[](WebKitWebView*, WebKitWebProcessTerminationReason reason, gpointer ud) {
-                        auto* wv = static_cast<webview::webview*>(ud);
+                        auto* wv = static_cast<Webview*>(ud);
                         const char* reason_str = "unknown";
                         switch (reason) {
                             case WEBKIT_WEB_PROCESS_CRASHED: reason_str = "web-process-crashed"; break;
@@ -536,26 +548,26 @@ void Webview::addWindowCallbacks() {
                         }
 
                         try {
-                            wv->eval(makeOnRenderProcessTerminatedScript(reason_str));
+                            wv->queue_eval(makeOnRenderProcessTerminatedScript(reason_str));
                         } catch (...) { }
-                    }), webview_impl.get());
+                    }), this);
             }
 
             g_signal_connect(gtk_win, "configure-event",
                 G_CALLBACK(+[](GtkWidget*, GdkEvent* event, gpointer ud) -> gboolean {
                     if (!event || event->type != GDK_CONFIGURE) return FALSE;
-                    auto* wv = static_cast<webview::webview*>(ud);
+                    auto* events = static_cast<EventCoalescer*>(ud);
                     GdkEventConfigure* cfg = (GdkEventConfigure*)event;
                     try {
-                        wv->eval(makeOnMoveScript(cfg->x, cfg->y));
+                        events->post("onMove", makeMovePayload(cfg->x, cfg->y));
                     } catch (...) { }
                     return FALSE;
-                }), webview_impl.get());
+                }), this->events.get());
 
             g_signal_connect(gtk_win, "window-state-event",
                 G_CALLBACK(+[](GtkWidget*, GdkEventWindowState* event, gpointer ud) -> gboolean {
                     if (!event) return FALSE;
-                    auto* wv = static_cast<webview::webview*>(ud);
+                    auto* events = static_cast<EventCoalescer*>(ud);
 
                     const bool minimized = (event->new_window_state & GDK_WINDOW_STATE_ICONIFIED) != 0;
                     const bool maximized = (event->new_window_state & GDK_WINDOW_STATE_MAXIMIZED) != 0;
@@ -567,11 +579,11 @@ void Webview::addWindowCallbacks() {
                     else if (maximized) state = "maximized";
 
                     try {
-                        wv->eval(makeOnWindowStateChangedScript(state));
+                        events->post("onWindowStateChanged", makeWindowStatePayload(state));
                     } catch (...) { }
 
                     return FALSE;
-                }), webview_impl.get());
+                }), this->events.get());
 
             g_signal_connect(gtk_win, "delete-event",
                 G_CALLBACK(+[](GtkWidget* gtk_win, GdkEvent*, gpointer ud) -> gboolean {
@@ -638,11 +650,14 @@ void Webview::addWindowCallbacks() {
             SetWindowSubclass(hwnd, onCloseSubclassProc,
                               /*uid=*/1,
                               reinterpret_cast<DWORD_PTR>(webview_impl.get()));
+            SetWindowSubclass(hwnd, onWindowEventSubclassProc,
+                              /*uid=*/2,
+                              reinterpret_cast<DWORD_PTR>(this->events.get()));
         }
 
         auto widget_opt = this->widget();
         if (widget_opt.has_value()) {
-            auto* wv = webview_impl.get();
+            Webview* wv = this;
             ICoreWebView2* webview2 = static_cast<ICoreWebView2*>(widget_opt.value());
 
             webview2->add_PermissionRequested(
@@ -667,7 +682,7 @@ void Webview::addWindowCallbacks() {
                         }
 
                         try {
-                            wv->eval(makeOnPermissionRequestedScript(kind_str, uri));
+                            wv->queue_eval(makeOnPermissionRequestedScript(kind_str, uri));
                         } catch (...) { }
                         return S_OK;
                     }).Get(),
@@ -683,7 +698,7 @@ void Webview::addWindowCallbacks() {
                         if (uri_w) CoTaskMemFree(uri_w);
 
                         try {
-                            wv->eval(makeOnNewWindowRequestedScript(uri));
+                            wv->queue_eval(makeOnNewWindowRequestedScript(uri));
                         } catch (...) { }
                         return S_OK;
                     }).Get(),
@@ -712,7 +727,7 @@ void Webview::addWindowCallbacks() {
                         }
 
                         try {
-                            wv->eval(makeOnRenderProcessTerminatedScript(reason));
+                            wv->queue_eval(makeOnRenderProcessTerminatedScript(reason));
                         } catch (...) { }
                         return S_OK;
                     }).Get(),
@@ -746,7 +761,7 @@ void Webview::addWindowCallbacks() {
                         }
 
                         try {
-                            wv->eval(makeOnCertificateErrorScript(source, std::to_string(static_cast<int>(status))));
+                            wv->queue_eval(makeOnCertificateErrorScript(source, std::to_string(static_cast<int>(status))));
                         } catch (...) { }
                         return S_OK;
                     }).Get(),
@@ -760,6 +775,7 @@ void Webview::addWindowCallbacks() {
         if (win_opt.has_value()) {
             NSWindow* nsWindow = (NSWindow*)win_opt.value();
             webview::webview* wv_ptr = webview_impl.get();
+            EventCoalescer* events_ptr = this->events.get();
             id observer = [[NSNotificationCenter defaultCenter]
                 addObserverForName:NSWindowWillCloseNotification
                 object:nsWindow
@@ -788,7 +804,7 @@ void Webview::addWindowCallbacks() {
                     const int x = (int)frame.origin.x;
                     const int y = (int)frame.origin.y;
                     try {
-                        wv_ptr->eval(makeOnMoveScript(x, y));
+                        events_ptr->post("onMove", makeMovePayload(x, y));
                     } catch (...) {}
                 }];
             [move_observer retain];
@@ -800,7 +816,7 @@ void Webview::addWindowCallbacks() {
                 queue:nil
                 usingBlock:^(NSNotification*) {
                     try {
-                        wv_ptr->eval(makeOnWindowStateChangedScript("minimized"));
+                        events_ptr->post("onWindowStateChanged", makeWindowStatePayload("minimized"));
                     } catch (...) {}
                 }];
             [miniaturize_observer retain];
@@ -812,7 +828,7 @@ void Webview::addWindowCallbacks() {
                 queue:nil
                 usingBlock:^(NSNotification*) {
                     try {
-                        wv_ptr->eval(makeOnWindowStateChangedScript("normal"));
+                        events_ptr->post("onWindowStateChanged", makeWindowStatePayload("normal"));
                     } catch (...) {}
                 }];
             [deminiaturize_observer retain];
@@ -824,7 +840,7 @@ void Webview::addWindowCallbacks() {
                 queue:nil
                 usingBlock:^(NSNotification*) {
                     try {
-                        wv_ptr->eval(makeOnWindowStateChangedScript("fullscreen"));
+                        events_ptr->post("onWindowStateChanged", makeWindowStatePayload("fullscreen"));
                     } catch (...) {}
                 }];
             [enter_fullscreen_observer retain];
@@ -836,7 +852,7 @@ void Webview::addWindowCallbacks() {
                 queue:nil
                 usingBlock:^(NSNotification*) {
                     try {
-                        wv_ptr->eval(makeOnWindowStateChangedScript("normal"));
+                        events_ptr->post("onWindowStateChanged", makeWindowStatePayload("normal"));
                     } catch (...) {}
                 }];
             [exit_fullscreen_observer retain];
@@ -853,7 +869,7 @@ void Webview::addWindowCallbacks() {
             if (wkWebView) {
                 Class delegateClass = getOrCreateRenWebNavigationDelegateClass();
                 id delegate = [[delegateClass alloc] init];
-                objc_setAssociatedObject(delegate, "renweb_wv_ptr", [NSValue valueWithPointer:wv_ptr], OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+                objc_setAssociatedObject(delegate, "renweb_wv_ptr", [NSValue valueWithPointer:this], OBJC_ASSOCIATION_RETAIN_NONATOMIC);
                 [wkWebView setNavigationDelegate:delegate];
                 [delegate retain];
                 _navigation_delegate = (void*)delegate;
@@ -864,6 +880,24 @@ void Webview::addWindowCallbacks() {
 }
 
 Webview::~Webview() {
+    // events and eval_queue are destroyed before webview_impl, so stop the window and
+    // the WebKit view from posting to them
+    if (webview_impl) {
+        auto win_opt = webview_impl->window();
+        if (win_opt.has_value() && win_opt.value()) {
+        #if defined(__linux__)
+            g_signal_handlers_disconnect_by_data(G_OBJECT(win_opt.value()), this->events.get());
+        #elif defined(_WIN32)
+            RemoveWindowSubclass(static_cast<HWND>(win_opt.value()), onWindowEventSubclassProc, /*uid=*/2);
+        #endif
+        }
+    #if defined(__linux__)
+        auto widget_opt = webview_impl->widget();
+        if (widget_opt.has_value() && widget_opt.value()) {
+            g_signal_handlers_disconnect_by_data(G_OBJECT(widget_opt.value()), this);
+        }
+    #endif
+    }
 #if defined(__APPLE__)
     if (_close_observer) {
         [[NSNotificationCenter defaultCenter] removeObserver:(id)_close_observer];
@@ -896,6 +930,8 @@ Webview::~Webview() {
         _exit_fullscreen_observer = nullptr;
     }
     if (_navigation_delegate) {
+        // The WKWebView outlives this object until webview_impl goes, so drop its pointer back here
+        objc_setAssociatedObject((id)_navigation_delegate, "renweb_wv_ptr", nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
         [(id)_navigation_delegate release];
         _navigation_delegate = nullptr;
     }
@@ -907,6 +943,11 @@ void Webview::terminate()                              { webview_impl->terminate
 void Webview::navigate(const std::string& url)         { webview_impl->navigate(url); }
 void Webview::bind(const std::string& name, std::function<std::string(std::string)> fn)
                                                        { webview_impl->bind(name, fn); }
+void Webview::bind_async(const std::string& name, std::function<void(std::string, std::string)> fn) {
+    webview_impl->bind(name, [fn](const std::string& id, const std::string& req, void*) { fn(id, req); }, nullptr);
+}
+void Webview::resolve(const std::string& id, int status, const std::string& result)
+                                                       { webview_impl->resolve(id, status, result); }
 void Webview::unbind(const std::string& name)          { webview_impl->unbind(name); }
 void Webview::dispatch(std::function<void()> fn)       { webview_impl->dispatch(fn); }
 void Webview::set_title(const std::string& title)      { webview_impl->set_title(title); }
@@ -915,6 +956,26 @@ void Webview::set_html(const std::string& html)        { webview_impl->set_html(
 void Webview::eval(const std::string& js)              { webview_impl->eval(js); }
 void Webview::init(const std::string& js)              { webview_impl->init(js); }
 
+void Webview::queue_eval(std::string js) {
+    this->eval_queue->push(std::move(js));
+}
+
+json::object Webview::get_eval_stats() {
+    return this->eval_queue->getStats();
+}
+
+void Webview::set_event_frame_interval(std::chrono::microseconds interval) {
+    this->events->setFrameInterval(interval);
+}
+
+void Webview::set_event_throttle(const std::string& event, std::chrono::milliseconds interval) {
+    this->events->setThrottle(event, interval);
+}
+
+json::object Webview::get_event_stats() {
+    return this->events->getStats();
+}
+
 std::optional<void*> Webview::window() {
     auto result = webview_impl->window();
     return result.has_value() ? std::optional<void*>(result.value()) : std::nullopt;
@@ -27,8 +27,12 @@
 // ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
 // DEALINGS IN THE SOFTWARE.
 #include "../include/window_functions.hpp"
+#include "../include/managers/binding_args.hpp"
 
 #include "../include/json.hpp"
+#include "../include/encoding.hpp"
+#include "../include/transcoder.hpp"
+#include "../include/trust_rules.hpp"
 #include <boost/json/object.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/json/value.hpp>
@@ -40,7 +44,6 @@
 #include <fstream>
 #include <algorithm>
 #include <cctype>
-#include <regex>
 #include "../include/web_server.hpp"
 #include "../include/app.hpp"
 #include "../include/locate.hpp"
@@ -79,6 +82,10 @@
 
 using WF = RenWeb::WindowFunctions;
 using WebServer = RenWeb::WebServer;
+namespace Encoding = RenWeb::Encoding;
+namespace Transcoder = RenWeb::Transcoder;
+using BindingProfiler = RenWeb::BindingProfiler;
+using TrustRules = RenWeb::TrustRules;
 using IOM = RenWeb::InOutManager<std::string, json::value, const json::value&>;
 
 static bool startsWith(const std::string& value, const std::string& prefix) {
@@ -99,133 +106,46 @@ static bool isSafeOpenUriScheme(const std::string& uri) {
            startsWith(lower, "file://");
 }
 
-static bool isUriLike(const std::string& value) {
-    static const std::regex uri_regex(R"(^[a-zA-Z][a-zA-Z0-9+.-]*://[^\s]+$)");
-    return std::regex_match(value, uri_regex);
-}
-
-static std::string normalizeOriginOrUri(const std::string& value) {
-    static const std::regex origin_regex(R"(^([a-zA-Z][a-zA-Z0-9+.-]*://[^/\s?#]+))");
-    std::smatch match;
-    if (std::regex_search(value, match, origin_regex) && match.size() > 1) {
-        return toLowerAscii(match[1].str());
-    }
-    return toLowerAscii(value);
-}
-
-static std::string extractHostFromUri(const std::string& value) {
-    static const std::regex host_regex(R"(^[a-zA-Z][a-zA-Z0-9+.-]*://([^/:?#\s]+))");
-    std::smatch match;
-    if (std::regex_search(value, match, host_regex) && match.size() > 1) {
-        return toLowerAscii(match[1].str());
-    }
-    return std::string();
-}
-
-static std::string trimAscii(std::string value) {
-    const auto start = value.find_first_not_of(" \t\n\r");
-    if (start == std::string::npos) {
-        return std::string();
+bool WF::isOriginAllowlisted(const std::string& target_uri) {
+    if (!this->origin_rules.has_value()) {
+        this->origin_rules = TrustRules::compile(this->app->info->getProperty("origins"));
     }
-    const auto end = value.find_last_not_of(" \t\n\r");
-    return value.substr(start, end - start + 1);
+    return this->origin_rules->present && this->origin_rules->allows(target_uri);
 }
 
-static bool trustedRuleMatchesTarget(const std::string& rule_value, const std::string& current_page) {
-    const bool target_is_uri = isUriLike(current_page);
-    if (target_is_uri) {
-        const std::string target_origin = normalizeOriginOrUri(current_page);
-        const std::string target_host = extractHostFromUri(current_page);
-        if (isUriLike(rule_value)) {
-            return normalizeOriginOrUri(rule_value) == target_origin;
-        }
-        const std::string lowered_rule = toLowerAscii(rule_value);
-        return lowered_rule == target_host || lowered_rule == target_origin;
-    }
-
-    if (isUriLike(rule_value)) {
+bool WF::isTrustedExecutionContext() {
+    if (!this->app || !this->app->config || !this->app->info) {
         return false;
     }
-    return toLowerAscii(rule_value) == toLowerAscii(current_page);
-}
-
-static bool evaluateRuleList(const json::value& rules, const std::string& target) {
-    std::vector<std::string> allows, denies;
-
-    auto process_rule = [&](const std::string& raw) {
-        std::string r = trimAscii(raw);
-        if (r.empty()) return;
-        if (r[0] == '!') {
-            std::string val = trimAscii(r.substr(1));
-            if (!val.empty()) denies.push_back(std::move(val));
-        } else {
-            allows.push_back(std::move(r));
-        }
-    };
-
-    if (rules.is_array()) {
-        for (const auto& entry : rules.as_array()) {
-            if (entry.is_string())
-                process_rule(std::string(entry.as_string().c_str()));
-        }
-    } else if (rules.is_string()) {
-        process_rule(std::string(rules.as_string().c_str()));
-    }
-
-    for (const auto& d : denies)
-        if (trustedRuleMatchesTarget(d, target)) return false;
-    for (const auto& a : allows)
-        if (trustedRuleMatchesTarget(a, target)) return true;
-    return false;
-}
-
-static bool isOriginAllowlisted(const std::string& target_uri, const json::value& origins) {
-    if (!origins.is_array() && !origins.is_string()) {
-        return false;
+    const std::string& current_page = this->app->config->current_page;
+    if (this->trust_verdict.has_value() && this->trust_verdict->first == current_page) {
+        return this->trust_verdict->second;
     }
-    return evaluateRuleList(origins, target_uri);
-}
-
-static bool isTrustedExecutionContext(RenWeb::App* app) {
-    if (!app || !app->config || !app->info) {
-        return false;
-    }
-    const std::string current_page = app->config->current_page;
-    if (current_page == RenWeb::Config::ERROR_KEY) return true;
-    const auto trusted_rules = app->info->getProperty("trusted");
-
-    if (isUriLike(current_page)) {
-        if (!trusted_rules.is_array() && !trusted_rules.is_string()) return false;
-        return evaluateRuleList(trusted_rules, current_page);
+    if (!this->trusted_rules.has_value()) {
+        this->trusted_rules = TrustRules::compile(this->app->info->getProperty("trusted"));
     }
-
-    if (!trusted_rules.is_array() && !trusted_rules.is_string()) return true;
-    if (trusted_rules.is_array()) {
-        for (const auto& entry : trusted_rules.as_array()) {
-            if (!entry.is_string()) continue;
-            const std::string r = trimAscii(std::string(entry.as_string().c_str()));
-            if (r.size() > 1 && r[0] == '!') {
-                if (trustedRuleMatchesTarget(trimAscii(r.substr(1)), current_page))
-                    return false;
-            }
-        }
-    } else if (trusted_rules.is_string()) {
-        const std::string r = trimAscii(std::string(trusted_rules.as_string().c_str()));
-        if (r.size() > 1 && r[0] == '!' && trustedRuleMatchesTarget(trimAscii(r.substr(1)), current_page))
-            return false;
+    bool trusted;
+    if (current_page == RenWeb::Config::ERROR_KEY) {
+        trusted = true;
+    } else if (TrustRules::isUriLike(current_page)) {
+        // Remote pages must be explicitly trusted
+        trusted = this->trusted_rules->present && this->trusted_rules->allows(current_page);
+    } else {
+        // Local pages are trusted unless explicitly denied
+        trusted = !this->trusted_rules->present || !this->trusted_rules->denies(current_page);
     }
-    return true;
+    this->trust_verdict = std::make_pair(current_page, trusted);
+    this->logger->trace("[security] Trust verdict for " + current_page + ": " + (trusted ? "trusted" : "untrusted"));
+    return trusted;
 }
 
 static void showErrorPage(RenWeb::App* app, const std::shared_ptr<ILogger>& logger,
                                   int code, const std::string& message, const std::string& description) {
     app->config->current_page = RenWeb::Config::ERROR_KEY;
-    const std::filesystem::path base = std::filesystem::path(app->ws->getBasePath());
+    app->ws->refreshCachePolicy();
     const std::string error_key = RenWeb::Config::ERROR_KEY;
-    const bool has_custom =
-        std::filesystem::exists(base / "custom"  / error_key / "index.html") ||
-        std::filesystem::exists(base / "content" / error_key / "index.html");
-    if (has_custom) {
+    // Resolved like a request for the page, so a packaged app's error page is found in app.rwpack
+    if (app->ws->hasAsset("/")) {
         logger->debug("[error page] Serving custom error page '" + error_key + "'");
         app->w->navigate(app->ws->getURL());
     } else {
@@ -356,11 +276,75 @@ static id getWKWebViewFromWindow(void* window_ptr) {
 }
 #endif
 using CM = RenWeb::CallbackManager<std::string, json::value, const json::value&>;
+namespace BindingArgs = RenWeb::BindingArgs;
+
+// Option objects for typed bindings (see binding_args.hpp)
+namespace BindingOpts {
+    struct ReadFile {
+        bool blob = false;
+        static auto fields() { return std::make_tuple(BindingArgs::field("blob", &ReadFile::blob)); }
+    };
+    struct WriteFile {
+        bool append = false;
+        static auto fields() { return std::make_tuple(BindingArgs::field("append", &WriteFile::append)); }
+    };
+    struct Remove {
+        bool recursive = false;
+        static auto fields() { return std::make_tuple(BindingArgs::field("recursive", &Remove::recursive)); }
+    };
+    struct Overwrite {
+        bool overwrite = false;
+        static auto fields() { return std::make_tuple(BindingArgs::field("overwrite", &Overwrite::overwrite)); }
+    };
+    struct TmpDir {
+        bool create = false;
+        static auto fields() { return std::make_tuple(BindingArgs::field("create", &TmpDir::create)); }
+    };
+    // Lenient so malformed options are ignored rather than rejected, as before typed parsing
+    struct ChooseFiles {
+        BindingArgs::Lenient<bool> multiple;
+        BindingArgs::Lenient<bool> directories;
+        BindingArgs::Lenient<std::vector<std::string>> extensions;
+        static auto fields() {
+            return std::make_tuple(
+                BindingArgs::field("multiple", &ChooseFiles::multiple),
+                BindingArgs::field("directories", &ChooseFiles::directories),
+                BindingArgs::field("extensions", &ChooseFiles::extensions));
+        }
+    };
+    struct CreateWindow {
+        bool is_detachable = false;
+        bool share_stdio = false;
+        bool include_orig_args = false;
+        static auto fields() {
+            return std::make_tuple(
+                BindingArgs::field("is_detachable", &CreateWindow::is_detachable),
+                BindingArgs::field("share_stdio", &CreateWindow::share_stdio),
+                BindingArgs::field("include_orig_args", &CreateWindow::include_orig_args));
+        }
+    };
+    struct CreateProcess {
+        bool is_detachable = false;
+        bool share_stdio = false;
+        static auto fields() {
+            return std::make_tuple(
+                BindingArgs::field("is_detachable", &CreateProcess::is_detachable),
+                BindingArgs::field("share_stdio", &CreateProcess::share_stdio));
+        }
+    };
+    struct Listen {
+        bool tail = false;
+        static auto fields() { return std::make_tuple(BindingArgs::field("tail", &Listen::tail)); }
+    };
+};
 
 WF::WindowFunctions(std::shared_ptr<ILogger> logger, RenWeb::App* app)
     : logger(logger),
       app(app),
       internal_callbacks(new CM()),
+      task_manager(new RenWeb::TaskManager()),
+      blocking_task_manager(new RenWeb::TaskManager(4)),
+      profiler(new RenWeb::BindingProfiler()),
       getsets(new IOM()),
       window_callbacks(new CM()),
       log_callbacks(new CM()),
@@ -385,61 +369,57 @@ WF::WindowFunctions(std::shared_ptr<ILogger> logger, RenWeb::App* app)
         ->setNavigateCallbacks()
         ->setPluginCallbacks()
         ->setInternalCallbacks();
-    this->bindDefaults();
-}
-
-WF::~WindowFunctions() {
-}
-
-json::value WF::processInput(const std::string& input) {
-    return this->processInput(json::parse(input));
-}
-
-json::value WF::processInput(const json::value& input) {
-    switch (input.kind()) {
-        case json::kind::string:
-            this->logger->trace("[function] Received string in processInput(std::string)");
-            [[fallthrough]];
-        case json::kind::int64:
-        case json::kind::uint64:
-        case json::kind::double_:
-        case json::kind::bool_:
-        case json::kind::null:
-            return input;
-        case json::kind::array:
-            return this->processInput(input.as_array());
-        case json::kind::object:
-            return this->processInput(input.as_object());
-        default:
-            throw std::runtime_error("[function] Unsupported JSON value kind in processInput(std::string)");
+    // info.json "profiler": { "enabled": true, "dump_at_exit": false, "trace": "binding-trace.json" }
+    const json::value profiler_opts = this->app->info->getProperty("profiler");
+    if (profiler_opts.is_object()) {
+        const json::object& opts = profiler_opts.as_object();
+        if (opts.contains("enabled") && opts.at("enabled").is_bool()) {
+            this->profiler->setEnabled(opts.at("enabled").as_bool());
+        }
+        if (opts.contains("dump_at_exit") && opts.at("dump_at_exit").is_bool()) {
+            this->dump_profile_at_exit = opts.at("dump_at_exit").as_bool();
+        }
+        if (opts.contains("trace") && opts.at("trace").is_string() && !opts.at("trace").as_string().empty()) {
+            const std::filesystem::path trace_path = Locate::currentDirectory() / opts.at("trace").as_string().c_str();
+            this->profiler->startTrace(trace_path);
+            this->logger->info("[function] Tracing binding calls to " + trace_path.string());
+        }
     }
-}
-
-json::value WF::processInput(const json::object& input) {
-    if (input.contains("__encoding_type__") && input.at("__encoding_type__").is_string() && input.contains("__val__")) {
-        if (input.at("__encoding_type__").as_string() == "base64" && input.at("__val__").is_array()) {
-            std::stringstream ss;
-            for (const auto& item : input.at("__val__").as_array()) {
-                ss << char(item.as_int64());
-            }
-            return json::value(ss.str());
+    // info.json "events": { "frame_ms": 16.7, "throttle": { "onMove": 50 } }
+    const json::value event_opts = this->app->info->getProperty("events");
+    if (event_opts.is_object()) {
+        const json::object& opts = event_opts.as_object();
+        if (opts.contains("frame_ms") && opts.at("frame_ms").is_number()) {
+            const double frame_ms = std::max(0.0, opts.at("frame_ms").to_number<double>());
+            this->app->w->set_event_frame_interval(std::chrono::microseconds(static_cast<int64_t>(frame_ms * 1000)));
         }
-        throw std::runtime_error("[function] Unsupported encoding type in processInput(json::object): " + std::string(input.at("__encoding_type__").as_string()));
-    } else {
-        json::object processed_input;
-        for (const auto& item : input) {
-            processed_input[item.key()] = this->processInput(item.value());
+        if (opts.contains("throttle") && opts.at("throttle").is_object()) {
+            for (const auto& [event, interval] : opts.at("throttle").as_object()) {
+                if (!interval.is_number()) {
+                    this->logger->warn("[function] Ignoring non-numeric event throttle for " + std::string(event));
+                    continue;
+                }
+                this->app->w->set_event_throttle(std::string(event), std::chrono::milliseconds(static_cast<int64_t>(interval.to_number<double>())));
+            }
         }
-        return processed_input;
     }
+    this->bindDefaults();
 }
 
-json::value WF::processInput(const json::array& input) {
-    json::array processed_input;
-    for (const auto& item : input) {
-        processed_input.push_back(this->processInput(item));
+WF::~WindowFunctions() {
+    // Join workers before the callback maps they run are destroyed; queued calls are rejected
+    this->blocking_task_manager.reset();
+    this->task_manager.reset();
+    try {
+        if (auto trace_path = this->profiler->stopTrace()) {
+            this->logger->info("[function] Wrote binding trace to " + trace_path->string());
+        }
+    } catch (const std::exception& e) {
+        this->logger->error(e.what());
+    }
+    if (this->dump_profile_at_exit) {
+        this->logger->info("[function] Binding profile: " + this->profiler->summary());
     }
-    return processed_input;
 }
 
 json::value WF::formatOutput(const json::value& output) {
@@ -447,7 +427,7 @@ json::value WF::formatOutput(const json::value& output) {
     json::object formatted_output_obj;
     switch (output.kind()) {
         case json::kind::string:
-            return this->formatOutput(output.as_string().c_str());
+            return Encoding::encodeString(std::string_view(output.as_string().data(), output.as_string().size()));
         case json::kind::int64:
         case json::kind::uint64:
         case json::kind::double_:
@@ -460,6 +440,9 @@ json::value WF::formatOutput(const json::value& output) {
             }
             return formatted_output_arr;
         case json::kind::object:
+            if (Encoding::isEncoded(output.as_object())) {
+                return output;
+            }
             for (const auto& item : output.as_object()) {
                 formatted_output_obj[item.key()] = this->formatOutput(item.value());
             }
@@ -470,15 +453,7 @@ json::value WF::formatOutput(const json::value& output) {
 }
 
 json::value WF::formatOutput(const std::string& output) {
-    json::object formatted_output = {
-        {"__encoding_type__", "base64"},
-        {"__val__", json::array()}
-    };
-    json::array& val_array = formatted_output["__val__"].as_array() ;
-    for (const char& ch : output) {
-        val_array.push_back(static_cast<int64_t>(ch));
-    }
-    return formatted_output;
+    return Encoding::encodeString(output);
 }
 
 template <typename T>
@@ -507,19 +482,109 @@ json::value WF::getSingleParameter(const json::value& param) {
     }
 }
 
+json::value WF::runBinding(const std::string& fn_name, const json::value& args) {
+    for (CM* cm : {
+        this->window_callbacks.get(), this->log_callbacks.get(), this->filesystem_callbacks.get(),
+        this->config_callbacks.get(), this->system_callbacks.get(), this->process_callbacks.get(),
+        this->debug_callbacks.get(), this->network_callbacks.get(), this->navigate_callbacks.get(),
+        this->plugin_callbacks.get()
+    }) {
+        const auto& map = cm->getMap();
+        auto it = map.find(fn_name);
+        if (it != map.end()) {
+            return it->second(args);
+        }
+    }
+    if (startsWith(fn_name, "get_") && this->getsets->getMap().count(fn_name.substr(4)) > 0) {
+        return this->getsets->out(fn_name.substr(4));
+    } else if (startsWith(fn_name, "set_") && this->getsets->getMap().count(fn_name.substr(4)) > 0) {
+        this->getsets->in(fn_name.substr(4), args);
+        return json::value(nullptr);
+    }
+    throw std::runtime_error("No binding found for " + fn_name);
+}
+
+json::value WF::runBatch(const json::value& calls) {
+    if (!calls.is_array()) {
+        throw std::runtime_error("[function] batch expects an array of { fn, args } objects");
+    }
+    json::array results;
+    results.reserve(calls.as_array().size());
+    for (const auto& call : calls.as_array()) {
+        json::object result;
+        try {
+            const json::object& obj = call.as_object();
+            const std::string fn_name = obj.at("fn").as_string().c_str();
+            const json::value* args = obj.if_contains("args");
+            result["value"] = this->formatOutput(this->runBinding(fn_name, (args != nullptr) ? *args : json::value(json::array())));
+            result["ok"] = true;
+        } catch (const std::exception& e) {
+            this->logger->error(std::string("[function] batch: ") + e.what());
+            result["ok"] = false;
+            result["error"] = e.what();
+        }
+        results.push_back(std::move(result));
+    }
+    this->logger->trace("[function] Ran batch of " + std::to_string(results.size()) + " calls");
+    return results;
+}
+
 WF* WF::bindFunction(const std::string& fn_name, std::function<std::string(std::string)> fn) {
-    this->app->w->bind(fn_name, [this, fn_name, fn](const std::string& req) -> std::string {
+    BindingProfiler::Slot* slot = this->profiler->slot(fn_name);
+    this->app->w->bind(fn_name, [this, fn_name, fn, slot](const std::string& req) -> std::string {
+        BindingProfiler::Call call(this->profiler.get(), slot, req.size());
         if (startsWith(fn_name, "BIND_") && !startsWith(fn_name, "BIND_log_") && fn_name != "BIND_terminate") {
-            if (!isTrustedExecutionContext(this->app)) {
+            if (!this->isTrustedExecutionContext()) {
                 this->logger->warn("[security] Blocked native binding call from untrusted context: " + fn_name);
+                BindingProfiler::Call::failed();
                 return json::serialize(this->formatOutput(nullptr));
             }
         }
-        return fn(req);
+        std::string res = fn(req);
+        call.setResponseBytes(res.size());
+        return res;
     });
     this->logger->trace("[function] Bound " + fn_name);
     return this;
 }
+WF* WF::bindAsyncFunction(const std::string& fn_name, std::function<std::string(std::string)> fn, bool blocking) {
+    BindingProfiler::Slot* slot = this->profiler->slot(fn_name);
+    this->app->w->bind_async(fn_name, [this, fn_name, fn, slot, blocking](const std::string& id, const std::string& req) {
+        if (startsWith(fn_name, "BIND_") && !startsWith(fn_name, "BIND_log_") && fn_name != "BIND_terminate") {
+            if (!this->isTrustedExecutionContext()) {
+                this->logger->warn("[security] Blocked native binding call from untrusted context: " + fn_name);
+                this->app->w->resolve(id, 0, json::serialize(this->formatOutput(nullptr)));
+                return;
+            }
+        }
+        RenWeb::TaskManager* lane = blocking ? this->blocking_task_manager.get() : this->task_manager.get();
+        const bool queued = lane->submit(fn_name, [this, id, req, fn, slot]() {
+            std::string res;
+            {
+                BindingProfiler::Call call(this->profiler.get(), slot, req.size());
+                res = fn(req);
+                call.setResponseBytes(res.size());
+            }
+            this->app->w->resolve(id, 0, res);
+        }, [this, id, fn_name]() {
+            // Never started: reject so the page isn't left awaiting a promise that can't settle
+            this->app->w->resolve(id, 1, json::serialize(json::value(fn_name + " was cancelled because the app is shutting down")));
+        });
+        if (!queued) {
+            this->logger->error("[function] Worker queue is full, rejecting " + fn_name);
+            BindingProfiler::Call call(this->profiler.get(), slot, req.size());
+            BindingProfiler::Call::failed();
+            this->app->w->resolve(id, 0, json::serialize(this->formatOutput(nullptr)));
+        }
+    });
+    this->logger->trace("[function] Bound " + fn_name + " (async)");
+    return this;
+}
+WF* WF::runsAsync(const std::string& key, bool blocking) {
+    this->async_callbacks.insert(key);
+    if (blocking) this->blocking_callbacks.insert(key);
+    return this;
+}
 WF* WF::unbindFunction(const std::string& fn_name) {
     this->app->w->unbind(fn_name);
     this->logger->trace("[function] Unbound " + fn_name);
@@ -530,14 +595,25 @@ WF* WF::bindDefaults() {
         for (const auto& entry : cm->getMap()) {
             const auto& key = entry.first;
             const auto& fn = entry.second;
-            this->bindFunction("BIND_" + key, [fn, this](const std::string& req) -> std::string {
+            auto binding = [fn, this](const std::string& req) -> std::string {
                 try {
-                    return json::serialize(this->formatOutput(fn(this->processInput(req))));
+                    const json::storage_ptr arena = Transcoder::makeArena(req.size());
+                    const json::value args = Transcoder::decode(req, arena);
+                    BindingProfiler::Call::decoded();
+                    const json::value result = fn(args);
+                    BindingProfiler::Call::executed();
+                    return Transcoder::encode(result);
                 } catch (const std::exception& e) {
                     this->logger->error(std::string("[function] ") + e.what());
+                    BindingProfiler::Call::failed();
                     return json::serialize(this->formatOutput(nullptr));
                 }
-            });
+            };
+            if (this->async_callbacks.count(key) > 0) {
+                this->bindAsyncFunction("BIND_" + key, binding, this->blocking_callbacks.count(key) > 0);
+            } else {
+                this->bindFunction("BIND_" + key, binding);
+            }
         }
     };
     auto bindIOMs = [this](IOM* iom)-> void {
@@ -547,17 +623,25 @@ WF* WF::bindDefaults() {
             this->bindFunction("BIND_get_" + key, [pair, this](const std::string& req) -> std::string {
                 (void)req;
                 try {
-                    return json::serialize(this->formatOutput(pair.first()));
+                    BindingProfiler::Call::decoded();
+                    const json::value result = pair.first();
+                    BindingProfiler::Call::executed();
+                    return Transcoder::encode(result);
                 } catch (const std::exception& e) {
                     this->logger->error(std::string("[function] ") + e.what());
+                    BindingProfiler::Call::failed();
                     return json::serialize(this->formatOutput(nullptr));
                 }
             })
             ->bindFunction("BIND_set_" + key, [pair, this](const std::string& req) -> std::string {
                 try {
-                    pair.second(this->processInput(req));
+                    const json::value value = Transcoder::decode(req, Transcoder::makeArena(req.size()));
+                    BindingProfiler::Call::decoded();
+                    pair.second(value);
+                    BindingProfiler::Call::executed();
                 } catch (const std::exception& e) {
                     this->logger->error(std::string("[function] ") + e.what());
+                    BindingProfiler::Call::failed();
                 }
                 return json::serialize(this->formatOutput(nullptr));
             });
@@ -574,6 +658,20 @@ WF* WF::bindDefaults() {
     bindCMs(this->network_callbacks.get());
     bindCMs(this->navigate_callbacks.get());
     bindCMs(this->plugin_callbacks.get());
+    this->bindFunction("BIND_batch", [this](const std::string& req) -> std::string {
+        try {
+            const json::storage_ptr arena = Transcoder::makeArena(req.size());
+            const json::value calls = this->getSingleParameter(Transcoder::decode(req, arena));
+            BindingProfiler::Call::decoded();
+            const json::value results = this->runBatch(calls);
+            BindingProfiler::Call::executed();
+            return json::serialize(results);
+        } catch (const std::exception& e) {
+            this->logger->error(std::string("[function] ") + e.what());
+            BindingProfiler::Call::failed();
+            return json::serialize(this->formatOutput(nullptr));
+        }
+    });
     return this;
 }
 json::value WF::get(const std::string& property) {
@@ -1484,6 +1582,7 @@ WF* WF::setWindowCallbacks() {
         std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
             (void)req;
             this->app->config->current_page = this->app->config->initial_page;
+            this->app->ws->refreshCachePolicy();
             this->app->w->navigate(this->app->ws->getURL());
             return json::value(nullptr);
     }))->add("current_page",
@@ -1497,7 +1596,7 @@ WF* WF::setWindowCallbacks() {
     }))->add("reload_page",
         std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
             (void)req;
-            if (isUriLike(this->app->config->current_page)) {
+            if (TrustRules::isUriLike(this->app->config->current_page)) {
                 this->logger->info("[function] Reloading URI " + this->app->config->current_page);
                 this->app->w->navigate(this->app->config->current_page);
             } else {
@@ -1518,10 +1617,10 @@ WF* WF::setWindowCallbacks() {
                     page = "_"; 
                 }
             }
-            if (isUriLike(page)) {
-                const auto origins = this->app->info->getProperty("origins");
-                if (isOriginAllowlisted(page, origins)) {
+            if (TrustRules::isUriLike(page)) {
+                if (this->isOriginAllowlisted(page)) {
                     this->app->config->current_page = page;
+                    this->app->ws->refreshCachePolicy();
                     this->logger->info("[function] Navigating to external URI " + page);
                     this->app->w->navigate(page);
                 } else {
@@ -1530,6 +1629,7 @@ WF* WF::setWindowCallbacks() {
                 }
             } else {
                 if (page != "_") this->app->config->current_page = page;
+                this->app->ws->refreshCachePolicy();
                 this->logger->info("[function] Navigating to page " + page);
                 this->app->w->navigate(this->app->ws->getURL());
             }
@@ -1587,7 +1687,7 @@ WF* WF::setWindowCallbacks() {
                         }
                         webview2_16->Release();
                     } else {
-                        this->app->w->eval("window.print();");
+                        this->app->w->queue_eval("window.print();");
                         this->logger->info("[function] WebView2 Runtime < 1.0.1462, using window.print() fallback");
                     }
                 }
@@ -1787,7 +1887,7 @@ WF* WF::setWindowCallbacks() {
             }
             
             std::string js = "window.find('" + escaped_text + "', false, false, true, false, true, false);";
-            this->app->w->eval(js);
+            this->app->w->queue_eval(js);
             this->logger->debug("[function] Searching for: " + search_text);
         #elif defined(__APPLE__)
             auto window_result = this->app->w->window();
@@ -1840,10 +1940,10 @@ WF* WF::setWindowCallbacks() {
             }
         #if defined(_WIN32)
             std::string js = "window.find('" + escaped_text + "', false, false, true, false, true, false);";
-            this->app->w->eval(js);
+            this->app->w->queue_eval(js);
         #elif defined(__APPLE__)
             std::string js = "window.find('" + escaped_text + "', false, false, true, false, true, false);";
-            this->app->w->eval(js);
+            this->app->w->queue_eval(js);
         #elif defined(__linux__)
             auto webview_widget = this->app->w->widget().value();
             WebKitFindController* find_controller = webkit_web_view_get_find_controller(WEBKIT_WEB_VIEW(webview_widget));
@@ -1867,10 +1967,10 @@ WF* WF::setWindowCallbacks() {
             }
         #if defined(_WIN32)
             std::string js = "window.find('" + escaped_text + "', false, true, true, false, true, false);";
-            this->app->w->eval(js);
+            this->app->w->queue_eval(js);
         #elif defined(__APPLE__)
             std::string js = "window.find('" + escaped_text + "', false, true, true, false, true, false);";
-            this->app->w->eval(js);
+            this->app->w->queue_eval(js);
         #elif defined(__linux__)
             auto webview_widget = this->app->w->widget().value();
             WebKitFindController* find_controller = webkit_web_view_get_find_controller(WEBKIT_WEB_VIEW(webview_widget));
@@ -1883,7 +1983,7 @@ WF* WF::setWindowCallbacks() {
         #if defined(_WIN32)
             // Clear selection by collapsing the range
             std::string js = "if (window.getSelection) { window.getSelection().removeAllRanges(); }";
-            this->app->w->eval(js);
+            this->app->w->queue_eval(js);
         #elif defined(__APPLE__)
             auto window_result = this->app->w->window();
             if (window_result.has_value()) {
@@ -1913,7 +2013,7 @@ WF* WF::setWindowCallbacks() {
                     }
                     // Always clear JS-based selection (from find_next / find_previous).
                     std::string js = "if (window.getSelection) { window.getSelection().removeAllRanges(); }";
-                    this->app->w->eval(js);
+                    this->app->w->queue_eval(js);
                 }
             }
         #elif defined(__linux__)
@@ -1967,9 +2067,8 @@ WF* WF::setLogCallbacks() {
 #pragma region FileSystemCallbacks
 WF* WF::setFileSystemCallbacks() {
     this->filesystem_callbacks
-    ->add("read_file",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            std::filesystem::path path(this->getSingleParameter(req).as_string().c_str());
+    ->add<json::value(std::filesystem::path, BindingOpts::ReadFile)>("read_file",
+        [this](std::filesystem::path path, BindingOpts::ReadFile opts) -> json::value {
             if (!std::filesystem::exists(path)) {
                 this->logger->error("[function] No file exists at " + path.string());
                 return json::value(nullptr);
@@ -1978,30 +2077,41 @@ WF* WF::setFileSystemCallbacks() {
                 this->logger->error("[function] readFile can't read directory contents. Use ls for that.");
                 return json::value(nullptr);
             }
+            // Blob mode: the bytes are served by the web server and only the URL crosses the bridge
+            if (opts.blob) {
+                std::error_code ec;
+                const auto size = std::filesystem::file_size(path, ec);
+                if (ec) {
+                    this->logger->error("[function] Failed to stat file " + path.string() + ": " + ec.message());
+                    return json::value(nullptr);
+                }
+                const std::string token = this->app->ws->registerBlob(std::filesystem::absolute(path));
+                this->logger->debug("[function] Registered blob for " + path.string() + " (" + std::to_string(size) + " bytes)");
+                return json::object{
+                    {"url", this->app->ws->getURL() + "/??blob=" + token},
+                    {"size", static_cast<uint64_t>(size)}
+                };
+            }
             std::ifstream file(path, std::ios::binary);
             if (!file.good()) {
                 this->logger->error("[function] Failed to open file for reading: " + path.string());
                 return json::value(nullptr);
             }
-            std::vector<char> buffer(std::istreambuf_iterator<char>(file), {});
+            std::string contents(std::istreambuf_iterator<char>(file), {});
             file.close();
-            this->logger->debug("[function] Read " + std::to_string(buffer.size()) + " bytes from " + path.string());
+            this->logger->debug("[function] Read " + std::to_string(contents.size()) + " bytes from " + path.string());
             
-            std::string contents(buffer.begin(), buffer.end());
-            return json::value(contents);
-    }))->add("write_file",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            std::filesystem::path path(params[0].as_string().c_str());
-            std::string contents(params[1].as_string().c_str());
-            bool append = params[2].as_object().at("append").as_bool();
+            return json::value(std::move(contents));
+    })->add<bool(std::filesystem::path, std::string_view, BindingOpts::WriteFile)>("write_file",
+        [this](std::filesystem::path path, std::string_view contents, BindingOpts::WriteFile opts) -> bool {
+            const bool append = opts.append;
             
             std::ios::openmode mode = std::ios::binary;
             mode |= append ? std::ios::app : std::ios::trunc;
             
             if (std::filesystem::is_directory(path)) {
                 this->logger->error("[function] Can't write to a directory " + path.string());
-                return json::value(false);
+                return false;
             } 
             
             
@@ -2011,13 +2121,13 @@ WF* WF::setFileSystemCallbacks() {
                 std::filesystem::create_directories(parent_path, ec);
                 if (ec) {
                     this->logger->error("[function] " + ec.message());
-                    return json::value(false);
+                    return false;
                 }
             }
             std::ofstream file(path, mode);
             if (file.bad()) {
                 this->logger->error("[function] Bad file " + path.string());
-                return json::value(false);
+                return false;
             }
             if (contents.empty()) {
                 this->logger->debug("[function] Input content empty. Attempting empty write.");
@@ -2025,39 +2135,34 @@ WF* WF::setFileSystemCallbacks() {
             file.write(contents.data(), contents.size());
             file.close();
             this->logger->debug(std::string("[function] ") +(append ? "Appended " : "Wrote ") + std::to_string(contents.size()) + " bytes to " + path.string());
-            return json::value(true);
-    }))->add("exists",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            std::filesystem::path path(this->getSingleParameter(req).as_string().c_str());
-            return json::value(std::filesystem::exists(path));
-    }))->add("is_dir",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            std::filesystem::path path(this->getSingleParameter(req).as_string().c_str());
-            return json::value(std::filesystem::is_directory(path));
-    }))->add("mk_dir",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            std::filesystem::path path(this->getSingleParameter(req).as_string().c_str());
+            return true;
+    })->add<bool(std::filesystem::path)>("exists",
+        [](std::filesystem::path path) -> bool {
+            return std::filesystem::exists(path);
+    })->add<bool(std::filesystem::path)>("is_dir",
+        [](std::filesystem::path path) -> bool {
+            return std::filesystem::is_directory(path);
+    })->add<bool(std::filesystem::path)>("mk_dir",
+        [this](std::filesystem::path path) -> bool {
             if (std::filesystem::exists(path)) {
                 this->logger->error("[function] File/dir already exists at '" + path.string() + "'");
-                return json::value(false);
+                return false;
             }
             std::error_code ec;
             std::filesystem::create_directories(path, ec);
             if (ec) {
                 this->logger->error("[function] " + ec.message());
-                return json::value(false);
+                return false;
             }
-            return json::value(true);
-    }))->add("rm",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            std::filesystem::path path(params[0].as_string().c_str());
-            bool recursive = params[1].as_object().at("recursive").as_bool();
+            return true;
+    })->add<bool(std::filesystem::path, BindingOpts::Remove)>("rm",
+        [this](std::filesystem::path path, BindingOpts::Remove opts) -> bool {
+            const bool recursive = opts.recursive;
             
             std::error_code ec;
             if (!std::filesystem::exists(path)) {
                 this->logger->error("[function] Cannot delete file/dir that doesn't exist: " + path.string());
-                return json::value(false);
+                return false;
             } else if (std::filesystem::is_directory(path)) {
                 if (recursive) {
                     std::filesystem::remove_all(path, ec);
@@ -2066,19 +2171,18 @@ WF* WF::setFileSystemCallbacks() {
                 }
                 if (ec) {
                     this->logger->error("[function] " + ec.message());
-                    return json::value(false);
+                    return false;
                 }
-                return json::value(true);
+                return true;
             }
             std::filesystem::remove(path, ec);
             if (ec) {
                 this->logger->error("[function] " + ec.message());
-                return json::value(false);
+                return false;
             }
-            return json::value(true);
-    }))->add("ls",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            std::filesystem::path path(this->getSingleParameter(req).as_string().c_str());
+            return true;
+    })->add<json::value(std::filesystem::path)>("ls",
+        [this](std::filesystem::path path) -> json::value {
             if (!std::filesystem::is_directory(path)) {
                 this->logger->error("[function] Path entered to ls wasn't a dir: " + path.string());
                 return json::value(nullptr);
@@ -2093,20 +2197,17 @@ WF* WF::setFileSystemCallbacks() {
                 return json::value(nullptr);
             }
             return json::value(array);
-    }))->add("rename",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            std::filesystem::path orig_path(params[0].as_string().c_str());
-            std::filesystem::path new_path(params[1].as_string().c_str());
-            bool overwrite = params[2].as_object().at("overwrite").as_bool();
+    })->add<bool(std::filesystem::path, std::filesystem::path, BindingOpts::Overwrite)>("rename",
+        [this](std::filesystem::path orig_path, std::filesystem::path new_path, BindingOpts::Overwrite opts) -> bool {
+            const bool overwrite = opts.overwrite;
             
             std::error_code ec;
             if (!std::filesystem::exists(orig_path)) {
                 this->logger->error("[function] Can't rename path that doesn't exist: " + orig_path.string());
-                return json::value(false);
+                return false;
             } else if (std::filesystem::exists(new_path) && !overwrite) {
                 this->logger->error("[function] Can't overwrite already-existing new path if settings.overwrite is false: " + new_path.string());
-                return json::value(false);
+                return false;
             } else if (std::filesystem::exists(new_path)) {
                 if (std::filesystem::is_directory(new_path)) {
                     std::filesystem::remove_all(new_path, ec);
@@ -2115,7 +2216,7 @@ WF* WF::setFileSystemCallbacks() {
                 }
                 if (ec) {
                     this->logger->error("[function] " + ec.message());
-                    return json::value(false);
+                    return false;
                 }
             }
             const std::filesystem::path new_parent = new_path.parent_path();
@@ -2123,7 +2224,7 @@ WF* WF::setFileSystemCallbacks() {
                 std::filesystem::create_directories(new_parent, ec);
                 if (ec) {
                     this->logger->error("[function] " + ec.message());
-                    return json::value(false);
+                    return false;
                 }
             }
             std::filesystem::rename(orig_path, new_path, ec);
@@ -2136,35 +2237,32 @@ WF* WF::setFileSystemCallbacks() {
                     std::filesystem::copy(orig_path, new_path, opts, ec);
                     if (ec) {
                         this->logger->error("[function] Cross-device copy failed: " + ec.message());
-                        return json::value(false);
+                        return false;
                     }
                     std::filesystem::is_directory(orig_path)
                         ? std::filesystem::remove_all(orig_path, ec)
                         : std::filesystem::remove(orig_path, ec);
                     if (ec) {
                         this->logger->error("[function] Cross-device remove source failed: " + ec.message());
-                        return json::value(false);
+                        return false;
                     }
                 } else {
                     this->logger->error("[function] " + ec.message());
-                    return json::value(false);
+                    return false;
                 }
             }
-            return json::value(true);
-    }))->add("copy",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            std::filesystem::path orig_path(params[0].as_string().c_str());
-            std::filesystem::path new_path(params[1].as_string().c_str());
-            bool overwrite = params[2].as_object().at("overwrite").as_bool();
+            return true;
+    })->add<bool(std::filesystem::path, std::filesystem::path, BindingOpts::Overwrite)>("copy",
+        [this](std::filesystem::path orig_path, std::filesystem::path new_path, BindingOpts::Overwrite opts) -> bool {
+            const bool overwrite = opts.overwrite;
             
             std::error_code ec;
             if (!std::filesystem::exists(orig_path)) {
                 this->logger->error("[function] Can't copy path that doesn't exist: " + orig_path.string());
-                return json::value(false);
+                return false;
             } else if (std::filesystem::exists(new_path) && !overwrite) {
                 this->logger->error("[function] Can't overwrite already-existing new path if settings.overwrite is false: " + new_path.string());
-                return json::value(false);
+                return false;
             } else if (std::filesystem::exists(new_path)) {
                 if (std::filesystem::is_directory(new_path)) {
                     std::filesystem::remove_all(new_path, ec);
@@ -2173,7 +2271,7 @@ WF* WF::setFileSystemCallbacks() {
                 }
                 if (ec) {
                     this->logger->error("[function] " + ec.message());
-                    return json::value(false);
+                    return false;
                 }
             }
             const std::filesystem::path new_parent = new_path.parent_path();
@@ -2181,7 +2279,7 @@ WF* WF::setFileSystemCallbacks() {
                 std::filesystem::create_directories(new_parent, ec);
                 if (ec) {
                     this->logger->error("[function] " + ec.message());
-                    return json::value(false);
+                    return false;
                 }
             }
             if (std::filesystem::is_directory(orig_path)) {
@@ -2191,19 +2289,15 @@ WF* WF::setFileSystemCallbacks() {
             }
             if (ec) {
                 this->logger->error("[function] " + ec.message());
-                return json::value(false);
-            }
-            return json::value(true);
-    }))->add("get_application_dir_path",
-        std::function<json::value(const json::value&)>([](const json::value& req) -> json::value {
-            (void)req;
-            return json::value(Locate::currentDirectory().string());
-    }))->add("get_tmp_dir_path",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::value param = this->getSingleParameter(req);
-            bool create = (param.is_object() && param.as_object().contains("create"))
-                ? param.as_object().at("create").as_bool()
-                : false;
+                return false;
+            }
+            return true;
+    })->add<std::string()>("get_application_dir_path",
+        []() -> std::string {
+            return Locate::currentDirectory().string();
+    })->add<std::string(BindingOpts::TmpDir)>("get_tmp_dir_path",
+        [this](BindingOpts::TmpDir opts) -> std::string {
+            const bool create = opts.create;
             const std::filesystem::path tmp_path = Locate::tempDirectory() / ".renweb" / "proc" / std::to_string(this->app->procm->getPid()) / ".session";
             if (create) {
                 std::error_code ec;
@@ -2212,55 +2306,38 @@ WF* WF::setFileSystemCallbacks() {
                     this->logger->error("[function] Tried to create tmp directory but failed: " + ec.message());
                 }
             }
-            return json::value(tmp_path.string());
-    }))->add("choose_files",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            bool multiple = false;
-            bool directories = false;
+            return tmp_path.string();
+    })->add<json::value(BindingArgs::Lenient<BindingOpts::ChooseFiles>)>("choose_files",
+        [this](BindingArgs::Lenient<BindingOpts::ChooseFiles> lenient_opts) -> json::value {
+            BindingOpts::ChooseFiles& opts = lenient_opts.value;
+            const bool multiple = opts.multiple.value;
+            const bool directories = opts.directories.value;
             std::vector<std::string> extensions;
 
-            json::value param = this->getSingleParameter(req);
-            if (param.is_object()) {
-                const json::object& options = param.as_object();
-                if (options.contains("multiple") && options.at("multiple").is_bool()) {
-                    multiple = options.at("multiple").as_bool();
+            for (std::string& extension : opts.extensions.value) {
+                const size_t first_non_whitespace = extension.find_first_not_of(" \t\r\n");
+                if (first_non_whitespace == std::string::npos) {
+                    continue;
                 }
-                if (options.contains("directories") && options.at("directories").is_bool()) {
-                    directories = options.at("directories").as_bool();
+                extension.erase(0, first_non_whitespace);
+                extension.erase(extension.find_last_not_of(" \t\r\n") + 1);
+                if (extension.empty()) {
+                    continue;
                 }
-                if (options.contains("extensions") && options.at("extensions").is_array()) {
-                    const json::array& extension_values = options.at("extensions").as_array();
-                    for (const json::value& extension_value : extension_values) {
-                        if (!extension_value.is_string()) {
-                            continue;
-                        }
-
-                        std::string extension = extension_value.as_string().c_str();
-                        const size_t first_non_whitespace = extension.find_first_not_of(" \t\r\n");
-                        if (first_non_whitespace == std::string::npos) {
-                            continue;
-                        }
-                        extension.erase(0, first_non_whitespace);
-                        extension.erase(extension.find_last_not_of(" \t\r\n") + 1);
-                        if (extension.empty()) {
-                            continue;
-                        }
-                        if (extension == "*" || extension == "*.*") {
-                            extensions.clear();
-                            break;
-                        }
-                        if (startsWith(extension, "*.")) {
-                            extension.erase(0, 2);
-                        } else if (!extension.empty() && extension.front() == '.') {
-                            extension.erase(0, 1);
-                        }
-                        if (extension.empty()) {
-                            continue;
-                        }
-                        if (std::find(extensions.begin(), extensions.end(), extension) == extensions.end()) {
-                            extensions.push_back(extension);
-                        }
-                    }
+                if (extension == "*" || extension == "*.*") {
+                    extensions.clear();
+                    break;
+                }
+                if (startsWith(extension, "*.")) {
+                    extension.erase(0, 2);
+                } else if (!extension.empty() && extension.front() == '.') {
+                    extension.erase(0, 1);
+                }
+                if (extension.empty()) {
+                    continue;
+                }
+                if (std::find(extensions.begin(), extensions.end(), extension) == extensions.end()) {
+                    extensions.push_back(extension);
                 }
             }
 
@@ -2482,22 +2559,9 @@ WF* WF::setFileSystemCallbacks() {
             g_object_unref(dialog);
             return format_paths(paths);
         #endif
-    }))->add("download_uri",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            std::string uri;
-            std::string destination_path;
-
-            if (req.is_array()) {
-                const json::array& params = req.as_array();
-                if (!params.empty() && params[0].is_string()) {
-                    uri = params[0].as_string().c_str();
-                }
-                if (params.size() > 1 && params[1].is_string()) {
-                    destination_path = params[1].as_string().c_str();
-                }
-            } else if (req.is_string()) {
-                uri = req.as_string().c_str();
-            }
+    })->add<json::value(std::string, std::optional<std::string>)>("download_uri",
+        [this](std::string uri, std::optional<std::string> destination) -> json::value {
+            const std::string destination_path = destination.value_or("");
 
             if (uri.empty()) {
                 this->logger->error("[function] downloadUri requires a non-empty URI");
@@ -2607,8 +2671,10 @@ WF* WF::setFileSystemCallbacks() {
             }
         #endif
             return json::value(nullptr);
-    }));
-
+    });
+    this->runsAsync("read_file")
+        ->runsAsync("copy")
+        ->runsAsync("rm");
     return this;
 }
 #pragma endregion
@@ -2652,18 +2718,21 @@ WF* WF::setConfigCallbacks() {
             } else {
                 this->logger->error("[function] Current config is malformed. Cannot save!");
             }
+            this->app->ws->refreshCachePolicy();
             return json::value(nullptr);
     }))->add("set_config_property",
         std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
             json::array params = req.as_array();
             std::string key = params[0].as_string().c_str();
             this->app->config->setProperty(key, std::move(params[1]));
+            this->app->ws->refreshCachePolicy();
             return json::value(nullptr);
     }))->add("reset_to_defaults",
         std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
             (void)req;
             auto defaults_json = this->app->config->getDefaultsJson();
             this->app->config->update((defaults_json.is_object()) ? defaults_json.as_object() : json::object());
+            this->app->ws->refreshCachePolicy();
             return json::value(nullptr);
     }));
     return this;
@@ -2724,44 +2793,20 @@ WF* WF::setSystemCallbacks() {
 #pragma endregion
 #pragma region ProcessCallbacks
 WF* WF::setProcessCallbacks() {
-    this->process_callbacks->add("create_window",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            std::vector<std::string> pages;
-            for (const auto& page : params[0].as_array()) {
-                pages.push_back(page.as_string().c_str());
-            }
-            std::vector<std::string> args;
-            for (const auto& page : params[1].as_array()) {
-                args.push_back(page.as_string().c_str());
-            }
-            bool is_detachable = params[2].as_object().at("is_detachable").as_bool();
-            bool share_stdio = params[2].as_object().at("share_stdio").as_bool();
-            bool include_orig_args = params[2].as_object().at("include_orig_args").as_bool();
-            return this->app->procm->createRenWebProcess(pages, args, is_detachable, include_orig_args, share_stdio);
-    }))->add("create_process",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            std::vector<std::string> args;
-            for (const auto& page : params[0].as_array()) {
-                args.push_back(page.as_string().c_str());
-            }
-            bool is_detachable = params[1].as_object().at("is_detachable").as_bool();
-            bool share_stdio = params[1].as_object().at("share_stdio").as_bool();
-            return this->app->procm->createSystemProcess(args, is_detachable, share_stdio);
-    }))->add("dump_process",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            Pid pid = static_cast<Pid>(params[0].as_int64());
+    this->process_callbacks->add<json::object(std::vector<std::string>, std::vector<std::string>, BindingOpts::CreateWindow)>("create_window",
+        [this](std::vector<std::string> pages, std::vector<std::string> args, BindingOpts::CreateWindow opts) -> json::object {
+            return this->app->procm->createRenWebProcess(pages, std::move(args), opts.is_detachable, opts.include_orig_args, opts.share_stdio);
+    })->add<json::object(std::vector<std::string>, BindingOpts::CreateProcess)>("create_process",
+        [this](std::vector<std::string> args, BindingOpts::CreateProcess opts) -> json::object {
+            return this->app->procm->createSystemProcess(args, opts.is_detachable, opts.share_stdio);
+    })->add<json::object(Pid)>("dump_process",
+        [this](Pid pid) -> json::object {
             return this->app->procm->dumpProcess(pid);
-    }))->add("dump_current_process",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            (void)req;
+    })->add<json::object()>("dump_current_process",
+        [this]() -> json::object {
             return this->app->procm->dumpCurrentProcess();
-    }))->add("dump_processes",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            std::string filter = params[0].as_string().c_str();
+    })->add<json::value(std::string_view)>("dump_processes",
+        [this](std::string_view filter) -> json::value {
             if (filter.empty()) {
                 json::array processes;
                 json::array renweb_processes = this->app->procm->dumpRenWebProcesses();
@@ -2790,54 +2835,47 @@ WF* WF::setProcessCallbacks() {
             } else if (filter == "child") {
                 return this->app->procm->dumpChildProcesses();
             } else {
-                this->logger->error("[function] Invalid filter for dump_processes: " + filter);
+                this->logger->error("[function] Invalid filter for dump_processes: " + std::string(filter));
                 return json::value(nullptr);
             }
-    }))->add("kill_process",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            Pid pid = static_cast<Pid>(params[0].as_int64());
-            int32_t signal = (params[1].is_int64()) ? static_cast<int32_t>(params[1].as_int64()) : SIGINT;
-            this->app->procm->kill(pid, signal);
-            return json::value(nullptr);
-    }))->add("detach_process",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            Pid pid = static_cast<Pid>(params[0].as_int64());
+    })->add<void(Pid, std::optional<int32_t>)>("kill_process",
+        [this](Pid pid, std::optional<int32_t> signal) {
+            this->app->procm->kill(pid, signal.value_or(SIGINT));
+    })->add<void(Pid)>("detach_process",
+        [this](Pid pid) {
             this->app->procm->detach(pid);
-            return json::value(nullptr);
-    }))->add("send_message",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            Pid pid = static_cast<Pid>(params[0].as_int64());
-            json::value message = params[1];
+    })->add<void(Pid, const json::value&)>("send_message",
+        [this](Pid pid, const json::value& message) {
             this->app->procm->send(pid, message);
-            return json::value(nullptr);
-    }))->add("listen_to_output",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            Pid pid = static_cast<Pid>(params[0].as_int64());
-            int64_t lines = (params[1].as_int64() < 0) ? INT64_MAX : params[1].as_int64();
-            bool tail = params[2].as_object().at("tail").as_bool();
-            std::vector<std::string> output = this->app->procm->listen(pid, lines, tail);
-            return (output.size() > 0) ? json::array(output.begin(), output.end()) : json::array();
-    }))->add("wait",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            json::array params = req.as_array();
-            Pid pid = static_cast<Pid>(params[0].as_int64());
-            this->app->procm->wait(pid);
-            return json::value(nullptr);
-    }))->add("wait_all",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            (void)req;
-            this->app->procm->waitAll();
-            return json::value(nullptr);
-    }))->add("get_messages",
-        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
-            (void)req;
-            const std::vector<json::value>& messages = this->app->ws->getMessages();
-            return json::array(messages.begin(), messages.end());
-    }));
+    })->add<json::array(Pid, int64_t, BindingOpts::Listen)>("listen_to_output",
+        [this](Pid pid, int64_t lines, BindingOpts::Listen opts) -> json::array {
+            std::vector<std::string> output = this->app->procm->listen(pid, (lines < 0) ? INT64_MAX : lines, opts.tail);
+            return json::array(output.begin(), output.end());
+    })->add<void(Pid)>("wait",
+        [this](Pid pid) {
+            // Waits in slices so shutdown isn't held up by a process that never exits
+            while (!this->app->procm->waitFor(pid, std::chrono::milliseconds(100))) {
+                if (this->blocking_task_manager->isStopping()) {
+                    throw std::runtime_error("wait: cancelled because the app is shutting down");
+                }
+            }
+    })->add<void()>("wait_all",
+        [this]() {
+            while (!this->app->procm->waitAllFor(std::chrono::milliseconds(100))) {
+                if (this->blocking_task_manager->isStopping()) {
+                    throw std::runtime_error("wait_all: cancelled because the app is shutting down");
+                }
+            }
+    })->add<json::value(std::optional<int64_t>, std::optional<int64_t>)>("get_messages",
+        [this](std::optional<int64_t> since_seq, std::optional<int64_t> max) -> json::value {
+            // Optional [since_seq, max]; with neither, everything still retained
+            return this->app->ws->getMessages(
+                static_cast<uint64_t>(std::max<int64_t>(0, since_seq.value_or(0))),
+                max ? static_cast<size_t>(std::max<int64_t>(0, *max)) : SIZE_MAX);
+    });
+    this->runsAsync("wait", /*blocking=*/true)
+        ->runsAsync("wait_all", /*blocking=*/true)
+        ->runsAsync("dump_processes");
     return this;
 }
 #pragma endregion
@@ -2927,6 +2965,48 @@ WF* WF::setDebugCallbacks() {
             webkit_web_inspector_close(inspector);
         #endif
             return json::value(nullptr);
+    }))->add<json::object()>("get_binding_stats",
+        [this]() -> json::object {
+            return this->profiler->toJson();
+    })->add<json::value(bool, std::optional<std::string>)>("set_binding_trace",
+        [this](bool enabled, std::optional<std::string> path) -> json::value {
+            if (enabled) {
+                const std::filesystem::path trace_path = Locate::currentDirectory() / path.value_or("binding-trace.json");
+                this->profiler->startTrace(trace_path);
+                this->logger->info("[function] Tracing binding calls to " + trace_path.string());
+                return json::value(trace_path.string());
+            }
+            auto written = this->profiler->stopTrace();
+            if (!written) {
+                return json::value(nullptr);
+            }
+            this->logger->info("[function] Wrote binding trace to " + written->string());
+            return json::value(written->string());
+    })->add<json::object()>("get_event_stats",
+        [this]() -> json::object {
+            return this->app->w->get_event_stats();
+    })->add<json::object()>("get_eval_stats",
+        [this]() -> json::object {
+            return this->app->w->get_eval_stats();
+    })->add("get_async_stats",
+        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
+            (void)req;
+            json::object stats = this->task_manager->getStats();
+            stats["blocking"] = this->blocking_task_manager->getStats();
+            return stats;
+    }))->add("get_server_stats",
+        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
+            (void)req;
+            json::object stats = this->app->ws->getStats();
+            stats["peer_directory"] = this->app->procm->getDiscoveryStats();
+            return stats;
+    }))->add("get_server_metrics",
+        std::function<json::value(const json::value&)>([this](const json::value& req) -> json::value {
+            const json::value format = this->getSingleParameter(req);
+            if (format.is_string() && format.as_string() == "prometheus") {
+                return json::value(this->app->ws->getPrometheusMetrics());
+            }
+            return this->app->ws->getMetrics();
     }));
     return this;
 }
@@ -1,19 +1,24 @@
 /**
  * Recursively decodes encoded values in an object structure.
  * Detects objects with __encoding_type__ and __val__ properties and decodes them.
- * Currently supports base64 encoding type.
+ * Supports the "utf8" (plain string) and "base64" (base64 string or legacy byte array) encoding types.
  *
  * @param dec - The value to decode (can be any type)
  * @returns The decoded value with all nested encoded values converted
  *
  * @example
- * // Decodes a base64 encoded string
- * decode({ __encoding_type__: "base64", __val__: [72, 101, 108, 108, 111] })
+ * // Decodes a UTF-8 passthrough string
+ * decode({ __encoding_type__: "utf8", __val__: "Hello" })
+ * // Returns: "Hello"
+ *
+ * @example
+ * // Decodes a base64 encoded string (the legacy byte array form is also accepted)
+ * decode({ __encoding_type__: "base64", __val__: "SGVsbG8=" })
  * // Returns: "Hello"
  *
  * @example
  * // Recursively decodes nested objects
- * decode({ name: { __encoding_type__: "base64", __val__: [74, 111, 104, 110] } })
+ * decode({ name: { __encoding_type__: "utf8", __val__: "John" } })
  * // Returns: { name: "John" }
  */
 declare function decode(dec: any): any;
@@ -23,22 +28,27 @@ declare function decode(dec: any): any;
  * Arrays and objects are processed recursively.
  *
  * @param enc - The value to encode (can be any type)
- * @param options - Encoding options (default: { string: "base64" })
- * @param options.string - The encoding type for strings (default: "base64")
+ * @param options - Encoding options (default: { string: "utf8" })
+ * @param options.string - The encoding type for strings: "utf8" sends the string as-is, "base64" sends its UTF-8 bytes as base64 (default: "utf8")
  * @returns The encoded value with all nested strings converted to encoded format
  *
  * @example
- * // Encodes a string to base64 format
+ * // Encodes a string for the bridge
  * encode("Hello")
- * // Returns: { __encoding_type__: "base64", __val__: [72, 101, 108, 108, 111] }
+ * // Returns: { __encoding_type__: "utf8", __val__: "Hello" }
+ *
+ * @example
+ * // Encodes a string as base64
+ * encode("Hello", { string: "base64" })
+ * // Returns: { __encoding_type__: "base64", __val__: "SGVsbG8=" }
  *
  * @example
  * // Recursively encodes nested objects
  * encode({ name: "John", age: 30 })
- * // Returns: { name: { __encoding_type__: "base64", __val__: [...] }, age: 30 }
+ * // Returns: { name: { __encoding_type__: "utf8", __val__: "John" }, age: 30 }
  */
 declare function encode(enc: any, options?: {
-    string: "base64";
+    string: "utf8" | "base64";
 }): any;
 /**
  * Serializes a value to a string representation.
@@ -54,10 +64,40 @@ declare function encode(enc: any, options?: {
  * serialize(123) // Returns: "123"
  */
 declare function serialize(obj: any): string;
+/**
+ * Runs several native calls in a single bridge round-trip.
+ * Calls run in order and each call's error is isolated, so one failing call
+ * doesn't stop the rest. Arguments are encoded and results decoded automatically.
+ *
+ * @param calls - Ordered list of calls. `fn` is the binding name without the `BIND_` prefix and `args` are its arguments
+ * @returns One result per call, in the same order
+ *
+ * @example
+ * const [size, position] = await batch([
+ *     { fn: "get_size" },
+ *     { fn: "get_position" }
+ * ]);
+ * // size: { ok: true, value: { width: 800, height: 600 } }
+ *
+ * @example
+ * await batch([
+ *     { fn: "set_size", args: [{ width: 800, height: 600 }] },
+ *     { fn: "change_title", args: ["Restored"] }
+ * ]);
+ */
+declare function batch(calls: {
+    fn: string;
+    args?: any[];
+}[]): Promise<{
+    ok: boolean;
+    value?: any;
+    error?: string;
+}[]>;
 export declare const Utils: {
     decode: typeof decode;
     encode: typeof encode;
     serialize: typeof serialize;
+    batch: typeof batch;
 };
 /**
  * Lifecycle callback shape for the runtime `window.renweb` object.
@@ -130,7 +170,8 @@ export interface RenWebCallbacks {
     }) => void | Promise<void>;
     /**
      * Called when a message is received from another RenWeb process via `proc.send()`.
-     * The `msg` parameter will already be decoded.
+     * The `msg` parameter will already be decoded. On pages served by the app, messages arrive in
+     * order over one `/??events` stream that the engine opens at page load.
      * @example
      * window.renweb.onServerMessage = async (msg) => {
      *     await Log.info(`Received from PID ${msg?.sender?.pid}:`, msg?.message);
@@ -140,6 +181,32 @@ export interface RenWebCallbacks {
         sender: Process;
         message: any;
     }) | any) => void | Promise<void>;
+    /**
+     * Called when a message sent with `proc.send()` could not be delivered, either because the
+     * peer did not answer or because too many messages were already queued for it.
+     * @example
+     * window.renweb.onMessageFailed = async ({ to, error }) => {
+     *     await Log.warn(`Message to ${to} failed: ${error}`);
+     * };
+     */
+    onMessageFailed?: (event: {
+        to: string;
+        message: any;
+        error: string;
+    }) => void | Promise<void>;
+    /**
+     * Called when other RenWeb processes appear or go away, after this window has listed them
+     * once with `Process.dumpProcesses()`. `added` holds process info objects, `removed` holds PIDs.
+     * @example
+     * window.renweb.onProcessesChanged = async ({ added, removed }) => {
+     *     await Log.info(`${added.length} windows opened, ${removed.length} closed`);
+     * };
+     */
+    onProcessesChanged?: (event: {
+        generation: number;
+        added: any[];
+        removed: number[];
+    }) => void | Promise<void>;
 }
 /**
  * Helper type for consumers who want explicit typing for `window.renweb`.
@@ -445,6 +512,14 @@ export declare namespace FS {
      * @returns Promise that resolves to file contents or null if file doesn't exist
      */
     function readFile(path: string): Promise<string | null>;
+    /**
+     * Reads the raw bytes of a file without passing them through the JSON bridge.
+     * The engine registers a short-lived, token-protected URL on its web server and the
+     * bytes are streamed straight from disk with `fetch()`. Prefer this for large or binary files.
+     * @param path - Path to the file to read
+     * @returns Promise that resolves to the file's bytes or null if the file can't be read
+     */
+    function readFileBuffer(path: string): Promise<ArrayBuffer | null>;
     /**
      * Writes contents to a file.
      * @param path - Path to the file to write
@@ -842,7 +917,8 @@ export declare class Process {
         share_stdio?: boolean;
     }): Promise<Process | null>;
     /**
-     * Gets messages for a specific process or all messages.
+     * Gets the retained messages from a specific process or from all processes.
+     * Only the newest messages are kept (see `server.inbox_messages` / `server.inbox_bytes`).
      * @param pid - Process ID to get messages for (-1 for all messages)
      * @returns Array of messages
      * @example
@@ -850,6 +926,23 @@ export declare class Process {
      * const procMessages = await Process.getMessages(1234);
      */
     static getMessages(pid?: number): Promise<any[]>;
+    /**
+     * Gets messages received after a sequence number, oldest first. Pass the returned `last_seq`
+     * to the next call to read each message exactly once.
+     * @param since_seq - Return messages with a larger sequence number (0 for the oldest retained)
+     * @param max - Most messages to return
+     * @returns The messages (each with a `seq`), the cursor for the next call, the oldest retained sequence number and how many messages were dropped so far
+     * @example
+     * let cursor = 0;
+     * const { messages, last_seq } = await Process.pollMessages(cursor);
+     * cursor = last_seq;
+     */
+    static pollMessages(since_seq?: number, max?: number): Promise<{
+        messages: any[];
+        last_seq: number;
+        first_seq: number;
+        dropped: number;
+    }>;
     /**
      * Gets detailed information about a specific process.
      * @param pid - Process ID to query
@@ -861,6 +954,8 @@ export declare class Process {
     static dumpProcess(pid: number): Promise<Process | null>;
     /**
      * Gets a list of processes with optional filtering.
+     * Other RenWeb processes are listed from a cache that refreshes in the background, so
+     * their details may be up to `server.peer_cache_ttl_ms` old.
      * @param filter - Filter type: '' (all), 'system' (system processes), 'renweb' (RenWeb processes), 'child' (child processes)
      * @returns Array of Process instances
      * @example
@@ -907,6 +1002,50 @@ export declare namespace Debug {
      * @returns Promise that resolves when devtools are closed
      */
     function closeDevtools(): Promise<void>;
+    /**
+     * Gets statistics for the worker pool that runs long bindings (file copies, process waits, etc.) off the UI thread.
+     * Process waits run on their own lane, reported under `blocking`. Calls still queued at shutdown are rejected.
+     * @returns Promise that resolves to queue depth, counters, queue wait latency and per-binding run latency
+     */
+    function getAsyncStats(): Promise<any>;
+    /**
+     * Gets statistics for the embedded web server, such as hot asset cache usage, hit/miss counts, compression counters and HTTP worker pool load.
+     * @returns Promise that resolves to the server statistics
+     */
+    function getServerStats(): Promise<any>;
+    /**
+     * Gets request metrics for the embedded web server: per-route and per-status counters, bytes sent and latency percentiles.
+     * The same data is served to trusted local clients at `/??metrics` (JSON) and `/??metrics=prometheus`.
+     * @param format - "json" for an object, or "prometheus" for Prometheus text exposition
+     * @returns Promise that resolves to the metrics object, or the Prometheus text
+     */
+    function getServerMetrics(format?: "json" | "prometheus"): Promise<any>;
+    /**
+     * Gets per-binding profile data for every native call made so far: call and error counts, total time split into
+     * decode, execute and encode, latency percentiles and request/response sizes. Bindings are ordered by total time.
+     * @returns Promise that resolves to the profile, keyed by binding name under `bindings`
+     */
+    function getBindingStats(): Promise<any>;
+    /**
+     * Starts or stops recording every native call as Chrome trace spans (open the file in chrome://tracing or Perfetto).
+     * Stopping writes the file.
+     * @param enabled - true to start tracing, false to stop and write the trace
+     * @param path - Trace file, relative to the application directory (default: "binding-trace.json")
+     * @returns Promise that resolves to the trace file path, or null when stopping with no trace running
+     */
+    function setBindingTrace(enabled: boolean, path?: string): Promise<string | null>;
+    /**
+     * Gets window event delivery stats. onMove and onWindowStateChanged are coalesced: only the latest payload per event
+     * is delivered, at most once per frame, and events superseded before delivery are counted as dropped.
+     * @returns Promise that resolves to { frame_ms, posted, delivered, dropped, flushes, pending, events }
+     */
+    function getEventStats(): Promise<any>;
+    /**
+     * Gets stats for the queue that carries native notifications into the page. Scripts queued from any thread are run
+     * together in one eval per main-loop iteration; a growing depth or latency means the UI thread is saturated.
+     * @returns Promise that resolves to { depth, max_depth, queued, wakeups, evals, scripts_per_eval, bytes, latency, eval }
+     */
+    function getEvalStats(): Promise<any>;
 }
 /**
  * Network status and loading information.
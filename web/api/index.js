@@ -32,22 +32,64 @@
 * ---------------Helper Functions----------------
 * -----------------------------------------------
 */
+/**
+ * Converts a base64 string into raw bytes.
+ * Uses the native `Uint8Array.fromBase64` when the engine provides it.
+ *
+ * @param b64 - RFC 4648 base64 text
+ * @returns The decoded bytes
+ */
+function base64ToBytes(b64) {
+    const from_base64 = Uint8Array.fromBase64;
+    if (typeof from_base64 === "function") {
+        return from_base64.call(Uint8Array, b64);
+    }
+    const bin = atob(b64);
+    const bytes = new Uint8Array(bin.length);
+    for (let i = 0; i < bin.length; i++) {
+        bytes[i] = bin.charCodeAt(i);
+    }
+    return bytes;
+}
+/**
+ * Converts raw bytes into a base64 string.
+ * Uses the native `Uint8Array.prototype.toBase64` when the engine provides it.
+ *
+ * @param bytes - The bytes to encode
+ * @returns RFC 4648 base64 text
+ */
+function bytesToBase64(bytes) {
+    if (typeof bytes.toBase64 === "function") {
+        return bytes.toBase64();
+    }
+    const chunk_size = 0x8000;
+    let bin = "";
+    for (let i = 0; i < bytes.length; i += chunk_size) {
+        bin += String.fromCharCode.apply(null, Array.from(bytes.subarray(i, i + chunk_size)));
+    }
+    return btoa(bin);
+}
 /**
  * Recursively decodes encoded values in an object structure.
  * Detects objects with __encoding_type__ and __val__ properties and decodes them.
- * Currently supports base64 encoding type.
+ * Supports the "utf8" (plain string) and "base64" (base64 string or legacy byte array) encoding types.
  *
  * @param dec - The value to decode (can be any type)
  * @returns The decoded value with all nested encoded values converted
  *
  * @example
- * // Decodes a base64 encoded string
- * decode({ __encoding_type__: "base64", __val__: [72, 101, 108, 108, 111] })
+ * // Decodes a UTF-8 passthrough string
+ * decode({ __encoding_type__: "utf8", __val__: "Hello" })
+ * // Returns: "Hello"
+ *
+ * @example
+ * // Decodes a base64 encoded string (the legacy byte array form is also accepted)
+ * decode({ __encoding_type__: "base64", __val__: "SGVsbG8=" })
  * // Returns: "Hello"
  *
  * @example
  * // Recursively decodes nested objects
- * decode({ name: { __encoding_type__: "base64", __val__: [74, 111, 104, 110] } })
+ * decode({ name: { __encoding_type__: "utf8", __val__: "John" } })
  * // Returns: { name: "John" }
  */
 function decode(dec) {
@@ -58,8 +100,12 @@ function decode(dec) {
             }
             else if ("__encoding_type__" in dec && "__val__" in dec) {
                 switch (dec.__encoding_type__) {
+                    case "utf8":
+                        return dec.__val__;
                     case "base64":
-                        return new TextDecoder().decode(new Uint8Array(dec.__val__));
+                        return new TextDecoder().decode(
+                            (typeof dec.__val__ === "string") ? base64ToBytes(dec.__val__) : new Uint8Array(dec.__val__)
+                        );
                     default:
                         return dec;
                 }
@@ -84,34 +130,39 @@ function decode(dec) {
  * Arrays and objects are processed recursively.
  *
  * @param enc - The value to encode (can be any type)
- * @param options - Encoding options (default: { string: "base64" })
- * @param options.string - The encoding type for strings (default: "base64")
+ * @param options - Encoding options (default: { string: "utf8" })
+ * @param options.string - The encoding type for strings: "utf8" sends the string as-is, "base64" sends its UTF-8 bytes as base64 (default: "utf8")
  * @returns The encoded value with all nested strings converted to encoded format
  *
  * @example
- * // Encodes a string to base64 format
+ * // Encodes a string for the bridge
  * encode("Hello")
- * // Returns: { __encoding_type__: "base64", __val__: [72, 101, 108, 108, 111] }
+ * // Returns: { __encoding_type__: "utf8", __val__: "Hello" }
+ *
+ * @example
+ * // Encodes a string as base64
+ * encode("Hello", { string: "base64" })
+ * // Returns: { __encoding_type__: "base64", __val__: "SGVsbG8=" }
  *
  * @example
  * // Recursively encodes nested objects
  * encode({ name: "John", age: 30 })
- * // Returns: { name: { __encoding_type__: "base64", __val__: [...] }, age: 30 }
+ * // Returns: { name: { __encoding_type__: "utf8", __val__: "John" }, age: 30 }
  */
-function encode(enc, options = { string: "base64" }) {
-    const string = options?.string ?? "base64";
+function encode(enc, options = { string: "utf8" }) {
+    const string = options?.string ?? "utf8";
     switch (typeof enc) {
         case "string":
             switch (string) {
                 case "base64":
                     return {
                         __encoding_type__: "base64",
-                        __val__: Array.from(new TextEncoder().encode(enc))
+                        __val__: bytesToBase64(new TextEncoder().encode(enc))
                     };
                 default:
                     return {
-                        __encoding_type__: "none",
-                        __val__: []
+                        __encoding_type__: "utf8",
+                        __val__: enc.toWellFormed?.() ?? enc
                     };
             }
         case "object":
@@ -148,10 +199,41 @@ function encode(enc, options = { string: "base64" }) {
 function serialize(obj) {
     return (typeof obj === "string") ? obj : JSON.stringify(obj);
 }
+/**
+ * Runs several native calls in a single bridge round-trip.
+ * Calls run in order and each call's error is isolated, so one failing call
+ * doesn't stop the rest. Arguments are encoded and results decoded automatically.
+ *
+ * @param calls - Ordered list of calls. `fn` is the binding name without the `BIND_` prefix and `args` are its arguments
+ * @returns One result per call, in the same order
+ *
+ * @example
+ * const [size, position] = await batch([
+ *     { fn: "get_size" },
+ *     { fn: "get_position" }
+ * ]);
+ * // size: { ok: true, value: { width: 800, height: 600 } }
+ *
+ * @example
+ * await batch([
+ *     { fn: "set_size", args: [{ width: 800, height: 600 }] },
+ *     { fn: "change_title", args: ["Restored"] }
+ * ]);
+ */
+async function batch(calls) {
+    const results = await BIND_batch(calls.map(call => ({ fn: call.fn, args: encode(call.args ?? []) })));
+    if (!Array.isArray(results)) {
+        return calls.map(() => ({ ok: false, error: "Batch call was rejected" }));
+    }
+    return results.map((result) => result.ok
+        ? { ok: true, value: decode(result.value) }
+        : { ok: false, error: result.error });
+}
 export const Utils = {
     decode,
     encode,
-    serialize
+    serialize,
+    batch
 };
 // Ensure runtime callback bag is present in browser/webview contexts.
 if (typeof window !== "undefined") {
@@ -508,6 +590,21 @@ export var FS;
      */
     async function readFile(path) { return decode(await BIND_read_file(encode(path))); }
     FS.readFile = readFile;
+    /**
+     * Reads the raw bytes of a file without passing them through the JSON bridge.
+     * The engine registers a short-lived, token-protected URL on its web server and the
+     * bytes are streamed straight from disk with `fetch()`. Prefer this for large or binary files.
+     * @param path - Path to the file to read
+     * @returns Promise that resolves to the file's bytes or null if the file can't be read
+     */
+    async function readFileBuffer(path) {
+        const blob = decode(await BIND_read_file(encode(path), { blob: true }));
+        if (blob == null)
+            return null;
+        const res = await fetch(blob.url);
+        return res.ok ? await res.arrayBuffer() : null;
+    }
+    FS.readFileBuffer = readFileBuffer;
     /**
      * Writes contents to a file.
      * @param path - Path to the file to write
@@ -956,7 +1053,8 @@ export class Process {
         }
     }
     /**
-     * Gets messages for a specific process or all messages.
+     * Gets the retained messages from a specific process or from all processes.
+     * Only the newest messages are kept (see `server.inbox_messages` / `server.inbox_bytes`).
      * @param pid - Process ID to get messages for (-1 for all messages)
      * @returns Array of messages
      * @example
@@ -964,11 +1062,31 @@ export class Process {
      * const procMessages = await Process.getMessages(1234);
      */
     static async getMessages(pid = -1) {
-        const messages = decode(await BIND_get_messages());
+        const messages = (await Process.pollMessages(0, Number.MAX_SAFE_INTEGER)).messages;
         return (pid < 0) ? messages : messages.filter(msg => {
-            return Object.hasOwnProperty.call(msg, "pid") && msg.pid == pid;
+            return (msg?.sender?.pid ?? msg?.pid) == pid;
         });
     }
+    /**
+     * Gets messages received after a sequence number, oldest first. Pass the returned `last_seq`
+     * to the next call to read each message exactly once.
+     * @param since_seq - Return messages with a larger sequence number (0 for the oldest retained)
+     * @param max - Most messages to return
+     * @returns The messages (each with a `seq`), the cursor for the next call, the oldest retained sequence number and how many messages were dropped so far
+     * @example
+     * let cursor = 0;
+     * const { messages, last_seq } = await Process.pollMessages(cursor);
+     * cursor = last_seq;
+     */
+    static async pollMessages(since_seq = 0, max = 256) {
+        const result = await BIND_get_messages(since_seq, max);
+        return {
+            messages: decode(result?.messages ?? []),
+            last_seq: result?.last_seq ?? since_seq,
+            first_seq: result?.first_seq ?? 0,
+            dropped: result?.dropped ?? 0
+        };
+    }
     /**
      * Gets detailed information about a specific process.
      * @param pid - Process ID to query
@@ -986,6 +1104,8 @@ export class Process {
     }
     /**
      * Gets a list of processes with optional filtering.
+     * Other RenWeb processes are listed from a cache that refreshes in the background, so
+     * their details may be up to `server.peer_cache_ttl_ms` old.
      * @param filter - Filter type: '' (all), 'system' (system processes), 'renweb' (RenWeb processes), 'child' (child processes)
      * @returns Array of Process instances
      * @example
@@ -1050,6 +1170,63 @@ export var Debug;
      */
     async function closeDevtools() { await BIND_close_devtools(null); }
     Debug.closeDevtools = closeDevtools;
+    /**
+     * Gets statistics for the worker pool that runs long bindings (file copies, process waits, etc.) off the UI thread.
+     * Process waits run on their own lane, reported under `blocking`. Calls still queued at shutdown are rejected.
+     * @returns Promise that resolves to queue depth, counters, queue wait latency and per-binding run latency
+     */
+    async function getAsyncStats() { return await BIND_get_async_stats(null); }
+    Debug.getAsyncStats = getAsyncStats;
+    /**
+     * Gets statistics for the embedded web server, such as hot asset cache usage, hit/miss counts, compression counters and HTTP worker pool load.
+     * @returns Promise that resolves to the server statistics
+     */
+    async function getServerStats() { return await BIND_get_server_stats(null); }
+    Debug.getServerStats = getServerStats;
+    /**
+     * Gets request metrics for the embedded web server: per-route and per-status counters, bytes sent and latency percentiles.
+     * The same data is served to trusted local clients at `/??metrics` (JSON) and `/??metrics=prometheus`.
+     * @param format - "json" for an object, or "prometheus" for Prometheus text exposition
+     * @returns Promise that resolves to the metrics object, or the Prometheus text
+     */
+    async function getServerMetrics(format = "json") {
+        const metrics = await BIND_get_server_metrics(encode(format));
+        return (format === "prometheus") ? decode(metrics) : metrics;
+    }
+    Debug.getServerMetrics = getServerMetrics;
+    /**
+     * Gets per-binding profile data for every native call made so far: call and error counts, total time split into
+     * decode, execute and encode, latency percentiles and request/response sizes. Bindings are ordered by total time.
+     * @returns Promise that resolves to the profile, keyed by binding name under `bindings`
+     */
+    async function getBindingStats() { return await BIND_get_binding_stats(null); }
+    Debug.getBindingStats = getBindingStats;
+    /**
+     * Starts or stops recording every native call as Chrome trace spans (open the file in chrome://tracing or Perfetto).
+     * Stopping writes the file.
+     * @param enabled - true to start tracing, false to stop and write the trace
+     * @param path - Trace file, relative to the application directory (default: "binding-trace.json")
+     * @returns Promise that resolves to the trace file path, or null when stopping with no trace running
+     */
+    async function setBindingTrace(enabled, path) {
+        const result = await BIND_set_binding_trace(enabled, (path === undefined) ? null : encode(path));
+        return decode(result);
+    }
+    Debug.setBindingTrace = setBindingTrace;
+    /**
+     * Gets window event delivery stats. onMove and onWindowStateChanged are coalesced: only the latest payload per event
+     * is delivered, at most once per frame, and events superseded before delivery are counted as dropped.
+     * @returns Promise that resolves to { frame_ms, posted, delivered, dropped, flushes, pending, events }
+     */
+    async function getEventStats() { return await BIND_get_event_stats(null); }
+    Debug.getEventStats = getEventStats;
+    /**
+     * Gets stats for the queue that carries native notifications into the page. Scripts queued from any thread are run
+     * together in one eval per main-loop iteration; a growing depth or latency means the UI thread is saturated.
+     * @returns Promise that resolves to { depth, max_depth, queued, wakeups, evals, scripts_per_eval, bytes, latency, eval }
+     */
+    async function getEvalStats() { return await BIND_get_eval_stats(null); }
+    Debug.getEvalStats = getEvalStats;
 })(Debug || (Debug = {}));
 /**
  * Network status and loading information.
@@ -33,22 +33,66 @@
 * -----------------------------------------------
 */ 
 
+/**
+ * Converts a base64 string into raw bytes.
+ * Uses the native `Uint8Array.fromBase64` when the engine provides it.
+ * 
+ * @param b64 - RFC 4648 base64 text
+ * @returns The decoded bytes
+ */
+function base64ToBytes(b64: string): Uint8Array {
+    const from_base64 = (Uint8Array as any).fromBase64;
+    if (typeof from_base64 === "function") {
+        return from_base64.call(Uint8Array, b64);
+    }
+    const bin = atob(b64);
+    const bytes = new Uint8Array(bin.length);
+    for (let i = 0; i < bin.length; i++) {
+        bytes[i] = bin.charCodeAt(i);
+    }
+    return bytes;
+}
+
+/**
+ * Converts raw bytes into a base64 string.
+ * Uses the native `Uint8Array.prototype.toBase64` when the engine provides it.
+ * 
+ * @param bytes - The bytes to encode
+ * @returns RFC 4648 base64 text
+ */
+function bytesToBase64(bytes: Uint8Array): string {
+    if (typeof (bytes as any).toBase64 === "function") {
+        return (bytes as any).toBase64();
+    }
+    const chunk_size = 0x8000;
+    let bin = "";
+    for (let i = 0; i < bytes.length; i += chunk_size) {
+        bin += String.fromCharCode.apply(null, Array.from(bytes.subarray(i, i + chunk_size)));
+    }
+    return btoa(bin);
+}
+
 /**
  * Recursively decodes encoded values in an object structure.
  * Detects objects with __encoding_type__ and __val__ properties and decodes them.
- * Currently supports base64 encoding type.
+ * Supports the "utf8" (plain string) and "base64" (base64 string or legacy byte array) encoding types.
  * 
  * @param dec - The value to decode (can be any type)
  * @returns The decoded value with all nested encoded values converted
  * 
  * @example
- * // Decodes a base64 encoded string
- * decode({ __encoding_type__: "base64", __val__: [72, 101, 108, 108, 111] })
+ * // Decodes a UTF-8 passthrough string
+ * decode({ __encoding_type__: "utf8", __val__: "Hello" })
+ * // Returns: "Hello"
+ * 
+ * @example
+ * // Decodes a base64 encoded string (the legacy byte array form is also accepted)
+ * decode({ __encoding_type__: "base64", __val__: "SGVsbG8=" })
  * // Returns: "Hello"
  * 
  * @example
  * // Recursively decodes nested objects
- * decode({ name: { __encoding_type__: "base64", __val__: [74, 111, 104, 110] } })
+ * decode({ name: { __encoding_type__: "utf8", __val__: "John" } })
  * // Returns: { name: "John" }
  */
 function decode(dec: any): any {
@@ -58,8 +102,12 @@ function decode(dec: any): any {
                 return null;
             } else if ("__encoding_type__" in dec && "__val__" in dec) {
                 switch (dec.__encoding_type__) {
+                    case "utf8":
+                        return dec.__val__;
                     case "base64":
-                        return new TextDecoder().decode(new Uint8Array(dec.__val__));
+                        return new TextDecoder().decode(
+                            (typeof dec.__val__ === "string") ? base64ToBytes(dec.__val__) : new Uint8Array(dec.__val__)
+                        );
                     default:
                         return dec;
                 }
@@ -83,34 +131,39 @@ function decode(dec: any): any {
  * Arrays and objects are processed recursively.
  * 
  * @param enc - The value to encode (can be any type)
- * @param options - Encoding options (default: { string: "base64" })
- * @param options.string - The encoding type for strings (default: "base64")
+ * @param options - Encoding options (default: { string: "utf8" })
+ * @param options.string - The encoding type for strings: "utf8" sends the string as-is, "base64" sends its UTF-8 bytes as base64 (default: "utf8")
  * @returns The encoded value with all nested strings converted to encoded format
  * 
  * @example
- * // Encodes a string to base64 format
+ * // Encodes a string for the bridge
  * encode("Hello")
- * // Returns: { __encoding_type__: "base64", __val__: [72, 101, 108, 108, 111] }
+ * // Returns: { __encoding_type__: "utf8", __val__: "Hello" }
+ * 
+ * @example
+ * // Encodes a string as base64
+ * encode("Hello", { string: "base64" })
+ * // Returns: { __encoding_type__: "base64", __val__: "SGVsbG8=" }
  * 
  * @example
  * // Recursively encodes nested objects
  * encode({ name: "John", age: 30 })
- * // Returns: { name: { __encoding_type__: "base64", __val__: [...] }, age: 30 }
+ * // Returns: { name: { __encoding_type__: "utf8", __val__: "John" }, age: 30 }
  */
-function encode(enc: any, options: { string: "base64" } = { string: "base64" }): any {
-    const string = options?.string ?? "base64";
+function encode(enc: any, options: { string: "utf8" | "base64" } = { string: "utf8" }): any {
+    const string = options?.string ?? "utf8";
     switch (typeof enc) {
         case "string":
             switch (string) {
                 case "base64":
                     return {
                         __encoding_type__: "base64",
-                        __val__: Array.from(new TextEncoder().encode(enc))
+                        __val__: bytesToBase64(new TextEncoder().encode(enc))
                     };
                 default:
                     return {
-                        __encoding_type__: "none",
-                        __val__: []
+                        __encoding_type__: "utf8",
+                        __val__: (enc as any).toWellFormed?.() ?? enc
                     };
             }
         case "object":
@@ -148,10 +201,42 @@ function serialize(obj: any): string {
     return (typeof obj === "string") ? obj : JSON.stringify(obj);
 }
 
+/**
+ * Runs several native calls in a single bridge round-trip.
+ * Calls run in order and each call's error is isolated, so one failing call
+ * doesn't stop the rest. Arguments are encoded and results decoded automatically.
+ *
+ * @param calls - Ordered list of calls. `fn` is the binding name without the `BIND_` prefix and `args` are its arguments
+ * @returns One result per call, in the same order
+ *
+ * @example
+ * const [size, position] = await batch([
+ *     { fn: "get_size" },
+ *     { fn: "get_position" }
+ * ]);
+ * // size: { ok: true, value: { width: 800, height: 600 } }
+ *
+ * @example
+ * await batch([
+ *     { fn: "set_size", args: [{ width: 800, height: 600 }] },
+ *     { fn: "change_title", args: ["Restored"] }
+ * ]);
+ */
+async function batch(calls: { fn: string, args?: any[] }[]): Promise<{ ok: boolean, value?: any, error?: string }[]> {
+    const results = await BIND_batch(calls.map(call => ({ fn: call.fn, args: encode(call.args ?? []) })));
+    if (!Array.isArray(results)) {
+        return calls.map(() => ({ ok: false, error: "Batch call was rejected" }));
+    }
+    return results.map((result: any) => result.ok
+        ? { ok: true, value: decode(result.value) }
+        : { ok: false, error: result.error });
+}
+
 export const Utils = {
     decode,
     encode,
-    serialize
+    serialize,
+    batch
 };
 
 
@@ -225,13 +310,34 @@ export interface RenWebCallbacks {
 
     /**
      * Called when a message is received from another RenWeb process via `proc.send()`.
-     * The `msg` parameter will already be decoded.
+     * The `msg` parameter will already be decoded. On pages served by the app, messages arrive in
+     * order over one `/??events` stream that the engine opens at page load.
      * @example
      * window.renweb.onServerMessage = async (msg) => {
      *     await Log.info(`Received from PID ${msg?.sender?.pid}:`, msg?.message);
      * };
      */
     onServerMessage?: (msg: ({ sender: Process, message: any }) | any) => void | Promise<void>;
+
+    /**
+     * Called when a message sent with `proc.send()` could not be delivered, either because the
+     * peer did not answer or because too many messages were already queued for it.
+     * @example
+     * window.renweb.onMessageFailed = async ({ to, error }) => {
+     *     await Log.warn(`Message to ${to} failed: ${error}`);
+     * };
+     */
+    onMessageFailed?: (event: { to: string, message: any, error: string }) => void | Promise<void>;
+
+    /**
+     * Called when other RenWeb processes appear or go away, after this window has listed them
+     * once with `Process.dumpProcesses()`. `added` holds process info objects, `removed` holds PIDs.
+     * @example
+     * window.renweb.onProcessesChanged = async ({ added, removed }) => {
+     *     await Log.info(`${added.length} windows opened, ${removed.length} closed`);
+     * };
+     */
+    onProcessesChanged?: (event: { generation: number, added: any[], removed: number[] }) => void | Promise<void>;
 }
 
 /**
@@ -644,6 +750,20 @@ export namespace FS {
     export async function readFile(path: string): Promise<string | null> 
         { return decode(await BIND_read_file(encode(path))); }
     
+    /**
+     * Reads the raw bytes of a file without passing them through the JSON bridge.
+     * The engine registers a short-lived, token-protected URL on its web server and the
+     * bytes are streamed straight from disk with `fetch()`. Prefer this for large or binary files.
+     * @param path - Path to the file to read
+     * @returns Promise that resolves to the file's bytes or null if the file can't be read
+     */
+    export async function readFileBuffer(path: string): Promise<ArrayBuffer | null> {
+        const blob = decode(await BIND_read_file(encode(path), { blob: true }));
+        if (blob == null) return null;
+        const res = await fetch(blob.url);
+        return res.ok ? await res.arrayBuffer() : null;
+    }
+    
     /**
      * Writes contents to a file.
      * @param path - Path to the file to write
@@ -1248,7 +1368,8 @@ export class Process {
     }
     
     /**
-     * Gets messages for a specific process or all messages.
+     * Gets the retained messages from a specific process or from all processes.
+     * Only the newest messages are kept (see `server.inbox_messages` / `server.inbox_bytes`).
      * @param pid - Process ID to get messages for (-1 for all messages)
      * @returns Array of messages
      * @example
@@ -1256,12 +1377,33 @@ export class Process {
      * const procMessages = await Process.getMessages(1234);
      */
     public static async getMessages(pid: number = -1): Promise<any[]> {
-        const messages: any[] = decode(await BIND_get_messages() as any[]);
+        const messages: any[] = (await Process.pollMessages(0, Number.MAX_SAFE_INTEGER)).messages;
         return (pid < 0) ? messages : messages.filter(msg => {
-            return Object.hasOwnProperty.call(msg, "pid") && msg.pid == pid;
+            return (msg?.sender?.pid ?? msg?.pid) == pid;
         });
     }
     
+    /**
+     * Gets messages received after a sequence number, oldest first. Pass the returned `last_seq`
+     * to the next call to read each message exactly once.
+     * @param since_seq - Return messages with a larger sequence number (0 for the oldest retained)
+     * @param max - Most messages to return
+     * @returns The messages (each with a `seq`), the cursor for the next call, the oldest retained sequence number and how many messages were dropped so far
+     * @example
+     * let cursor = 0;
+     * const { messages, last_seq } = await Process.pollMessages(cursor);
+     * cursor = last_seq;
+     */
+    public static async pollMessages(since_seq: number = 0, max: number = 256): Promise<{ messages: any[], last_seq: number, first_seq: number, dropped: number }> {
+        const result: any = await BIND_get_messages(since_seq, max);
+        return {
+            messages: decode(result?.messages ?? []),
+            last_seq: result?.last_seq ?? since_seq,
+            first_seq: result?.first_seq ?? 0,
+            dropped: result?.dropped ?? 0
+        };
+    }
+    
     /**
      * Gets detailed information about a specific process.
      * @param pid - Process ID to query
@@ -1296,6 +1438,8 @@ export class Process {
     
     /**
      * Gets a list of processes with optional filtering.
+     * Other RenWeb processes are listed from a cache that refreshes in the background, so
+     * their details may be up to `server.peer_cache_ttl_ms` old.
      * @param filter - Filter type: '' (all), 'system' (system processes), 'renweb' (RenWeb processes), 'child' (child processes)
      * @returns Array of Process instances
      * @example
@@ -1397,6 +1541,68 @@ export namespace Debug {
      */
     export async function closeDevtools(): Promise<void> 
         { await BIND_close_devtools(null); }
+    
+    /**
+     * Gets statistics for the worker pool that runs long bindings (file copies, process waits, etc.) off the UI thread.
+     * Process waits run on their own lane, reported under `blocking`. Calls still queued at shutdown are rejected.
+     * @returns Promise that resolves to queue depth, counters, queue wait latency and per-binding run latency
+     */
+    export async function getAsyncStats(): Promise<any> 
+        { return await BIND_get_async_stats(null); }
+    
+    /**
+     * Gets statistics for the embedded web server, such as hot asset cache usage, hit/miss counts, compression counters and HTTP worker pool load.
+     * @returns Promise that resolves to the server statistics
+     */
+    export async function getServerStats(): Promise<any> 
+        { return await BIND_get_server_stats(null); }
+    
+    /**
+     * Gets request metrics for the embedded web server: per-route and per-status counters, bytes sent and latency percentiles.
+     * The same data is served to trusted local clients at `/??metrics` (JSON) and `/??metrics=prometheus`.
+     * @param format - "json" for an object, or "prometheus" for Prometheus text exposition
+     * @returns Promise that resolves to the metrics object, or the Prometheus text
+     */
+    export async function getServerMetrics(format: "json" | "prometheus" = "json"): Promise<any> {
+        const metrics = await BIND_get_server_metrics(encode(format));
+        return (format === "prometheus") ? decode(metrics) : metrics;
+    }
+    
+    /**
+     * Gets per-binding profile data for every native call made so far: call and error counts, total time split into
+     * decode, execute and encode, latency percentiles and request/response sizes. Bindings are ordered by total time.
+     * @returns Promise that resolves to the profile, keyed by binding name under `bindings`
+     */
+    export async function getBindingStats(): Promise<any> 
+        { return await BIND_get_binding_stats(null); }
+    
+    /**
+     * Starts or stops recording every native call as Chrome trace spans (open the file in chrome://tracing or Perfetto).
+     * Stopping writes the file.
+     * @param enabled - true to start tracing, false to stop and write the trace
+     * @param path - Trace file, relative to the application directory (default: "binding-trace.json")
+     * @returns Promise that resolves to the trace file path, or null when stopping with no trace running
+     */
+    export async function setBindingTrace(enabled: boolean, path?: string): Promise<string | null> {
+        const result = await BIND_set_binding_trace(enabled, (path === undefined) ? null : encode(path));
+        return decode(result);
+    }
+    
+    /**
+     * Gets window event delivery stats. onMove and onWindowStateChanged are coalesced: only the latest payload per event
+     * is delivered, at most once per frame, and events superseded before delivery are counted as dropped.
+     * @returns Promise that resolves to { frame_ms, posted, delivered, dropped, flushes, pending, events }
+     */
+    export async function getEventStats(): Promise<any> 
+        { return await BIND_get_event_stats(null); }
+    
+    /**
+     * Gets stats for the queue that carries native notifications into the page. Scripts queued from any thread are run
+     * together in one eval per main-loop iteration; a growing depth or latency means the UI thread is saturated.
+     * @returns Promise that resolves to { depth, max_depth, queued, wakeups, evals, scripts_per_eval, bytes, latency, eval }
+     */
+    export async function getEvalStats(): Promise<any> 
+        { return await BIND_get_eval_stats(null); }
 }
 
 /**
@@ -1562,6 +1768,8 @@ export namespace Navigate {
 * -----------------------------------------------
 */ 
 
+declare const BIND_batch: (...args: any[]) => Promise<any>;
+
 declare const BIND_get_size: (...args: any[]) => Promise<any>;
 declare const BIND_set_size: (...args: any[]) => Promise<any>;
 declare const BIND_get_position: (...args: any[]) => Promise<any>;
@@ -1658,6 +1866,13 @@ declare const BIND_get_messages: (...args: any[]) => Promise<any>;
 declare const BIND_clear_console: (...args: any[]) => Promise<any>;
 declare const BIND_open_devtools: (...args: any[]) => Promise<any>;
 declare const BIND_close_devtools: (...args: any[]) => Promise<any>;
+declare const BIND_get_async_stats: (...args: any[]) => Promise<any>;
+declare const BIND_get_server_stats: (...args: any[]) => Promise<any>;
+declare const BIND_get_server_metrics: (...args: any[]) => Promise<any>;
+declare const BIND_get_binding_stats: (...args: any[]) => Promise<any>;
+declare const BIND_set_binding_trace: (...args: any[]) => Promise<any>;
+declare const BIND_get_event_stats: (...args: any[]) => Promise<any>;
+declare const BIND_get_eval_stats: (...args: any[]) => Promise<any>;
 
 declare const BIND_get_load_progress: (...args: any[]) => Promise<any>;
 declare const BIND_is_loading: (...args: any[]) => Promise<any>;
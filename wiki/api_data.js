@@ -114,6 +114,7 @@ window.apiData = {
     ],
     'FS': [
         {name: 'readFile', signature: 'readFile(path)', description: 'Returns: Promise<string | null>'},
+        {name: 'readFileBuffer', signature: 'readFileBuffer(path)', description: 'Returns: Promise<ArrayBuffer | null>'},
         {name: 'writeFile', signature: 'writeFile(path, contents, settings = { append: false })', description: 'Returns: Promise<boolean>'},
         {name: 'exists', signature: 'exists(path)', description: 'Returns: Promise<boolean>'},
         {name: 'isDir', signature: 'isDir(path)', description: 'Returns: Promise<boolean>'},
@@ -151,6 +152,7 @@ window.apiData = {
         {name: 'dumpCurrentProcess', signature: 'dumpCurrentProcess()', description: 'Returns: Promise<Process | null>'},
         {name: 'listenToOutput', signature: 'listenToOutput(lines = -1, options = { tail: false })', description: 'Returns: Promise<string[]>'},
         {name: 'getMessages', signature: 'getMessages(pid = -1)', description: 'Returns: Promise<any[]>'},
+        {name: 'pollMessages', signature: 'pollMessages(since_seq = 0, max = 256)', description: 'Returns: Promise<{ messages, last_seq, first_seq, dropped }>'},
         {name: 'waitAll', signature: 'waitAll()', description: 'Returns: Promise<void>'},
         {name: 'refresh', signature: 'refresh()', description: 'Returns: Promise<Process>'},
         {name: 'kill', signature: 'kill(signal = 0x2)', description: 'Returns: Promise<Process>'},
@@ -161,7 +163,14 @@ window.apiData = {
     'Debug': [
         {name: 'clearConsole', signature: 'clearConsole()', description: 'Returns: Promise<void>'},
         {name: 'openDevtools', signature: 'openDevtools()', description: 'Returns: Promise<void>'},
-        {name: 'closeDevtools', signature: 'closeDevtools()', description: 'Returns: Promise<void>'}
+        {name: 'closeDevtools', signature: 'closeDevtools()', description: 'Returns: Promise<void>'},
+        {name: 'getAsyncStats', signature: 'getAsyncStats()', description: 'Returns: Promise<any>'},
+        {name: 'getServerStats', signature: 'getServerStats()', description: 'Returns: Promise<any>'},
+        {name: 'getServerMetrics', signature: 'getServerMetrics(format?)', description: 'Returns: Promise<any>'},
+        {name: 'getBindingStats', signature: 'getBindingStats()', description: 'Returns: Promise<any>'},
+        {name: 'setBindingTrace', signature: 'setBindingTrace(enabled, path?)', description: 'Returns: Promise<string | null>'},
+        {name: 'getEventStats', signature: 'getEventStats()', description: 'Returns: Promise<any>'},
+        {name: 'getEvalStats', signature: 'getEvalStats()', description: 'Returns: Promise<any>'}
     ],
     'Network': [
         {name: 'getLoadProgress', signature: 'getLoadProgress()', description: 'Returns: Promise<number>'},
@@ -181,9 +190,10 @@ window.apiData = {
         {name: 'getPluginsList', signature: 'getPluginsList()', description: 'Returns: Promise<any[]>'}
     ],
     'Utils': [
-        {name: 'decode', signature: 'decode(str)', description: 'Decode a base64 string'},
-        {name: 'encode', signature: 'encode(str, options = { string: "base64" })', description: 'Encode a string to base64'},
-        {name: 'serialize', signature: 'serialize(obj)', description: 'Serialize an object to JSON'}
+        {name: 'decode', signature: 'decode(str)', description: 'Decode a bridge-encoded value (utf8 or base64)'},
+        {name: 'encode', signature: 'encode(str, options = { string: "utf8" })', description: 'Encode a string for the bridge (utf8 or base64)'},
+        {name: 'serialize', signature: 'serialize(obj)', description: 'Serialize an object to JSON'},
+        {name: 'batch', signature: 'batch(calls)', description: 'Run several native calls in one round-trip'}
     ],
     'Callbacks': [
         {name: 'window.renweb.onReady', signature: 'window.renweb.onReady = async () => {...}', description: 'Called once the application is fully initialised and ready for interaction.'},
@@ -195,6 +205,8 @@ window.apiData = {
         {name: 'window.renweb.onRenderProcessTerminated', signature: 'window.renweb.onRenderProcessTerminated = async (event) => {...}', description: 'Called when the web render process crashes/exits/unresponds.'},
         {name: 'window.renweb.onCertificateError', signature: 'window.renweb.onCertificateError = async (event) => {...}', description: 'Called on TLS/certificate validation failures exposed by the native webview.'},
         {name: 'window.renweb.onServerMessage', signature: 'window.renweb.onServerMessage = async (message) => {...}', description: 'Called when another process sends a message to this window via Process.send().'},
+        {name: 'window.renweb.onMessageFailed', signature: 'window.renweb.onMessageFailed = async (event) => {...}', description: 'Called when a Process.send() message could not be delivered.'},
+        {name: 'window.renweb.onProcessesChanged', signature: 'window.renweb.onProcessesChanged = async (event) => {...}', description: 'Called when other RenWeb processes appear or go away.'},
     ],
     'Plugin': [
         // Constructor